@@ -10,6 +10,7 @@
 
 #include "common/device_measurements.hpp"
 #include "common/utils.hpp"
+#include "common/os_utils.hpp"
 
 using namespace hailort;
 
@@ -74,6 +75,7 @@ hailo_status TemperatureMeasurement::start_measurement()
 {
     m_is_thread_running = true;
     m_thread = std::thread([this] () {
+        OsUtils::set_current_thread_name("TEMP_MEASURE");
         while (m_is_thread_running.load()) {
             auto temp_info = m_device.get_chip_temperature();
             if (HAILO_SUCCESS != temp_info.status()) {
@@ -135,6 +137,7 @@ hailo_status PowerMeasurement::start_measurement()
    
     m_is_thread_running = true;
     m_thread = std::thread([this] () -> hailo_status {
+        OsUtils::set_current_thread_name("POWER_MEASURE");
         const bool clear_power_measurement_history = true;
         while (m_is_thread_running.load()) { 
             std::this_thread::sleep_for(DEFAULT_MEASUREMENTS_INTERVAL);
@@ -16,13 +16,133 @@
 #include <set>
 #include <mutex>
 #include <unordered_map>
+#include <array>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 
 namespace hailort
 {
 
 /**
- * Used to measure latency of hailo datastream - the average amount of time between
- * the start of the action to the end of the last stream.
+ * Histogram of latency samples, with fixed log-linear buckets - every power of 2 range is split into
+ * SUB_BUCKETS_COUNT linear buckets, so the width of a bucket is at most 1/SUB_BUCKETS_COUNT of the values in it.
+ * @note Not thread safe - LatencyMeter adds the samples and takes the snapshots under its lock.
+ */
+class LatencyHistogram final {
+public:
+    using duration = std::chrono::nanoseconds;
+
+    static constexpr uint32_t SUB_BUCKETS_BITS = 4;
+    static constexpr uint32_t SUB_BUCKETS_COUNT = (1 << SUB_BUCKETS_BITS);
+    // Samples above 2^MAX_VALUE_BITS ns (~18 minutes) are counted in the last bucket
+    static constexpr uint32_t MAX_VALUE_BITS = 40;
+    static constexpr size_t BUCKETS_COUNT = (MAX_VALUE_BITS - SUB_BUCKETS_BITS + 1) * SUB_BUCKETS_COUNT;
+
+    struct Snapshot {
+        uint64_t count = 0;
+        duration sum = duration(0);
+        duration max = duration(0);
+        std::array<uint64_t, BUCKETS_COUNT> buckets{};
+
+        duration mean() const
+        {
+            return (0 == count) ? duration(0) : duration(sum.count() / static_cast<duration::rep>(count));
+        }
+
+        // Returns the latency under which the given percent (0-100) of the samples are, up to the bucket resolution
+        // (the middle of the bucket is returned).
+        duration percentile(double percent) const
+        {
+            if (0 == count) {
+                return duration(0);
+            }
+
+            const auto rank = std::max<uint64_t>(1,
+                static_cast<uint64_t>(std::ceil((std::min(percent, 100.0) / 100.0) * static_cast<double>(count))));
+            uint64_t samples_so_far = 0;
+            for (size_t i = 0; i < BUCKETS_COUNT; i++) {
+                samples_so_far += buckets[i];
+                if (samples_so_far >= rank) {
+                    return std::min(max, duration(static_cast<duration::rep>(bucket_middle_value(i))));
+                }
+            }
+            return max;
+        }
+
+        void merge(const Snapshot &other)
+        {
+            count += other.count;
+            sum += other.sum;
+            max = std::max(max, other.max);
+            for (size_t i = 0; i < BUCKETS_COUNT; i++) {
+                buckets[i] += other.buckets[i];
+            }
+        }
+    };
+
+    void add_sample(duration latency)
+    {
+        const auto value = std::max(latency, duration(0));
+        m_samples.buckets[bucket_index(static_cast<uint64_t>(value.count()))]++;
+        m_samples.count++;
+        m_samples.sum += value;
+        m_samples.max = std::max(m_samples.max, value);
+    }
+
+    /**
+     * Returns the samples added so far. When reset=true, the returned samples are removed from the histogram, so
+     * consecutive calls return the samples of consecutive intervals (each sample is returned exactly once).
+     */
+    Snapshot snapshot(bool reset)
+    {
+        Snapshot result = m_samples;
+        if (reset) {
+            m_samples = Snapshot{};
+        }
+        return result;
+    }
+
+private:
+    static size_t bucket_index(uint64_t value)
+    {
+        if (value < SUB_BUCKETS_COUNT) {
+            // The first buckets are exact
+            return static_cast<size_t>(value);
+        }
+
+        uint32_t msb = SUB_BUCKETS_BITS;
+        while ((msb < 63) && ((value >> (msb + 1)) != 0)) {
+            msb++;
+        }
+        if (msb >= MAX_VALUE_BITS) {
+            return BUCKETS_COUNT - 1;
+        }
+
+        const uint32_t shift = msb - SUB_BUCKETS_BITS;
+        const auto sub_bucket = static_cast<size_t>((value >> shift) - SUB_BUCKETS_COUNT);
+        return ((shift + 1) * SUB_BUCKETS_COUNT) + sub_bucket;
+    }
+
+    static uint64_t bucket_middle_value(size_t index)
+    {
+        if (index < SUB_BUCKETS_COUNT) {
+            return static_cast<uint64_t>(index);
+        }
+
+        const auto shift = static_cast<uint32_t>((index / SUB_BUCKETS_COUNT) - 1);
+        const auto sub_bucket = static_cast<uint64_t>(index % SUB_BUCKETS_COUNT);
+        const uint64_t bucket_start = (SUB_BUCKETS_COUNT + sub_bucket) << shift;
+        return bucket_start + ((1ULL << shift) / 2);
+    }
+
+    Snapshot m_samples;
+};
+
+/**
+ * Used to measure latency of hailo datastream - the amount of time between the start of the action to the end of
+ * the last stream. The latencies are kept in a LatencyHistogram, so both the average and the distribution can be
+ * queried.
  */
 class LatencyMeter final {
 public:
@@ -31,8 +151,7 @@ public:
 
     LatencyMeter(const std::set<std::string> &output_names, size_t timestamps_list_length) :
         m_start_timestamps(timestamps_list_length),
-        m_latency_count(0),
-        m_latency_sum(0)
+        m_latency_histogram()
     {
         for (auto &ch : output_names) {
             m_end_timestamps_per_channel.emplace(ch, TimestampsArray(timestamps_list_length));
@@ -68,19 +187,28 @@ public:
      */
     Expected<duration> get_latency(bool clear)
     {
-        std::lock_guard<std::mutex> lock_guard(m_lock);
+        auto histogram = get_latency_histogram(clear);
+        if (!histogram) {
+            return make_unexpected(histogram.status());
+        }
+        return histogram->mean();
+    }
 
-        if (m_latency_count == 0) {
+    /**
+     * Queries the measured latencies distribution. One can clear measured latency by passing clear=true (then the
+     * next query returns only the latencies measured after this one).
+     */
+    Expected<LatencyHistogram::Snapshot> get_latency_histogram(bool clear)
+    {
+        // Taken under the lock, so the snapshot is of a single interval
+        std::unique_lock<std::mutex> lock(m_lock);
+        auto histogram = m_latency_histogram.snapshot(clear);
+        lock.unlock();
+        if (0 == histogram.count) {
             return make_unexpected(HAILO_NOT_AVAILABLE);
         }
-        
-        duration latency = (m_latency_sum / m_latency_count);
-        if (clear) {
-            m_latency_sum = duration();
-            m_latency_count = 0;
-        }
 
-        return latency;
+        return histogram;
     }
 
 private:
@@ -107,8 +235,7 @@ private:
         assert(start <= end);
 
         // calculate the latency
-        m_latency_sum += (end - start);
-        m_latency_count++;
+        m_latency_histogram.add_sample(end - start);
 
         // pop fronts
         m_start_timestamps.pop_front();
@@ -122,8 +249,7 @@ private:
     TimestampsArray m_start_timestamps;
     std::unordered_map<std::string, TimestampsArray> m_end_timestamps_per_channel;
 
-    size_t m_latency_count;
-    duration m_latency_sum;
+    LatencyHistogram m_latency_histogram;
 };
 
 using LatencyMeterPtr = std::shared_ptr<LatencyMeter>;
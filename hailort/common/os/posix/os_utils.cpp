@@ -10,11 +10,17 @@
 #include "hailo/hailort.h"
 #include "common/os_utils.hpp"
 #include "common/utils.hpp"
+#include "common/thread_policy.hpp"
 #include "spdlog/sinks/syslog_sink.h"
 
 #include <unistd.h>
 #include <signal.h>
 #include <sched.h>
+#include <pthread.h>
+#include <sys/resource.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif /* defined(__linux__) */
 
 #if defined(__QNX__)
 #define OS_UTILS__QNX_PAGE_SIZE (4096)
@@ -49,6 +55,15 @@ void OsUtils::set_current_thread_name(const std::string &name)
     assert(name.size() < 16);
     pthread_setname_np(pthread_self(), name.c_str());
 #endif /* NDEBUG */
+
+    auto policy = ThreadPolicyConfig::get_instance().get_policy(name);
+    if (policy) {
+        auto status = set_current_thread_policy(policy.value());
+        if (HAILO_SUCCESS != status) {
+            // Not fatal, the thread keeps running with the default policy
+            LOGGER__WARNING("Failed applying thread policy of {}, status = {}", name, status);
+        }
+    }
 }
 
 hailo_status OsUtils::set_current_thread_affinity(uint8_t cpu_index)
@@ -70,6 +85,60 @@ hailo_status OsUtils::set_current_thread_affinity(uint8_t cpu_index)
 #endif
 }
 
+static int to_posix_scheduling_policy(ThreadPolicy::SchedulingPolicy scheduling_policy)
+{
+    switch (scheduling_policy) {
+    case ThreadPolicy::SchedulingPolicy::FIFO:
+        return SCHED_FIFO;
+    case ThreadPolicy::SchedulingPolicy::RR:
+        return SCHED_RR;
+    default:
+        return SCHED_OTHER;
+    }
+}
+
+hailo_status OsUtils::set_current_thread_policy(const ThreadPolicy &policy)
+{
+    if (!policy.cpus.empty()) {
+#if defined(__linux__)
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        for (const auto cpu : policy.cpus) {
+            CHECK(cpu < CPU_SETSIZE, HAILO_INVALID_ARGUMENT, "Invalid cpu index {}", cpu);
+            CPU_SET(cpu, &cpuset);
+        }
+
+        static const pid_t CURRENT_THREAD = 0;
+        int rc = sched_setaffinity(CURRENT_THREAD, sizeof(cpu_set_t), &cpuset);
+        CHECK(rc == 0, HAILO_INTERNAL_FAILURE, "sched_setaffinity failed with errno {}", errno);
+#else
+        LOGGER__WARNING("Thread cpus are not supported on this platform, ignoring");
+#endif
+    }
+
+    if (ThreadPolicy::SchedulingPolicy::UNCHANGED != policy.scheduling_policy) {
+        const int posix_policy = to_posix_scheduling_policy(policy.scheduling_policy);
+        struct sched_param param{};
+        param.sched_priority = (SCHED_OTHER == posix_policy) ? 0 : policy.priority;
+        int rc = pthread_setschedparam(pthread_self(), posix_policy, &param);
+        // Real time policies usually require CAP_SYS_NICE (rc is EPERM)
+        CHECK(rc == 0, HAILO_INTERNAL_FAILURE, "pthread_setschedparam failed with {}", rc);
+    }
+
+    if (ThreadPolicy::UNCHANGED_NICE != policy.nice) {
+#if defined(__linux__)
+        // On linux, the nice value is per thread (the "process" is the thread id)
+        const auto thread_id = static_cast<id_t>(syscall(SYS_gettid));
+        int rc = setpriority(PRIO_PROCESS, thread_id, policy.nice);
+        CHECK(rc == 0, HAILO_INTERNAL_FAILURE, "setpriority failed with errno {}", errno);
+#else
+        LOGGER__WARNING("Thread nice level is not supported on this platform, ignoring");
+#endif
+    }
+
+    return HAILO_SUCCESS;
+}
+
 size_t OsUtils::get_page_size()
 {
     static const auto page_size = sysconf(_SC_PAGESIZE);
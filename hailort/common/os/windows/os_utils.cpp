@@ -9,6 +9,7 @@
 
 #include "common/os_utils.hpp"
 #include "common/utils.hpp"
+#include "common/thread_policy.hpp"
 #include "hailo/hailort.h"
 
 #include <windows.h>
@@ -55,7 +56,14 @@ bool OsUtils::is_pid_alive(uint32_t pid)
 
 void OsUtils::set_current_thread_name(const std::string &name)
 {
-    (void)name;
+    auto policy = ThreadPolicyConfig::get_instance().get_policy(name);
+    if (policy) {
+        auto status = set_current_thread_policy(policy.value());
+        if (HAILO_SUCCESS != status) {
+            // Not fatal, the thread keeps running with the default policy
+            LOGGER__WARNING("Failed applying thread policy of {}, status = {}", name, status);
+        }
+    }
 }
 
 hailo_status OsUtils::set_current_thread_affinity(uint8_t cpu_index)
@@ -67,6 +75,42 @@ hailo_status OsUtils::set_current_thread_affinity(uint8_t cpu_index)
     return HAILO_SUCCESS;
 }
 
+hailo_status OsUtils::set_current_thread_policy(const ThreadPolicy &policy)
+{
+    if (!policy.cpus.empty()) {
+        DWORD_PTR affinity_mask = 0;
+        for (const auto cpu : policy.cpus) {
+            CHECK(cpu < (sizeof(DWORD_PTR) * 8), HAILO_INVALID_ARGUMENT, "Invalid cpu index {}", cpu);
+            affinity_mask |= static_cast<DWORD_PTR>(1ULL << cpu);
+        }
+        CHECK(0 != SetThreadAffinityMask(GetCurrentThread(), affinity_mask), HAILO_INTERNAL_FAILURE,
+            "SetThreadAffinityMask failed. LE={}", GetLastError());
+    }
+
+    // Windows has no scheduling policies, real time policies are mapped to the time critical priority and the
+    // nice level to the closest thread priority.
+    int priority = THREAD_PRIORITY_NORMAL;
+    bool should_set_priority = true;
+    if ((ThreadPolicy::SchedulingPolicy::FIFO == policy.scheduling_policy) ||
+        (ThreadPolicy::SchedulingPolicy::RR == policy.scheduling_policy)) {
+        priority = THREAD_PRIORITY_TIME_CRITICAL;
+    } else if (ThreadPolicy::UNCHANGED_NICE != policy.nice) {
+        priority = (policy.nice <= -10) ? THREAD_PRIORITY_HIGHEST :
+            (policy.nice < 0) ? THREAD_PRIORITY_ABOVE_NORMAL :
+            (policy.nice == 0) ? THREAD_PRIORITY_NORMAL :
+            (policy.nice < 10) ? THREAD_PRIORITY_BELOW_NORMAL : THREAD_PRIORITY_LOWEST;
+    } else {
+        should_set_priority = (ThreadPolicy::SchedulingPolicy::OTHER == policy.scheduling_policy);
+    }
+
+    if (should_set_priority) {
+        CHECK(0 != SetThreadPriority(GetCurrentThread(), priority), HAILO_INTERNAL_FAILURE,
+            "SetThreadPriority failed. LE={}", GetLastError());
+    }
+
+    return HAILO_SUCCESS;
+}
+
 static size_t get_page_size_impl()
 {
     SYSTEM_INFO system_info{};
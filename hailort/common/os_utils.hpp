@@ -20,6 +20,8 @@
 namespace hailort
 {
 
+struct ThreadPolicy;
+
 class HailoRTOSLogger final
 {
 public:
@@ -62,8 +64,10 @@ public:
 
     static uint32_t get_curr_pid();
     static bool is_pid_alive(uint32_t pid);
+    // Also applies the thread policy configured for the given name (see common/thread_policy.hpp)
     static void set_current_thread_name(const std::string &name);
     static hailo_status set_current_thread_affinity(uint8_t cpu_index);
+    static hailo_status set_current_thread_policy(const ThreadPolicy &policy);
     static size_t get_page_size();
     static size_t get_dma_able_alignment();
 };
@@ -0,0 +1,234 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file thread_policy.cpp
+ * @brief CPU affinity and scheduling configuration of HailoRT's internal threads.
+ **/
+
+#include "common/thread_policy.hpp"
+#include "common/string_utils.hpp"
+#include "common/utils.hpp"
+
+#include <fstream>
+#include <sstream>
+
+namespace hailort
+{
+
+const int32_t ThreadPolicy::UNCHANGED_NICE;
+
+static const uint32_t MAX_CPU_INDEX = 1023;
+static const int32_t MIN_NICE = -20;
+static const int32_t MAX_NICE = 19;
+static const int32_t MIN_RT_PRIORITY = 1;
+static const int32_t MAX_RT_PRIORITY = 99;
+
+static std::string trim(const std::string &str)
+{
+    static const char *WHITESPACES = " \t\r\n";
+    const auto begin = str.find_first_not_of(WHITESPACES);
+    if (std::string::npos == begin) {
+        return "";
+    }
+    const auto end = str.find_last_not_of(WHITESPACES);
+    return str.substr(begin, end - begin + 1);
+}
+
+static std::vector<std::string> split(const std::string &str, char delimiter)
+{
+    std::vector<std::string> tokens;
+    std::stringstream stream(str);
+    std::string token;
+    while (std::getline(stream, token, delimiter)) {
+        tokens.emplace_back(token);
+    }
+    return tokens;
+}
+
+static Expected<std::vector<uint32_t>> parse_cpus(const std::string &cpus_str)
+{
+    std::vector<uint32_t> cpus;
+    for (const auto &range_str : split(cpus_str, ',')) {
+        const auto dash_pos = range_str.find('-');
+        const auto first_str = (std::string::npos == dash_pos) ? range_str : range_str.substr(0, dash_pos);
+        const auto last_str = (std::string::npos == dash_pos) ? range_str : range_str.substr(dash_pos + 1);
+        TRY(const auto first, StringUtils::to_uint32(first_str, 10));
+        TRY(const auto last, StringUtils::to_uint32(last_str, 10));
+        CHECK_AS_EXPECTED((first <= last) && (last <= MAX_CPU_INDEX), HAILO_INVALID_ARGUMENT,
+            "Invalid cpus range '{}'", range_str);
+        for (auto cpu = first; cpu <= last; cpu++) {
+            cpus.emplace_back(cpu);
+        }
+    }
+    CHECK_AS_EXPECTED(!cpus.empty(), HAILO_INVALID_ARGUMENT, "Empty cpus list");
+    return cpus;
+}
+
+static Expected<ThreadPolicy::SchedulingPolicy> parse_scheduling_policy(const std::string &policy_str)
+{
+    if ("other" == policy_str) {
+        return ThreadPolicy::SchedulingPolicy::OTHER;
+    } else if ("fifo" == policy_str) {
+        return ThreadPolicy::SchedulingPolicy::FIFO;
+    } else if ("rr" == policy_str) {
+        return ThreadPolicy::SchedulingPolicy::RR;
+    }
+    LOGGER__ERROR("Invalid scheduling policy '{}' (expected other, fifo or rr)", policy_str);
+    return make_unexpected(HAILO_INVALID_ARGUMENT);
+}
+
+static Expected<std::pair<std::string, ThreadPolicy>> parse_entry(const std::string &entry)
+{
+    std::stringstream stream(entry);
+    std::string role;
+    stream >> role;
+
+    ThreadPolicy policy{};
+    std::string option;
+    while (stream >> option) {
+        const auto equal_pos = option.find('=');
+        CHECK_AS_EXPECTED(std::string::npos != equal_pos, HAILO_INVALID_ARGUMENT,
+            "Invalid thread policy option '{}' for role {} (expected key=value)", option, role);
+        const auto key = option.substr(0, equal_pos);
+        const auto value = option.substr(equal_pos + 1);
+
+        if ("cpus" == key) {
+            TRY(policy.cpus, parse_cpus(value));
+        } else if ("policy" == key) {
+            TRY(policy.scheduling_policy, parse_scheduling_policy(value));
+        } else if ("priority" == key) {
+            TRY(policy.priority, StringUtils::to_int32(value, 10));
+            CHECK_AS_EXPECTED((MIN_RT_PRIORITY <= policy.priority) && (policy.priority <= MAX_RT_PRIORITY),
+                HAILO_INVALID_ARGUMENT, "Invalid priority {} for role {} (expected {}-{})", policy.priority, role,
+                MIN_RT_PRIORITY, MAX_RT_PRIORITY);
+        } else if ("nice" == key) {
+            TRY(policy.nice, StringUtils::to_int32(value, 10));
+            CHECK_AS_EXPECTED((MIN_NICE <= policy.nice) && (policy.nice <= MAX_NICE), HAILO_INVALID_ARGUMENT,
+                "Invalid nice {} for role {} (expected {}-{})", policy.nice, role, MIN_NICE, MAX_NICE);
+        } else {
+            LOGGER__ERROR("Unknown thread policy option '{}' for role {}", key, role);
+            return make_unexpected(HAILO_INVALID_ARGUMENT);
+        }
+    }
+
+    const bool is_real_time = (ThreadPolicy::SchedulingPolicy::FIFO == policy.scheduling_policy) ||
+        (ThreadPolicy::SchedulingPolicy::RR == policy.scheduling_policy);
+    CHECK_AS_EXPECTED(is_real_time || (0 == policy.priority), HAILO_INVALID_ARGUMENT,
+        "priority is valid only with policy=fifo or policy=rr (role {})", role);
+    if (is_real_time && (0 == policy.priority)) {
+        policy.priority = MIN_RT_PRIORITY;
+    }
+
+    return std::make_pair(role, policy);
+}
+
+Expected<std::map<std::string, ThreadPolicy>> ThreadPolicyConfig::parse(const std::string &config)
+{
+    std::map<std::string, ThreadPolicy> policies;
+    for (const auto &line : split(config, '\n')) {
+        const auto trimmed_line = trim(line);
+        if (trimmed_line.empty() || ('#' == trimmed_line[0])) {
+            continue;
+        }
+
+        for (const auto &entry : split(trimmed_line, ';')) {
+            if (trim(entry).empty()) {
+                continue;
+            }
+            TRY(auto role_and_policy, parse_entry(entry));
+            policies[role_and_policy.first] = role_and_policy.second;
+        }
+    }
+    return policies;
+}
+
+static Expected<std::string> read_config_from_env()
+{
+    auto config = get_env_variable(HAILO_THREAD_POLICY_ENV_VAR);
+    if (config) {
+        return config.release();
+    }
+
+    auto config_path = get_env_variable(HAILO_THREAD_POLICY_FILE_ENV_VAR);
+    if (!config_path) {
+        // No configuration, not an error
+        return make_unexpected(HAILO_NOT_FOUND);
+    }
+
+    std::ifstream config_file(config_path.value());
+    CHECK_AS_EXPECTED(config_file.is_open(), HAILO_OPEN_FILE_FAILURE, "Failed opening thread policy file {}",
+        config_path.value());
+    std::stringstream config_stream;
+    config_stream << config_file.rdbuf();
+    return config_stream.str();
+}
+
+ThreadPolicyConfig::ThreadPolicyConfig()
+{
+    auto config = read_config_from_env();
+    if (!config) {
+        return;
+    }
+
+    // A bad configuration is not a reason to fail the threads, it is just ignored
+    auto policies = parse(config.value());
+    if (!policies) {
+        LOGGER__WARNING("Ignoring invalid thread policy configuration, status = {}", policies.status());
+        return;
+    }
+    m_env_policies = policies.release();
+    m_policies = m_env_policies;
+}
+
+ThreadPolicyConfig &ThreadPolicyConfig::get_instance()
+{
+    static ThreadPolicyConfig instance;
+    return instance;
+}
+
+hailo_status ThreadPolicyConfig::set(const std::string &config)
+{
+    TRY(auto policies, parse(config));
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_policies = m_env_policies;
+    for (auto &role_and_policy : policies) {
+        m_policies[role_and_policy.first] = role_and_policy.second;
+    }
+    return HAILO_SUCCESS;
+}
+
+Expected<ThreadPolicy> ThreadPolicyConfig::get_policy(const std::string &role)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto exact_match = m_policies.find(role);
+    if (m_policies.end() != exact_match) {
+        return Expected<ThreadPolicy>(exact_match->second);
+    }
+
+    // Look for the longest matching prefix
+    const ThreadPolicy *best_match = nullptr;
+    size_t best_match_length = 0;
+    for (const auto &role_and_policy : m_policies) {
+        const auto &pattern = role_and_policy.first;
+        if (pattern.empty() || ('*' != pattern.back())) {
+            continue;
+        }
+        const auto prefix_length = pattern.size() - 1;
+        if ((0 == role.compare(0, prefix_length, pattern, 0, prefix_length)) &&
+            ((nullptr == best_match) || (prefix_length > best_match_length))) {
+            best_match = &role_and_policy.second;
+            best_match_length = prefix_length;
+        }
+    }
+
+    if (nullptr == best_match) {
+        return make_unexpected(HAILO_NOT_FOUND);
+    }
+    return Expected<ThreadPolicy>(*best_match);
+}
+
+} /* namespace hailort */
@@ -0,0 +1,89 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file thread_policy.hpp
+ * @brief CPU affinity and scheduling configuration of HailoRT's internal threads.
+ *
+ * Each internal thread has a role - the name it passes to OsUtils::set_current_thread_name (e.g. "CHANNEL_INTR",
+ * "SCHEDULER", "VDMA_COMPLETE"). A policy configuration maps roles to a CPU set, a scheduling policy and a nice
+ * level, which are applied by the thread itself when it sets its name.
+ *
+ * The configuration is a list of entries separated by ';' or new lines, each entry is a role followed by
+ * whitespace separated options:
+ *     CHANNEL_INTR cpus=2 policy=fifo priority=50; VDMA_COMPLETE cpus=3,4; * cpus=0-1 nice=5
+ * Options:
+ *     cpus=<list>        CPU indices and ranges, e.g. 0,2-3
+ *     policy=<name>      other, fifo or rr
+ *     priority=<1-99>    Real-time priority (for fifo and rr)
+ *     nice=<-20-19>      Nice level (for other)
+ * A role ending with '*' matches every role starting with the given prefix ("*" matches all threads). The most
+ * specific entry is used. Lines starting with '#' are ignored.
+ *
+ * The configuration is read from HAILO_THREAD_POLICY, or from the file pointed by HAILO_THREAD_POLICY_FILE, and
+ * can be extended for the whole process by hailo_set_thread_policy().
+ **/
+
+#ifndef _HAILO_THREAD_POLICY_HPP_
+#define _HAILO_THREAD_POLICY_HPP_
+
+#include "hailo/expected.hpp"
+
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+
+namespace hailort
+{
+
+#define HAILO_THREAD_POLICY_ENV_VAR ("HAILO_THREAD_POLICY")
+#define HAILO_THREAD_POLICY_FILE_ENV_VAR ("HAILO_THREAD_POLICY_FILE")
+
+struct ThreadPolicy
+{
+    enum class SchedulingPolicy {
+        UNCHANGED,
+        OTHER,
+        FIFO,
+        RR
+    };
+
+    static const int32_t UNCHANGED_NICE = INT32_MAX;
+
+    // Empty means the affinity is not changed
+    std::vector<uint32_t> cpus;
+    SchedulingPolicy scheduling_policy = SchedulingPolicy::UNCHANGED;
+    // Real time priority, used with SchedulingPolicy::FIFO or SchedulingPolicy::RR
+    int32_t priority = 0;
+    int32_t nice = UNCHANGED_NICE;
+};
+
+class ThreadPolicyConfig final
+{
+public:
+    static ThreadPolicyConfig &get_instance();
+
+    // Parses a configuration (see above) to a map of role to policy.
+    static Expected<std::map<std::string, ThreadPolicy>> parse(const std::string &config);
+
+    // Sets the configuration given by the application, on top of the one given by the environment variables (so an
+    // empty configuration leaves only the environment's). Affects only threads that set their name afterwards.
+    hailo_status set(const std::string &config);
+
+    // Returns the policy of the given role, HAILO_NOT_FOUND if no entry matches it.
+    Expected<ThreadPolicy> get_policy(const std::string &role);
+
+private:
+    ThreadPolicyConfig();
+
+    std::mutex m_mutex;
+    std::map<std::string, ThreadPolicy> m_env_policies;
+    // The environment's policies, overridden by the application's
+    std::map<std::string, ThreadPolicy> m_policies;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_THREAD_POLICY_HPP_ */
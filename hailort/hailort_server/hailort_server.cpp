@@ -97,6 +97,7 @@ void hrpc::HailoRTServer::cleanup_cim_buffer_pools(const std::vector<uint32_t> &
 
 hailo_status hrpc::HailoRTServer::cleanup_client_resources(RpcConnection client_connection)
 {
+    std::unique_lock<std::mutex> lock(m_resources_mutex);
     std::set<uint32_t> pids = {SINGLE_CLIENT_PID};
     auto cim_handles = ServiceResourceManager<ConfiguredInferModel>::get_instance().resources_handles_by_pids(pids);
     (void)ServiceResourceManager<ConfiguredInferModel>::get_instance().release_by_pid(SINGLE_CLIENT_PID);
@@ -121,10 +122,27 @@ Expected<std::unique_ptr<hrpc::HailoRTServer>> hrpc::HailoRTServer::create_uniqu
     return res;
 }
 
-int main()
+Expected<std::unique_ptr<hrpc::HailoRTServer>> hrpc::HailoRTServer::create_unique(const std::string &address)
+{
+    TRY(auto connection_context, ConnectionContext::create_shared(true, address));
+    auto res = make_unique_nothrow<HailoRTServer>(connection_context);
+    CHECK_NOT_NULL(res, HAILO_OUT_OF_HOST_MEMORY);
+    return res;
+}
+
+int main(int argc, char **argv)
 {
     init_logger("HailoRT-Server");
-    TRY(auto server, hrpc::HailoRTServer::create_unique());
+
+    // The server listens on the given address ("unix:<path>", "tcp:[<host>:]<port>" or "vsock:<cid>:<port>"),
+    // so clients on other hosts or VMs can connect to it by setting HAILO_HRPC_ADDRESS.
+    // A TCP address without a host listens on the loopback interface. Connections are not authenticated.
+    std::unique_ptr<hrpc::HailoRTServer> server;
+    if (argc > 1) {
+        TRY(server, hrpc::HailoRTServer::create_unique(argv[1]));
+    } else {
+        TRY(server, hrpc::HailoRTServer::create_unique());
+    }
     hrpc::Dispatcher dispatcher;
 
     // TODO: add a server implementation class, with resources heiracrhy and more
@@ -134,6 +152,7 @@ int main()
     // Because the infer model is created with a hef buffer, we need to keep the buffer until the configure stage.
     // Here I keep it until the infer model is destroyed
     auto &hef_buffers = server->get_hef_buffers();
+    auto &resources_mutex = server->get_resources_mutex();
 
     dispatcher.register_action(HailoRpcActionID::VDEVICE__CREATE,
     [] (const MemoryView &request, hrpc::ServerContextPtr /*server_context*/) -> Expected<Buffer> {
@@ -154,7 +173,7 @@ int main()
         return reply;
     });
     dispatcher.register_action(HailoRpcActionID::VDEVICE__CREATE_INFER_MODEL,
-    [&hef_buffers] (const MemoryView &request, hrpc::ServerContextPtr server_context) -> Expected<Buffer> {
+    [&hef_buffers, &resources_mutex] (const MemoryView &request, hrpc::ServerContextPtr server_context) -> Expected<Buffer> {
         TRY_AS_HRPC_STATUS(auto tuple, CreateInferModelSerializer::deserialize_request(request), CreateInferModelSerializer);
         auto vdevice_handle = std::get<0>(tuple);
         uint64_t hef_size = std::get<1>(tuple);
@@ -174,22 +193,28 @@ int main()
 
         auto &infer_model_manager = ServiceResourceManager<InferModel>::get_instance();
         auto infer_model_id = infer_model_manager.register_resource(SINGLE_CLIENT_PID, std::move(infer_model.release()));
-        hef_buffers.emplace(infer_model_id, std::move(hef_buffer));
+        {
+            std::unique_lock<std::mutex> lock(resources_mutex);
+            hef_buffers.emplace(infer_model_id, std::move(hef_buffer));
+        }
 
         TRY_AS_HRPC_STATUS(auto reply, CreateInferModelSerializer::serialize_reply(HAILO_SUCCESS, infer_model_id), CreateInferModelSerializer);
         return reply;
     });
     dispatcher.register_action(HailoRpcActionID::INFER_MODEL__DESTROY,
-    [&hef_buffers] (const MemoryView &request, hrpc::ServerContextPtr /*server_context*/) -> Expected<Buffer> {
+    [&hef_buffers, &resources_mutex] (const MemoryView &request, hrpc::ServerContextPtr /*server_context*/) -> Expected<Buffer> {
         auto &manager = ServiceResourceManager<InferModel>::get_instance();
         TRY_AS_HRPC_STATUS(auto infer_model_handle, DestroyInferModelSerializer::deserialize_request(request), DestroyInferModelSerializer);
-        hef_buffers.erase(infer_model_handle);
+        {
+            std::unique_lock<std::mutex> lock(resources_mutex);
+            hef_buffers.erase(infer_model_handle);
+        }
         (void)manager.release_resource(infer_model_handle, SINGLE_CLIENT_PID);
         TRY_AS_HRPC_STATUS(auto reply, DestroyInferModelSerializer::serialize_reply(HAILO_SUCCESS), DestroyInferModelSerializer);
         return reply;
     });
     dispatcher.register_action(HailoRpcActionID::INFER_MODEL__CREATE_CONFIGURED_INFER_MODEL,
-    [&buffer_pool_per_cim, &infer_model_to_info_id]
+    [&buffer_pool_per_cim, &infer_model_to_info_id, &resources_mutex]
     (const MemoryView &request, hrpc::ServerContextPtr /*server_context*/) -> Expected<Buffer> {
         auto &infer_model_manager = ServiceResourceManager<InferModel>::get_instance();
 
@@ -292,16 +317,18 @@ int main()
                 infer_model_info->output_streams_sizes[output_name], BUFFER_POOL_SIZE);
             CHECK_SUCCESS_AS_HRPC_STATUS(status, CreateConfiguredInferModelSerializer);
         }
-        buffer_pool_per_cim.emplace(cim_id, buffer_pool_ptr);
-
-        infer_model_to_info_id[infer_model_handle] = infer_model_info_id;
+        {
+            std::unique_lock<std::mutex> lock(resources_mutex);
+            buffer_pool_per_cim.emplace(cim_id, buffer_pool_ptr);
+            infer_model_to_info_id[infer_model_handle] = infer_model_info_id;
+        }
         TRY_AS_HRPC_STATUS(auto reply,
             CreateConfiguredInferModelSerializer::serialize_reply(HAILO_SUCCESS, cim_id, static_cast<uint32_t>(async_queue_size)),
             CreateConfiguredInferModelSerializer);
         return reply;
     });
     dispatcher.register_action(HailoRpcActionID::CONFIGURED_INFER_MODEL__DESTROY,
-    [&buffer_pool_per_cim] (const MemoryView &request, hrpc::ServerContextPtr /*server_context*/) -> Expected<Buffer> {
+    [&buffer_pool_per_cim, &resources_mutex] (const MemoryView &request, hrpc::ServerContextPtr /*server_context*/) -> Expected<Buffer> {
         auto &manager = ServiceResourceManager<ConfiguredInferModel>::get_instance();
         TRY_AS_HRPC_STATUS(auto configured_infer_model_handle, DestroyConfiguredInferModelSerializer::deserialize_request(request), DestroyInferModelSerializer);
 
@@ -310,7 +337,10 @@ int main()
             return HAILO_SUCCESS;
         };
         manager.execute<hailo_status>(configured_infer_model_handle, shutdown_lambda);
-        buffer_pool_per_cim.erase(configured_infer_model_handle);
+        {
+            std::unique_lock<std::mutex> lock(resources_mutex);
+            buffer_pool_per_cim.erase(configured_infer_model_handle);
+        }
         (void)manager.release_resource(configured_infer_model_handle, SINGLE_CLIENT_PID);
         TRY_AS_HRPC_STATUS(auto reply, DestroyConfiguredInferModelSerializer::serialize_reply(HAILO_SUCCESS), DestroyInferModelSerializer);
         return reply;
@@ -365,17 +395,16 @@ int main()
         CHECK_EXPECTED_AS_HRPC_STATUS(configured_infer_model_handle, GetHwLatencyMeasurementSerializer);
 
         auto lambda = [] (std::shared_ptr<ConfiguredInferModel> configured_infer_model) {
-            return configured_infer_model->get_hw_latency_measurement();
+            return configured_infer_model->get_hw_latency_measurement_ext();
         };
 
-        auto latency_measurement_result = cim_manager.execute<Expected<LatencyMeasurementResult>>(configured_infer_model_handle.value(), lambda);
+        auto latency_measurement_result = cim_manager.execute<Expected<LatencyMeasurementResultExt>>(configured_infer_model_handle.value(), lambda);
         if (HAILO_NOT_AVAILABLE ==  latency_measurement_result.status()) {
             return GetHwLatencyMeasurementSerializer::serialize_reply(HAILO_NOT_AVAILABLE);
         }
         CHECK_EXPECTED_AS_HRPC_STATUS(latency_measurement_result, GetHwLatencyMeasurementSerializer);
 
-        uint32_t avg_hw_latency = static_cast<uint32_t>(latency_measurement_result.value().avg_hw_latency.count());
-        TRY_AS_HRPC_STATUS(auto reply, GetHwLatencyMeasurementSerializer::serialize_reply(latency_measurement_result.status(), avg_hw_latency), GetHwLatencyMeasurementSerializer);
+        TRY_AS_HRPC_STATUS(auto reply, GetHwLatencyMeasurementSerializer::serialize_reply(latency_measurement_result.status(), latency_measurement_result.value()), GetHwLatencyMeasurementSerializer);
 
         return reply;
     });
@@ -428,7 +457,7 @@ int main()
         return reply;
     });
     dispatcher.register_action(HailoRpcActionID::CONFIGURED_INFER_MODEL__RUN_ASYNC,
-    [&infer_model_to_info_id, &buffer_pool_per_cim]
+    [&infer_model_to_info_id, &buffer_pool_per_cim, &resources_mutex]
     (const MemoryView &request, hrpc::ServerContextPtr server_context) -> Expected<Buffer> {
         auto &cim_manager = ServiceResourceManager<ConfiguredInferModel>::get_instance();
         auto bindings_lambda = [] (std::shared_ptr<ConfiguredInferModel> configured_infer_model) {
@@ -442,61 +471,77 @@ int main()
         auto bindings = cim_manager.execute<Expected<ConfiguredInferModel::Bindings>>(configured_infer_model_handle, bindings_lambda);
         CHECK_EXPECTED_AS_HRPC_STATUS(bindings, RunAsyncSerializer);
 
+        std::shared_ptr<ServiceNetworkGroupBufferPool> buffer_pool;
+        uint32_t infer_model_info_id = 0;
+        {
+            std::unique_lock<std::mutex> lock(resources_mutex);
+            auto buffer_pool_iter = buffer_pool_per_cim.find(configured_infer_model_handle);
+            auto info_id_iter = infer_model_to_info_id.find(infer_model_handle);
+            auto status = ((buffer_pool_per_cim.end() != buffer_pool_iter) && (infer_model_to_info_id.end() != info_id_iter)) ?
+                HAILO_SUCCESS : HAILO_NOT_FOUND;
+            CHECK_SUCCESS_AS_HRPC_STATUS(status, RunAsyncSerializer);
+            buffer_pool = buffer_pool_iter->second;
+            infer_model_info_id = info_id_iter->second;
+        }
+
         auto infer_model_info_lambda = [] (std::shared_ptr<InferModelInfo> infer_model_info) {
             return *infer_model_info;
         };
         auto &infer_model_infos_manager = ServiceResourceManager<InferModelInfo>::get_instance();
-        auto infer_model_info = infer_model_infos_manager.execute<Expected<InferModelInfo>>(infer_model_to_info_id[infer_model_handle],
+        auto infer_model_info = infer_model_infos_manager.execute<Expected<InferModelInfo>>(infer_model_info_id,
             infer_model_info_lambda);
         CHECK_EXPECTED_AS_HRPC_STATUS(infer_model_info, RunAsyncSerializer);
 
         std::vector<BufferPtr> inputs; // TODO: add infer vector pool
+        std::vector<MemoryView> input_views;
         inputs.reserve(infer_model_info->inputs_names.size());
+        input_views.reserve(infer_model_info->inputs_names.size());
         for (const auto &input_name : infer_model_info->inputs_names) {
             TRY_AS_HRPC_STATUS(auto input, bindings->input(input_name), RunAsyncSerializer);
 
-            TRY_AS_HRPC_STATUS(auto buffer_ptr, buffer_pool_per_cim[configured_infer_model_handle]->acquire_buffer(input_name),
+            TRY_AS_HRPC_STATUS(auto buffer_ptr, buffer_pool->acquire_buffer(input_name),
                 RunAsyncSerializer);
 
-            auto status = server_context->connection().read_buffer(MemoryView(*buffer_ptr));
-            CHECK_SUCCESS_AS_HRPC_STATUS(status, RunAsyncSerializer);
-
             inputs.emplace_back(buffer_ptr);
-            status = input.set_buffer(MemoryView(*buffer_ptr));
+            input_views.emplace_back(*buffer_ptr);
+            auto status = input.set_buffer(MemoryView(*buffer_ptr));
             CHECK_SUCCESS_AS_HRPC_STATUS(status, RunAsyncSerializer);
         }
 
+        // All of the inputs are read at once
+        auto status = server_context->connection().read_buffers(input_views);
+        CHECK_SUCCESS_AS_HRPC_STATUS(status, RunAsyncSerializer);
+
         std::vector<BufferPtr> outputs; // TODO: add infer vector pool
+        std::vector<MemoryView> output_views;
         outputs.reserve(infer_model_info->outputs_names.size());
+        output_views.reserve(infer_model_info->outputs_names.size());
         for (const auto &output_name : infer_model_info->outputs_names) {
-            TRY_AS_HRPC_STATUS(auto buffer_ptr, buffer_pool_per_cim[configured_infer_model_handle]->acquire_buffer(output_name),
+            TRY_AS_HRPC_STATUS(auto buffer_ptr, buffer_pool->acquire_buffer(output_name),
                 RunAsyncSerializer);
 
             auto output = bindings->output(output_name);
             CHECK_EXPECTED_AS_HRPC_STATUS(output, RunAsyncSerializer);
 
-            auto status = output->set_buffer(MemoryView(buffer_ptr->data(), buffer_ptr->size()));
+            status = output->set_buffer(MemoryView(buffer_ptr->data(), buffer_ptr->size()));
             CHECK_SUCCESS_AS_HRPC_STATUS(status, RunAsyncSerializer);
 
             outputs.emplace_back(buffer_ptr);
+            output_views.emplace_back(*buffer_ptr);
         }
 
         auto infer_lambda =
-            [bindings = bindings.release(), callback_id, server_context, inputs, outputs, &buffer_pool_per_cim, configured_infer_model_handle,
-                infer_model_info]
+            [bindings = bindings.release(), callback_id, server_context, inputs, outputs, output_views, buffer_pool,
+                configured_infer_model_handle, infer_model_info]
             (std::shared_ptr<ConfiguredInferModel> configured_infer_model) {
                 return configured_infer_model->run_async(bindings,
-                    [callback_id, server_context, inputs, outputs, &buffer_pool_per_cim, configured_infer_model_handle, infer_model_info]
+                    [callback_id, server_context, inputs, outputs, output_views, buffer_pool, configured_infer_model_handle,
+                        infer_model_info]
                         (const AsyncInferCompletionInfo &completion_info) {
-                    auto status = server_context->trigger_callback(callback_id, completion_info.status, [outputs, completion_info] (hrpc::RpcConnection connection) -> hailo_status {
-                        if (HAILO_SUCCESS == completion_info.status) {
-                            for (auto output : outputs) {
-                                auto status = connection.write_buffer(MemoryView(*output));
-                                CHECK_SUCCESS(status);
-                            }
-                        }
-                        return HAILO_SUCCESS;
-                    });
+                    // The outputs are sent together with the reply, only if the inference succeeded
+                    auto status = (HAILO_SUCCESS == completion_info.status) ?
+                        server_context->trigger_callback(configured_infer_model_handle, callback_id, completion_info.status, output_views) :
+                        server_context->trigger_callback(configured_infer_model_handle, callback_id, completion_info.status);
 
                     // HAILO_COMMUNICATION_CLOSED means the client disconnected. Server doesn't need to restart in this case.
                     if ((status != HAILO_SUCCESS) && (status != HAILO_COMMUNICATION_CLOSED)) {
@@ -504,14 +549,14 @@ int main()
                     }
 
                     for (uint32_t i = 0; i < inputs.size(); i++) {
-                        status = buffer_pool_per_cim[configured_infer_model_handle]->return_to_pool(infer_model_info->inputs_names[i], inputs[i]);
+                        status = buffer_pool->return_to_pool(infer_model_info->inputs_names[i], inputs[i]);
                         if (status != HAILO_SUCCESS) {
                             LOGGER__CRITICAL("return_to_pool failed for input {}, status = {}. Server should restart!", infer_model_info->inputs_names[i], status);
                             return;
                         }
                     }
                     for (uint32_t i = 0; i < outputs.size(); i++) {
-                        status = buffer_pool_per_cim[configured_infer_model_handle]->return_to_pool(infer_model_info->outputs_names[i], outputs[i]);
+                        status = buffer_pool->return_to_pool(infer_model_info->outputs_names[i], outputs[i]);
                         if (status != HAILO_SUCCESS) {
                             LOGGER__CRITICAL("return_to_pool failed for output {}, status = {}. Server should restart!", infer_model_info->outputs_names[i], status);
                             return;
@@ -22,17 +22,21 @@ class Server;
 class HailoRTServer : public Server {
 public:
     static Expected<std::unique_ptr<HailoRTServer>> create_unique();
+    static Expected<std::unique_ptr<HailoRTServer>> create_unique(const std::string &address);
     explicit HailoRTServer(std::shared_ptr<ConnectionContext> connection_context) : Server(connection_context) {};
 
     std::unordered_map<uint32_t, uint32_t> &get_infer_model_to_info_id() { return m_infer_model_to_info_id; };
     std::unordered_map<uint32_t, std::shared_ptr<ServiceNetworkGroupBufferPool>> &get_buffer_pool_per_cim() { return m_buffer_pool_per_cim; };
     std::unordered_map<infer_model_handle_t, Buffer> &get_hef_buffers() { return m_hef_buffers_per_infer_model; };
+    // Guards the maps above, as the client's connections are served by different threads
+    std::mutex &get_resources_mutex() { return m_resources_mutex; };
 
 private:
 
     std::unordered_map<uint32_t, uint32_t> m_infer_model_to_info_id;
     std::unordered_map<uint32_t, std::shared_ptr<ServiceNetworkGroupBufferPool>> m_buffer_pool_per_cim;
     std::unordered_map<infer_model_handle_t, Buffer> m_hef_buffers_per_infer_model;
+    std::mutex m_resources_mutex;
     virtual hailo_status cleanup_client_resources(RpcConnection client_connection) override;
     void cleanup_cim_buffer_pools(const std::vector<uint32_t> &cim_handles);
     void cleanup_infer_model_hef_buffers(const std::vector<uint32_t> &infer_model_handles);
@@ -1632,16 +1632,22 @@ grpc::Status HailoRtRpcService::ConfiguredNetworkGroup_get_latency_measurement(g
     ConfiguredNetworkGroup_get_latency_measurement_Reply *reply)
 {
     auto lambda = [](std::shared_ptr<ConfiguredNetworkGroup> cng, const std::string &network_name) {
-        return cng->get_latency_measurement(network_name);
+        return cng->get_latency_measurement_ext(network_name);
     };
     auto &manager = ServiceResourceManager<ConfiguredNetworkGroup>::get_instance();
-    auto expected_latency_result = manager.execute<Expected<LatencyMeasurementResult>>(
+    auto expected_latency_result = manager.execute<Expected<LatencyMeasurementResultExt>>(
         request->identifier().network_group_handle(), lambda, request->network_name());
     if (HAILO_NOT_AVAILABLE == expected_latency_result.status()) {
         reply->set_status(static_cast<uint32_t>(HAILO_NOT_AVAILABLE));
     } else {
         CHECK_EXPECTED_AS_RPC_STATUS(expected_latency_result, reply);
-        reply->set_avg_hw_latency(static_cast<uint32_t>(expected_latency_result.value().avg_hw_latency.count()));
+        const auto &latency_result = expected_latency_result.value();
+        reply->set_avg_hw_latency(static_cast<uint32_t>(latency_result.avg_hw_latency.count()));
+        reply->set_p50_hw_latency(static_cast<uint32_t>(latency_result.p50_hw_latency.count()));
+        reply->set_p95_hw_latency(static_cast<uint32_t>(latency_result.p95_hw_latency.count()));
+        reply->set_p99_hw_latency(static_cast<uint32_t>(latency_result.p99_hw_latency.count()));
+        reply->set_max_hw_latency(static_cast<uint32_t>(latency_result.max_hw_latency.count()));
+        reply->set_measured_frames_count(latency_result.measured_frames_count);
         reply->set_status(static_cast<uint32_t>(HAILO_SUCCESS));
     }
     return grpc::Status::OK;
@@ -55,6 +55,26 @@ Expected<double> NetworkLiveTrack::get_last_measured_fps()
     return Expected<double>(m_last_measured_fps);
 }
 
+static std::string format_hw_latency(const LatencyMeasurementResultExt &hw_latency)
+{
+    return fmt::format("{:.2f} ms (p50 {:.2f} p95 {:.2f} p99 {:.2f} max {:.2f})",
+        InferStatsPrinter::latency_result_to_ms(hw_latency.avg_hw_latency),
+        InferStatsPrinter::latency_result_to_ms(hw_latency.p50_hw_latency),
+        InferStatsPrinter::latency_result_to_ms(hw_latency.p95_hw_latency),
+        InferStatsPrinter::latency_result_to_ms(hw_latency.p99_hw_latency),
+        InferStatsPrinter::latency_result_to_ms(hw_latency.max_hw_latency));
+}
+
+static void add_hw_latency_to_json(nlohmann::ordered_json &json, const LatencyMeasurementResultExt &hw_latency)
+{
+    json["hw_latency"] = InferStatsPrinter::latency_result_to_ms(hw_latency.avg_hw_latency);
+    json["hw_latency_p50"] = InferStatsPrinter::latency_result_to_ms(hw_latency.p50_hw_latency);
+    json["hw_latency_p95"] = InferStatsPrinter::latency_result_to_ms(hw_latency.p95_hw_latency);
+    json["hw_latency_p99"] = InferStatsPrinter::latency_result_to_ms(hw_latency.p99_hw_latency);
+    json["hw_latency_max"] = InferStatsPrinter::latency_result_to_ms(hw_latency.max_hw_latency);
+    json["hw_latency_frames_count"] = hw_latency.measured_frames_count;
+}
+
 uint32_t NetworkLiveTrack::push_text_impl(std::stringstream &ss)
 {
     ss << fmt::format("{}:", m_name);
@@ -73,17 +93,17 @@ uint32_t NetworkLiveTrack::push_text_impl(std::stringstream &ss)
     }
 
     if (m_cng) {
-        auto hw_latency_measurement = m_cng->get_latency_measurement();
+        auto hw_latency_measurement = m_cng->get_latency_measurement_ext();
         if (hw_latency_measurement) {
-            ss << fmt::format("{}hw latency: {:.2f} ms", get_separator(), InferStatsPrinter::latency_result_to_ms(hw_latency_measurement->avg_hw_latency));
+            ss << fmt::format("{}hw latency: {}", get_separator(), format_hw_latency(hw_latency_measurement.value()));
         } else if (HAILO_NOT_AVAILABLE != hw_latency_measurement.status()) { // HAILO_NOT_AVAILABLE is a valid error, we ignore it
             ss << fmt::format("{}hw latency: NaN (err)", get_separator());
         }
     }
     else {
-        auto hw_latency_measurement = m_configured_infer_model->get_hw_latency_measurement();
+        auto hw_latency_measurement = m_configured_infer_model->get_hw_latency_measurement_ext();
         if (hw_latency_measurement) {
-            ss << fmt::format("{}hw latency: {:.2f} ms", get_separator(), InferStatsPrinter::latency_result_to_ms(hw_latency_measurement->avg_hw_latency));
+            ss << fmt::format("{}hw latency: {}", get_separator(), format_hw_latency(hw_latency_measurement.value()));
         }
         else if (HAILO_NOT_AVAILABLE != hw_latency_measurement.status()) { // HAILO_NOT_AVAILABLE is a valid error, we ignore it
             ss << fmt::format("{}hw latency: NaN (err)", get_separator());
@@ -125,15 +145,15 @@ void NetworkLiveTrack::push_json_impl(nlohmann::ordered_json &json)
     }
 
     if (m_cng) {
-        auto hw_latency_measurement = m_cng->get_latency_measurement();
+        auto hw_latency_measurement = m_cng->get_latency_measurement_ext();
         if (hw_latency_measurement){
-            network_group_json["hw_latency"] = InferStatsPrinter::latency_result_to_ms(hw_latency_measurement->avg_hw_latency);
+            add_hw_latency_to_json(network_group_json, hw_latency_measurement.value());
         }
     }
     else {
-        auto hw_latency_measurement = m_configured_infer_model->get_hw_latency_measurement();
+        auto hw_latency_measurement = m_configured_infer_model->get_hw_latency_measurement_ext();
         if (hw_latency_measurement){
-            network_group_json["hw_latency"] = InferStatsPrinter::latency_result_to_ms(hw_latency_measurement->avg_hw_latency);
+            add_hw_latency_to_json(network_group_json, hw_latency_measurement.value());
         }
     }
 
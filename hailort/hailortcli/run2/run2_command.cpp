@@ -184,7 +184,9 @@ VStreamApp::VStreamApp(const std::string &description, const std::string &name,
             { "auto", HAILO_FORMAT_TYPE_AUTO },
             { "uint8", HAILO_FORMAT_TYPE_UINT8 },
             { "uint16", HAILO_FORMAT_TYPE_UINT16 },
-            { "float32", HAILO_FORMAT_TYPE_FLOAT32 }
+            { "float32", HAILO_FORMAT_TYPE_FLOAT32 },
+            { "float16", HAILO_FORMAT_TYPE_FLOAT16 },
+            { "bfloat16", HAILO_FORMAT_TYPE_BFLOAT16 }
         }))
         ->default_val("auto");
 
@@ -188,7 +188,9 @@ static void add_run_command_params(CLI::App *run_subcommand, inference_runner_pa
             { "auto", HAILO_FORMAT_TYPE_AUTO },
             { "uint8", HAILO_FORMAT_TYPE_UINT8 },
             { "uint16", HAILO_FORMAT_TYPE_UINT16 },
-            { "float32", HAILO_FORMAT_TYPE_FLOAT32 }
+            { "float32", HAILO_FORMAT_TYPE_FLOAT32 },
+            { "float16", HAILO_FORMAT_TYPE_FLOAT16 },
+            { "bfloat16", HAILO_FORMAT_TYPE_BFLOAT16 }
         }))
         ->default_val("auto");
 
@@ -322,6 +324,10 @@ std::string format_type_to_string(hailo_format_type_t format_type) {
         return "uint16";
     case HAILO_FORMAT_TYPE_FLOAT32:
         return "float32";
+    case HAILO_FORMAT_TYPE_FLOAT16:
+        return "float16";
+    case HAILO_FORMAT_TYPE_BFLOAT16:
+        return "bfloat16";
     default:
         return "<INVALID_TYPE>";
     }
@@ -449,7 +455,7 @@ Expected<std::map<std::string, std::vector<InputVStream>>> create_input_vstreams
     std::map<std::string, std::vector<InputVStream>> res;
     TRY(const auto network_infos, configured_net_group.get_network_infos());
     for (const auto &network_info : network_infos) {
-        auto quantized = (params.transform.format_type != HAILO_FORMAT_TYPE_FLOAT32);
+        auto quantized = !HailoRTCommon::is_float_format_type(params.transform.format_type);
         TRY(auto input_vstreams_params, configured_net_group.make_input_vstream_params(quantized,
             params.transform.format_type, HAILORTCLI_DEFAULT_VSTREAM_TIMEOUT_MS, HAILO_DEFAULT_VSTREAM_QUEUE_SIZE, network_info.name));
 
@@ -469,13 +475,13 @@ Expected<std::map<std::string, std::vector<OutputVStream>>> create_output_vstrea
     std::map<std::string, std::vector<OutputVStream>> res;
     TRY(const auto network_infos, configured_net_group.get_network_infos());
     for (const auto &network_info : network_infos) {
-        // Data is not quantized if format_type is explicitly float32, or if an output is NMS (which also enforces float32 output)
+        // Data is not quantized if format_type is explicitly a float type, or if an output is NMS (which also enforces float32 output)
         // We don't cover a case of multiple outputs where only some of them are NMS (no such model currently), and anyway it is handled in run2
         TRY(const auto vstream_infos, configured_net_group.get_output_vstream_infos());
         auto nms_output = std::any_of(vstream_infos.begin(), vstream_infos.end(), [] (const hailo_vstream_info_t &output_info) {
             return HailoRTCommon::is_nms(output_info);
         });
-        auto quantized = ((params.transform.format_type != HAILO_FORMAT_TYPE_FLOAT32) && !nms_output);
+        auto quantized = (!HailoRTCommon::is_float_format_type(params.transform.format_type) && !nms_output);
         TRY(auto output_vstreams_params, configured_net_group.make_output_vstream_params(quantized,
             params.transform.format_type, HAILORTCLI_DEFAULT_VSTREAM_TIMEOUT_MS, HAILO_DEFAULT_VSTREAM_QUEUE_SIZE, network_info.name));
 
@@ -8,18 +8,27 @@
  **/
 
 #include "client.hpp"
+#include "common/string_utils.hpp"
+#include "common/os_utils.hpp"
+
+#include <algorithm>
 
 using namespace hrpc;
 
-Expected<std::shared_ptr<ResultEvent>> ResultEvent::create_shared()
+// Unclaimed buffers are read in chunks of this size
+static const uint64_t DISCARD_BUFFER_SIZE = 64 * 1024;
+
+Expected<std::shared_ptr<ResultEvent>> ResultEvent::create_shared(MemoryView reply_buffer)
 {
     TRY(auto event, hailort::Event::create_shared(hailort::Event::State::not_signalled));
-    auto ptr = make_shared_nothrow<ResultEvent>(event);
+    auto ptr = make_shared_nothrow<ResultEvent>(event, reply_buffer);
     CHECK_NOT_NULL(ptr, HAILO_OUT_OF_HOST_MEMORY);
     return ptr;
 }
 
-ResultEvent::ResultEvent(EventPtr event) :
+ResultEvent::ResultEvent(EventPtr event, MemoryView reply_buffer) :
+    m_reply_buffer(reply_buffer),
+    m_reply_size(0),
     m_event(event)
 {
 }
@@ -29,9 +38,16 @@ Buffer &&ResultEvent::release()
     return std::move(m_value);
 }
 
-hailo_status ResultEvent::signal(Buffer &&value)
+hailo_status ResultEvent::signal(const MemoryView &value)
 {
-    m_value = std::move(value);
+    if (!m_reply_buffer.empty()) {
+        CHECK(value.size() <= m_reply_buffer.size(), HAILO_INTERNAL_FAILURE, "Reply size {} is bigger than the reply buffer {}",
+            value.size(), m_reply_buffer.size());
+        memcpy(m_reply_buffer.data(), value.data(), value.size());
+        m_reply_size = value.size();
+    } else {
+        TRY(m_value, Buffer::create(value.data(), value.size()));
+    }
     return m_event->signal();
 }
 
@@ -40,24 +56,42 @@ hailo_status ResultEvent::wait(std::chrono::milliseconds timeout)
     return m_event->wait(timeout);
 }
 
-Client::~Client()
+Expected<std::shared_ptr<ClientConnection>> ClientConnection::create_shared(std::shared_ptr<ConnectionContext> context)
+{
+    TRY(auto conn, RawConnection::create_shared(context));
+    auto status = conn->connect();
+    CHECK_SUCCESS(status);
+
+    auto ptr = make_shared_nothrow<ClientConnection>(RpcConnection(conn));
+    CHECK_NOT_NULL(ptr, HAILO_OUT_OF_HOST_MEMORY);
+
+    status = ptr->start();
+    CHECK_SUCCESS(status);
+
+    return ptr;
+}
+
+ClientConnection::ClientConnection(RpcConnection connection) :
+    m_is_running(true),
+    m_connection(connection),
+    m_messages_sent(0),
+    m_custom_callbacks_registered(0)
 {
-    is_running = false;
+}
+
+ClientConnection::~ClientConnection()
+{
+    m_is_running = false;
     (void)m_connection.close();
     if (m_thread.joinable()) {
         m_thread.join();
     }
 }
 
-hailo_status Client::connect()
+hailo_status ClientConnection::start()
 {
-    TRY(m_conn_context, ConnectionContext::create_shared(false));
-    TRY(auto conn, RawConnection::create_shared(m_conn_context));
-    auto status = conn->connect();
-    CHECK_SUCCESS(status);
-
-    m_connection = RpcConnection(conn);
     m_thread = std::thread([this] {
+        OsUtils::set_current_thread_name("HRPC_CLIENT");
         auto status = message_loop();
         if ((status != HAILO_SUCCESS) && (status != HAILO_COMMUNICATION_CLOSED)) { // TODO: Use this to prevent future requests
             LOGGER__ERROR("Error in message loop - {}", status);
@@ -66,32 +100,88 @@ hailo_status Client::connect()
     return HAILO_SUCCESS;
 }
 
-hailo_status Client::message_loop()
+hailo_status ClientConnection::message_loop()
 {
-    while (is_running) {
+    // Messages are read into the same buffer, and copied out only for replies waited on by execute_request()
+    Buffer receive_buffer;
+    while (m_is_running) {
         rpc_message_header_t header;
-        TRY_WITH_ACCEPTABLE_STATUS(HAILO_COMMUNICATION_CLOSED, auto message, m_connection.read_message(header));
+        TRY_WITH_ACCEPTABLE_STATUS(HAILO_COMMUNICATION_CLOSED, auto message, m_connection.read_message(header, receive_buffer));
 
         assert(header.action_id < static_cast<uint32_t>(HailoRpcActionID::MAX_VALUE));
         auto action_id_enum = static_cast<HailoRpcActionID>(header.action_id);
-        if (m_custom_callbacks.find(action_id_enum) != m_custom_callbacks.end()) {
-            auto status = m_custom_callbacks[action_id_enum](MemoryView(message), m_connection);
+        auto status = handle_custom_reply(action_id_enum, message);
+        if (HAILO_NOT_FOUND != status) {
             CHECK_SUCCESS(status);
             continue;
         }
 
         std::unique_lock<std::mutex> lock(m_message_mutex);
-        auto event = m_events[header.message_id];
-        lock.unlock();
-        auto status = event->signal(std::move(message));
+        auto event = m_events.find(header.message_id);
+        if (m_events.end() == event) {
+            LOGGER__WARNING("Got a reply to message {}, which is no longer waited for", header.message_id);
+            continue;
+        }
+        status = event->second->signal(message);
         CHECK_SUCCESS(status);
     }
 
     return HAILO_SUCCESS;
 }
 
-Expected<Buffer> Client::execute_request(HailoRpcActionID action_id, const MemoryView &request,
-    std::function<hailo_status(RpcConnection)> write_buffers_callback)
+hailo_status ClientConnection::handle_custom_reply(HailoRpcActionID action_id, const MemoryView &message)
+{
+    std::unique_lock<std::mutex> lock(m_custom_callbacks_mutex);
+    auto callbacks = m_custom_callbacks.find(action_id);
+    if (m_custom_callbacks.end() != callbacks) {
+        for (auto &callback : callbacks->second) {
+            auto status = callback.second(message, m_connection);
+            if (HAILO_NOT_FOUND != status) {
+                return status;
+            }
+        }
+    }
+
+    if (HailoRpcActionID::CALLBACK_CALLED == action_id) {
+        // E.g. a callback that arrived after its configured infer model was released. Other models share the
+        // connection, so the message is skipped rather than failing the message loop.
+        return discard_callback_called(message);
+    }
+
+    if (m_custom_callbacks.end() == callbacks) {
+        return HAILO_NOT_FOUND;
+    }
+
+    LOGGER__ERROR("No callback handled the message of action {}", static_cast<uint32_t>(action_id));
+    return HAILO_INTERNAL_FAILURE;
+}
+
+hailo_status ClientConnection::discard_callback_called(const MemoryView &message)
+{
+    TRY(auto tuple, CallbackCalledSerializer::deserialize_reply(message));
+    LOGGER__WARNING("Discarding callback {} of configured infer model {}, which is not registered",
+        std::get<2>(tuple), std::get<1>(tuple));
+
+    auto bytes_left = std::get<3>(tuple);
+    if (0 == bytes_left) {
+        return HAILO_SUCCESS;
+    }
+
+    TRY(auto discard_buffer, Buffer::create(static_cast<size_t>(std::min(bytes_left, DISCARD_BUFFER_SIZE))));
+    while (bytes_left > 0) {
+        std::vector<MemoryView> buffers = { MemoryView(discard_buffer.data(),
+            static_cast<size_t>(std::min(bytes_left, static_cast<uint64_t>(discard_buffer.size())))) };
+        auto status = m_connection.read_buffers(buffers);
+        CHECK_SUCCESS(status);
+        bytes_left -= buffers[0].size();
+    }
+
+    return HAILO_SUCCESS;
+}
+
+Expected<uint32_t> ClientConnection::send_request(HailoRpcActionID action_id, const MemoryView &request,
+    const std::vector<MemoryView> &buffers, std::function<hailo_status(RpcConnection)> write_buffers_callback,
+    std::shared_ptr<ResultEvent> event)
 {
     std::unique_lock<std::mutex> lock(m_message_mutex);
     rpc_message_header_t header;
@@ -99,27 +189,129 @@ Expected<Buffer> Client::execute_request(HailoRpcActionID action_id, const Memor
     header.message_id = m_messages_sent++;
     header.action_id = static_cast<uint32_t>(action_id);
 
-    auto status = m_connection.write_message(header, request);
+    auto status = m_connection.write_message(header, request, buffers);
     CHECK_SUCCESS_AS_EXPECTED(status);
     if (write_buffers_callback) {
         status = write_buffers_callback(m_connection);
         CHECK_SUCCESS_AS_EXPECTED(status);
     }
 
-    TRY(auto event, ResultEvent::create_shared());
     m_events[header.message_id] = event;
+    return Expected<uint32_t>(header.message_id);
+}
 
-    lock.unlock();
-    status = event->wait(REQUEST_TIMEOUT);
+hailo_status ClientConnection::wait_for_reply(uint32_t message_id, ResultEvent &event)
+{
+    auto status = event.wait(REQUEST_TIMEOUT);
+    {
+        std::unique_lock<std::mutex> lock(m_message_mutex);
+        m_events.erase(message_id);
+    }
+    CHECK_SUCCESS(status);
+
+    return HAILO_SUCCESS;
+}
+
+Expected<Buffer> ClientConnection::execute_request(HailoRpcActionID action_id, const MemoryView &request,
+    std::function<hailo_status(RpcConnection)> write_buffers_callback)
+{
+    TRY(auto event, ResultEvent::create_shared());
+    TRY(auto message_id, send_request(action_id, request, {}, write_buffers_callback, event));
+    auto status = wait_for_reply(message_id, *event);
     CHECK_SUCCESS_AS_EXPECTED(status);
 
-    m_events.erase(header.message_id);
     return event->release();
 }
 
+Expected<MemoryView> ClientConnection::execute_request(HailoRpcActionID action_id, const MemoryView &request,
+    const std::vector<MemoryView> &buffers, MemoryView reply_buffer)
+{
+    TRY(auto event, ResultEvent::create_shared(reply_buffer));
+    TRY(auto message_id, send_request(action_id, request, buffers, nullptr, event));
+    auto status = wait_for_reply(message_id, *event);
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
+    return event->reply();
+}
+
+uint32_t ClientConnection::register_custom_reply(HailoRpcActionID action_id, CustomReplyCallback callback)
+{
+    std::unique_lock<std::mutex> lock(m_custom_callbacks_mutex);
+    auto registration_id = m_custom_callbacks_registered++;
+    m_custom_callbacks[action_id].emplace_back(registration_id, callback);
+    return registration_id;
+}
 
-void Client::register_custom_reply(HailoRpcActionID action_id,
-    std::function<hailo_status(const MemoryView&, RpcConnection connection)> callback)
+void ClientConnection::unregister_custom_reply(HailoRpcActionID action_id, uint32_t registration_id)
 {
-    m_custom_callbacks[action_id] = callback;
-}
\ No newline at end of file
+    std::unique_lock<std::mutex> lock(m_custom_callbacks_mutex);
+    auto &callbacks = m_custom_callbacks[action_id];
+    callbacks.erase(std::remove_if(callbacks.begin(), callbacks.end(),
+        [registration_id] (const std::pair<uint32_t, CustomReplyCallback> &callback) { return registration_id == callback.first; }),
+        callbacks.end());
+}
+
+Client::~Client()
+{
+    // The model connections are closed first, the server releases the client's resources once all of them are closed
+    m_model_connections.clear();
+    m_control_connection.reset();
+}
+
+hailo_status Client::connect()
+{
+    TRY(m_conn_context, ConnectionContext::create_shared(false));
+    TRY(m_control_connection, ClientConnection::create_shared(m_conn_context));
+
+    m_max_model_connections = 0;
+    if (m_conn_context->supports_multiple_connections()) {
+        m_max_model_connections = DEFAULT_MAX_MODEL_CONNECTIONS;
+        auto model_connections = get_env_variable(HAILO_HRPC_MODEL_CONNECTIONS_ENV_VAR);
+        if (model_connections) {
+            TRY(m_max_model_connections, StringUtils::to_uint32(model_connections.value(), 10),
+                "Invalid {} value '{}'", HAILO_HRPC_MODEL_CONNECTIONS_ENV_VAR, model_connections.value());
+        }
+    }
+
+    return HAILO_SUCCESS;
+}
+
+Expected<Buffer> Client::execute_request(HailoRpcActionID action_id, const MemoryView &request,
+    std::function<hailo_status(RpcConnection)> write_buffers_callback)
+{
+    return m_control_connection->execute_request(action_id, request, write_buffers_callback);
+}
+
+Expected<MemoryView> Client::execute_request(HailoRpcActionID action_id, const MemoryView &request,
+    const std::vector<MemoryView> &buffers, MemoryView reply_buffer)
+{
+    return m_control_connection->execute_request(action_id, request, buffers, reply_buffer);
+}
+
+uint32_t Client::register_custom_reply(HailoRpcActionID action_id, CustomReplyCallback callback)
+{
+    return m_control_connection->register_custom_reply(action_id, callback);
+}
+
+void Client::unregister_custom_reply(HailoRpcActionID action_id, uint32_t registration_id)
+{
+    m_control_connection->unregister_custom_reply(action_id, registration_id);
+}
+
+Expected<std::shared_ptr<ClientConnection>> Client::get_model_connection()
+{
+    if (0 == m_max_model_connections) {
+        return std::shared_ptr<ClientConnection>(m_control_connection);
+    }
+
+    std::unique_lock<std::mutex> lock(m_model_connections_mutex);
+    if (m_model_connections.size() < m_max_model_connections) {
+        TRY(auto connection, ClientConnection::create_shared(m_conn_context));
+        m_model_connections.emplace_back(connection);
+        return connection;
+    }
+
+    auto connection = m_model_connections[m_next_model_connection];
+    m_next_model_connection = (m_next_model_connection + 1) % m_model_connections.size();
+    return connection;
+}
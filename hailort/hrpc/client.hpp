@@ -14,6 +14,10 @@
 #include <fcntl.h>
 #include <functional>
 #include <thread>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #include "rpc_connection.hpp"
 #include "hrpc_protocol/serializer.hpp"
@@ -24,43 +28,112 @@ namespace hrpc
 
 #define REQUEST_TIMEOUT std::chrono::milliseconds(10000)
 
+/**
+ * Maximal number of connections opened for models, in addition to the control connection (4 by default, 0 makes all
+ * of the models use the control connection). Ignored by transports that support a single connection (PCIe).
+ */
+#define HAILO_HRPC_MODEL_CONNECTIONS_ENV_VAR "HAILO_HRPC_MODEL_CONNECTIONS"
+#define DEFAULT_MAX_MODEL_CONNECTIONS (4)
+
 class ResultEvent
 {
 public:
-    static Expected<std::shared_ptr<ResultEvent>> create_shared();
-    ResultEvent(EventPtr event);
+    // If reply_buffer is given, the reply is copied into it instead of into a newly allocated buffer
+    static Expected<std::shared_ptr<ResultEvent>> create_shared(MemoryView reply_buffer = MemoryView());
+    ResultEvent(EventPtr event, MemoryView reply_buffer);
 
     Buffer &&release();
-    hailo_status signal(Buffer &&value);
+    MemoryView reply() { return MemoryView(m_reply_buffer.data(), m_reply_size); }
+    hailo_status signal(const MemoryView &value);
     hailo_status wait(std::chrono::milliseconds timeout);
 
 private:
     Buffer m_value;
+    MemoryView m_reply_buffer;
+    size_t m_reply_size;
     EventPtr m_event;
 };
 
-class Client
+using CustomReplyCallback = std::function<hailo_status(const MemoryView&, RpcConnection)>;
+
+// A single connection to the server, with a thread reading the replies arriving on it
+class ClientConnection
 {
 public:
-    Client() = default;
-    ~Client();
+    static Expected<std::shared_ptr<ClientConnection>> create_shared(std::shared_ptr<ConnectionContext> context);
+
+    explicit ClientConnection(RpcConnection connection);
+    ~ClientConnection();
+
+    ClientConnection(const ClientConnection &other) = delete;
+    ClientConnection &operator=(const ClientConnection &other) = delete;
+    ClientConnection(ClientConnection &&other) = delete;
+    ClientConnection &operator=(ClientConnection &&other) = delete;
 
-    hailo_status connect();
     Expected<Buffer> execute_request(HailoRpcActionID action_id, const MemoryView &request,
         std::function<hailo_status(RpcConnection)> write_buffers_callback = nullptr);
-    void register_custom_reply(HailoRpcActionID action_id, std::function<hailo_status(const MemoryView&, RpcConnection connection)> callback);
+    // Sends the request together with the buffers in a single write, and reads the reply into reply_buffer.
+    // Returns a view of the reply.
+    Expected<MemoryView> execute_request(HailoRpcActionID action_id, const MemoryView &request,
+        const std::vector<MemoryView> &buffers, MemoryView reply_buffer);
 
-protected:
+    // Messages of action_id sent by the server on its own are passed to the callbacks registered for it, in the order
+    // of registration, until one of them returns anything other than HAILO_NOT_FOUND.
+    // Returns an id to unregister the callback with.
+    uint32_t register_custom_reply(HailoRpcActionID action_id, CustomReplyCallback callback);
+    // After this returns, the callback is no longer called
+    void unregister_custom_reply(HailoRpcActionID action_id, uint32_t registration_id);
+
+private:
+    hailo_status start();
     hailo_status message_loop();
+    hailo_status handle_custom_reply(HailoRpcActionID action_id, const MemoryView &message);
+    // Reads and drops the buffers following a CALLBACK_CALLED message that no callback handled
+    hailo_status discard_callback_called(const MemoryView &message);
+    Expected<uint32_t> send_request(HailoRpcActionID action_id, const MemoryView &request,
+        const std::vector<MemoryView> &buffers, std::function<hailo_status(RpcConnection)> write_buffers_callback,
+        std::shared_ptr<ResultEvent> event);
+    hailo_status wait_for_reply(uint32_t message_id, ResultEvent &event);
 
-    bool is_running = true;
-    std::shared_ptr<ConnectionContext> m_conn_context;
+    std::atomic_bool m_is_running;
     RpcConnection m_connection;
     std::thread m_thread;
     std::unordered_map<uint32_t, std::shared_ptr<ResultEvent>> m_events;
-    std::unordered_map<HailoRpcActionID, std::function<hailo_status(const MemoryView&, RpcConnection)>> m_custom_callbacks;
-    uint32_t m_messages_sent = 0;
+    uint32_t m_messages_sent;
     std::mutex m_message_mutex;
+    std::unordered_map<HailoRpcActionID, std::vector<std::pair<uint32_t, CustomReplyCallback>>> m_custom_callbacks;
+    uint32_t m_custom_callbacks_registered;
+    std::mutex m_custom_callbacks_mutex;
+};
+
+// The client's connections to the server. Requests go through the control connection, unless they belong to a model
+// that was given a connection of its own, so the frames of one model aren't held back by these of another.
+class Client
+{
+public:
+    Client() = default;
+    ~Client();
+
+    hailo_status connect();
+    Expected<Buffer> execute_request(HailoRpcActionID action_id, const MemoryView &request,
+        std::function<hailo_status(RpcConnection)> write_buffers_callback = nullptr);
+    Expected<MemoryView> execute_request(HailoRpcActionID action_id, const MemoryView &request,
+        const std::vector<MemoryView> &buffers, MemoryView reply_buffer);
+    uint32_t register_custom_reply(HailoRpcActionID action_id, CustomReplyCallback callback);
+    void unregister_custom_reply(HailoRpcActionID action_id, uint32_t registration_id);
+
+    // Returns the connection to be used by a new model. Models get connections of their own, up to the maximal count
+    // (see HAILO_HRPC_MODEL_CONNECTIONS_ENV_VAR), and share them in a round robin after that.
+    // If the transport doesn't support more than one connection, the control connection is returned.
+    Expected<std::shared_ptr<ClientConnection>> get_model_connection();
+
+protected:
+    std::shared_ptr<ConnectionContext> m_conn_context;
+    std::shared_ptr<ClientConnection> m_control_connection;
+    std::vector<std::shared_ptr<ClientConnection>> m_model_connections;
+    size_t m_max_model_connections = 0;
+    size_t m_next_model_connection = 0;
+    std::mutex m_model_connections_mutex;
 };
 
 } // namespace hrpc
@@ -10,53 +10,237 @@
 #include "hrpc/os/posix/raw_connection_internal.hpp"
 
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <sys/un.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <netinet/tcp.h>
+#if defined(__linux__)
+#include <linux/vm_sockets.h>
+#endif
 #include <string>
 #include <unistd.h>
 #include <common/logger_macros.hpp>
 #include <common/utils.hpp>
 #include <hailo/hailort.h>
 
+#define DEFAULT_UNIX_SOCKET_PATH "/tmp/unix_socket"
+#define UNIX_ADDRESS_PREFIX "unix:"
+#define TCP_ADDRESS_PREFIX "tcp:"
+#define VSOCK_ADDRESS_PREFIX "vsock:"
+#define ANY_ADDRESS "any"
+
+// Large enough to hold a few frames, so a frame is written without waiting for the peer to read the previous one
+#define SOCKET_BUFFER_SIZE (4 * 1024 * 1024)
+#define LISTEN_BACKLOG (5)
+// Vectored transfers of more buffers are split to several system calls. Well below IOV_MAX.
+#define MAX_IOVECS_PER_CALL (64)
+
 using namespace hrpc;
 
+static bool has_prefix(const std::string &str, const std::string &prefix)
+{
+    return (0 == str.compare(0, prefix.size(), prefix));
+}
+
+// Splits "<host>:<port>" on the last colon, so IPv6 hosts may be given as "[::1]:<port>"
+static Expected<std::pair<std::string, std::string>> split_host_and_port(const std::string &address)
+{
+    const auto colon_pos = address.rfind(':');
+    CHECK_AS_EXPECTED((std::string::npos != colon_pos) && (0 != colon_pos) && ((address.size() - 1) != colon_pos),
+        HAILO_INVALID_ARGUMENT, "Invalid hrpc address '{}', expected '<host>:<port>'", address);
+
+    auto host = address.substr(0, colon_pos);
+    if ((host.size() > 2) && ('[' == host.front()) && (']' == host.back())) {
+        host = host.substr(1, host.size() - 2);
+    }
+    return std::make_pair(host, address.substr(colon_pos + 1));
+}
+
+static Expected<uint32_t> parse_uint32(const std::string &str)
+{
+    static const size_t MAX_UINT32_DIGITS = 10;
+    CHECK_AS_EXPECTED(!str.empty() && (str.size() <= MAX_UINT32_DIGITS) && (std::string::npos == str.find_first_not_of("0123456789")),
+        HAILO_INVALID_ARGUMENT, "Invalid number '{}' in hrpc address", str);
+
+    const auto value = std::stoull(str);
+    CHECK_AS_EXPECTED(value <= UINT32_MAX, HAILO_INVALID_ARGUMENT, "Number '{}' in hrpc address is out of range", str);
+    return static_cast<uint32_t>(value);
+}
+
+static hailo_status parse_unix_address(const std::string &path, sockaddr_storage &address, socklen_t &address_size)
+{
+    auto unix_address = reinterpret_cast<sockaddr_un*>(&address);
+    CHECK(!path.empty() && (path.size() < sizeof(unix_address->sun_path)), HAILO_INVALID_ARGUMENT,
+        "Invalid unix socket path '{}'", path);
+
+    unix_address->sun_family = AF_UNIX;
+    strncpy(unix_address->sun_path, path.c_str(), sizeof(unix_address->sun_path) - 1);
+    address_size = sizeof(sockaddr_un);
+    return HAILO_SUCCESS;
+}
+
+static bool is_loopback_address(const sockaddr_storage &address)
+{
+    if (AF_INET == address.ss_family) {
+        const auto ipv4_address = ntohl(reinterpret_cast<const sockaddr_in*>(&address)->sin_addr.s_addr);
+        return (IN_LOOPBACKNET == (ipv4_address >> IN_CLASSA_NSHIFT));
+    } else if (AF_INET6 == address.ss_family) {
+        return IN6_IS_ADDR_LOOPBACK(&reinterpret_cast<const sockaddr_in6*>(&address)->sin6_addr);
+    }
+    return false;
+}
+
+// The host may be omitted ("tcp:<port>"), meaning the loopback address
+static hailo_status parse_tcp_address(const std::string &host_and_port, bool is_accepting, sockaddr_storage &address,
+    socklen_t &address_size)
+{
+    std::string host;
+    std::string port = host_and_port;
+    if (std::string::npos != host_and_port.find(':')) {
+        TRY(const auto host_port, split_host_and_port(host_and_port));
+        host = host_port.first;
+        port = host_port.second;
+    }
+    TRY(const auto port_number, parse_uint32(port));
+    CHECK(port_number <= UINT16_MAX, HAILO_INVALID_ARGUMENT, "Invalid TCP port {}", port);
+
+    // Without a host, getaddrinfo() returns the loopback address, or the wildcard one with AI_PASSIVE
+    const bool is_any_host = (ANY_ADDRESS == host);
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_NUMERICSERV | ((is_accepting && is_any_host) ? AI_PASSIVE : 0);
+
+    struct addrinfo *results = nullptr;
+    int result = ::getaddrinfo((is_any_host || host.empty()) ? nullptr : host.c_str(), port.c_str(), &hints, &results);
+    CHECK(0 == result, HAILO_INVALID_ARGUMENT, "Failed resolving TCP address '{}', error = {}", host_and_port,
+        gai_strerror(result));
+    CHECK(nullptr != results, HAILO_INVALID_ARGUMENT, "No TCP address found for '{}'", host_and_port);
+
+    memcpy(&address, results->ai_addr, results->ai_addrlen);
+    address_size = results->ai_addrlen;
+    ::freeaddrinfo(results);
+
+    if (is_accepting && !is_loopback_address(address)) {
+        LOGGER__WARNING("Listening on TCP address '{}', which is reachable from other hosts. hrpc connections are not "
+            "authenticated, so any peer that can reach it can use the devices", host_and_port);
+    }
+    return HAILO_SUCCESS;
+}
+
+static hailo_status parse_vsock_address(const std::string &cid_and_port, sockaddr_storage &address, socklen_t &address_size)
+{
+#if defined(__linux__)
+    TRY(const auto cid_port, split_host_and_port(cid_and_port));
+    const auto &cid = cid_port.first;
+    TRY(const auto port, parse_uint32(cid_port.second));
+
+    auto vsock_address = reinterpret_cast<sockaddr_vm*>(&address);
+    vsock_address->svm_family = AF_VSOCK;
+    vsock_address->svm_port = port;
+    if (ANY_ADDRESS == cid) {
+        vsock_address->svm_cid = VMADDR_CID_ANY;
+    } else {
+        TRY(vsock_address->svm_cid, parse_uint32(cid));
+    }
+    address_size = sizeof(sockaddr_vm);
+    return HAILO_SUCCESS;
+#else
+    (void)address;
+    (void)address_size;
+    LOGGER__ERROR("vsock hrpc address '{}' is only supported on Linux", cid_and_port);
+    return HAILO_NOT_SUPPORTED;
+#endif
+}
+
+// Skips the first bytes_done bytes of the iovecs, dropping the ones that were fully transferred
+static void advance_iovecs(struct iovec *&iovecs, size_t &iovecs_count, size_t bytes_done)
+{
+    while ((iovecs_count > 0) && (bytes_done >= iovecs->iov_len)) {
+        bytes_done -= iovecs->iov_len;
+        iovecs++;
+        iovecs_count--;
+    }
+    if (bytes_done > 0) {
+        iovecs->iov_base = static_cast<uint8_t*>(iovecs->iov_base) + bytes_done;
+        iovecs->iov_len -= bytes_done;
+    }
+}
+
 Expected<std::shared_ptr<ConnectionContext>> OsConnectionContext::create_shared(bool is_accepting)
 {
-    auto ptr = make_shared_nothrow<OsConnectionContext>(is_accepting);
+    return create_shared(is_accepting, UNIX_ADDRESS_PREFIX DEFAULT_UNIX_SOCKET_PATH);
+}
+
+Expected<std::shared_ptr<ConnectionContext>> OsConnectionContext::create_shared(bool is_accepting, const std::string &address)
+{
+    sockaddr_storage socket_address;
+    memset(&socket_address, 0, sizeof(socket_address));
+    socklen_t socket_address_size = 0;
+
+    if (has_prefix(address, UNIX_ADDRESS_PREFIX)) {
+        auto status = parse_unix_address(address.substr(strlen(UNIX_ADDRESS_PREFIX)), socket_address, socket_address_size);
+        CHECK_SUCCESS_AS_EXPECTED(status);
+    } else if (has_prefix(address, TCP_ADDRESS_PREFIX)) {
+        auto status = parse_tcp_address(address.substr(strlen(TCP_ADDRESS_PREFIX)), is_accepting, socket_address,
+            socket_address_size);
+        CHECK_SUCCESS_AS_EXPECTED(status);
+    } else if (has_prefix(address, VSOCK_ADDRESS_PREFIX)) {
+        auto status = parse_vsock_address(address.substr(strlen(VSOCK_ADDRESS_PREFIX)), socket_address, socket_address_size);
+        CHECK_SUCCESS_AS_EXPECTED(status);
+    } else {
+        LOGGER__ERROR("Invalid hrpc address '{}', expected 'unix:<path>', 'tcp:[<host>:]<port>' or 'vsock:<cid>:<port>'", address);
+        return make_unexpected(HAILO_INVALID_ARGUMENT);
+    }
+
+    auto ptr = make_shared_nothrow<OsConnectionContext>(is_accepting, static_cast<int>(socket_address.ss_family),
+        socket_address, socket_address_size);
     CHECK_NOT_NULL(ptr, HAILO_OUT_OF_HOST_MEMORY);
 
     return std::dynamic_pointer_cast<ConnectionContext>(ptr);
 }
 
-Expected<std::shared_ptr<RawConnection>> OsRawConnection::create_shared(std::shared_ptr<OsConnectionContext> context)
+static hailo_status listen_on_address(int fd, const OsConnectionContext &context)
 {
-    std::shared_ptr<RawConnection> ptr;
-    if (context->is_accepting()) {
-        int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
-        CHECK_AS_EXPECTED(fd >= 0, HAILO_OPEN_FILE_FAILURE, "Socket creation error, errno = {}", errno);
+    if (AF_UNIX == context.domain()) {
+        unlink(reinterpret_cast<const sockaddr_un*>(context.address())->sun_path);
+    } else if ((AF_INET == context.domain()) || (AF_INET6 == context.domain())) {
+        int reuse_address = 1;
+        int result = ::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse_address, sizeof(reuse_address));
+        CHECK(result >= 0, HAILO_FILE_OPERATION_FAILURE, "Setting SO_REUSEADDR failed, errno = {}", errno);
+    }
 
-        struct sockaddr_un server_addr;
-        memset(&server_addr, 0, sizeof(server_addr));
-        server_addr.sun_family = AF_UNIX;
-        std::string addr = "/tmp/unix_socket";
-        strncpy(server_addr.sun_path, addr.c_str(), addr.size());
+    int result = ::bind(fd, context.address(), context.address_size());
+    CHECK(result >= 0, HAILO_FILE_OPERATION_FAILURE, "Bind error, errno = {}", errno);
 
-        unlink(addr.c_str());
-        int result = ::bind(fd, (struct sockaddr*)&server_addr, sizeof(server_addr));
-        CHECK_AS_EXPECTED(result >= 0, HAILO_FILE_OPERATION_FAILURE, "Bind error, errno = {}", errno);
+    result = ::listen(fd, LISTEN_BACKLOG);
+    CHECK(result >= 0, HAILO_FILE_OPERATION_FAILURE, "Listen error, errno = {}", errno);
 
-        result = ::listen(fd, 5);
-        CHECK_AS_EXPECTED(result >= 0, HAILO_FILE_OPERATION_FAILURE, "Listen error, errno = {}", errno);
+    return HAILO_SUCCESS;
+}
 
-        ptr = make_shared_nothrow<OsRawConnection>(fd, context);
-    } else {
+Expected<std::shared_ptr<RawConnection>> OsRawConnection::create_shared(std::shared_ptr<OsConnectionContext> context)
+{
+    int fd = ::socket(context->domain(), SOCK_STREAM, 0);
+    CHECK_AS_EXPECTED(fd >= 0, HAILO_OPEN_FILE_FAILURE, "Socket creation error, errno = {}", errno);
+
+    if (context->is_accepting()) {
+        auto status = listen_on_address(fd, *context);
+        if (HAILO_SUCCESS != status) {
+            ::close(fd);
+            return make_unexpected(status);
+        }
+    }
 
-        int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
-        CHECK_AS_EXPECTED(fd >= 0, HAILO_OPEN_FILE_FAILURE, "Socket creation error, errno = {}", errno);
-        ptr = make_shared_nothrow<OsRawConnection>(fd, context);
+    auto ptr = make_shared_nothrow<OsRawConnection>(fd, context);
+    if (nullptr == ptr) {
+        ::close(fd);
+        return make_unexpected(HAILO_OUT_OF_HOST_MEMORY);
     }
-    
-    CHECK_NOT_NULL_AS_EXPECTED(ptr, HAILO_OUT_OF_HOST_MEMORY);
-    return ptr;
+    return std::static_pointer_cast<RawConnection>(ptr);
 }
 
 Expected<std::shared_ptr<RawConnection>> OsRawConnection::accept()
@@ -64,23 +248,55 @@ Expected<std::shared_ptr<RawConnection>> OsRawConnection::accept()
     int fd = ::accept(m_fd, nullptr, nullptr);
     CHECK_AS_EXPECTED(fd >= 0, HAILO_FILE_OPERATION_FAILURE, "Accept error, errno = {}", errno);
 
-    std::shared_ptr<RawConnection> ptr = make_shared_nothrow<OsRawConnection>(fd, m_context);
-    CHECK_NOT_NULL_AS_EXPECTED(ptr, HAILO_OUT_OF_HOST_MEMORY);
+    auto ptr = make_shared_nothrow<OsRawConnection>(fd, m_context);
+    if (nullptr == ptr) {
+        ::close(fd);
+        return make_unexpected(HAILO_OUT_OF_HOST_MEMORY);
+    }
+
+    auto status = ptr->set_socket_options();
+    if (HAILO_SUCCESS != status) {
+        (void)ptr->close();
+        return make_unexpected(status);
+    }
 
-    return ptr;
+    return std::static_pointer_cast<RawConnection>(ptr);
 }
 
 hailo_status OsRawConnection::connect()
 {
-    struct sockaddr_un server_addr;
-    std::string addr = "/tmp/unix_socket";
+    int result = ::connect(m_fd, m_context->address(), m_context->address_size());
+    CHECK(result >= 0, HAILO_FILE_OPERATION_FAILURE, "Connect error, errno = {}", errno);
 
-    memset(&server_addr, 0, sizeof(server_addr));
-    server_addr.sun_family = AF_UNIX;
-    strncpy(server_addr.sun_path, addr.c_str(), addr.size());
+    return set_socket_options();
+}
 
-    int result = ::connect(m_fd, (struct sockaddr*)&server_addr, sizeof(server_addr));
-    CHECK(result >= 0, HAILO_FILE_OPERATION_FAILURE, "Connect error, errno = {}", errno);
+hailo_status OsRawConnection::set_socket_options()
+{
+    if ((AF_INET == m_context->domain()) || (AF_INET6 == m_context->domain())) {
+        // Each message is sent as soon as it is written, instead of being held back waiting for the previous one's ACK
+        int no_delay = 1;
+        int result = ::setsockopt(m_fd, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof(no_delay));
+        CHECK(result >= 0, HAILO_FILE_OPERATION_FAILURE, "Setting TCP_NODELAY failed, errno = {}", errno);
+
+        // The kernel may clamp the buffer sizes (net.core.wmem_max / rmem_max), which is not an error
+        int buffer_size = SOCKET_BUFFER_SIZE;
+        if (0 != ::setsockopt(m_fd, SOL_SOCKET, SO_SNDBUF, &buffer_size, sizeof(buffer_size))) {
+            LOGGER__WARNING("Setting SO_SNDBUF failed, errno = {}", errno);
+        }
+        if (0 != ::setsockopt(m_fd, SOL_SOCKET, SO_RCVBUF, &buffer_size, sizeof(buffer_size))) {
+            LOGGER__WARNING("Setting SO_RCVBUF failed, errno = {}", errno);
+        }
+    }
+#if defined(__linux__)
+    else if (AF_VSOCK == m_context->domain()) {
+        uint64_t buffer_size = SOCKET_BUFFER_SIZE;
+        if ((0 != ::setsockopt(m_fd, AF_VSOCK, SO_VM_SOCKETS_BUFFER_MAX_SIZE, &buffer_size, sizeof(buffer_size))) ||
+            (0 != ::setsockopt(m_fd, AF_VSOCK, SO_VM_SOCKETS_BUFFER_SIZE, &buffer_size, sizeof(buffer_size)))) {
+            LOGGER__WARNING("Setting the vsock buffer size failed, errno = {}", errno);
+        }
+    }
+#endif
 
     return HAILO_SUCCESS;
 }
@@ -110,6 +326,59 @@ hailo_status OsRawConnection::read(uint8_t *buffer, size_t size)
     return HAILO_SUCCESS;
 }
 
+hailo_status OsRawConnection::writev(const MemoryView *buffers, size_t buffers_count)
+{
+    struct iovec iovecs_array[MAX_IOVECS_PER_CALL];
+    size_t buffers_done = 0;
+    while (buffers_done < buffers_count) {
+        size_t iovecs_count = std::min(buffers_count - buffers_done, static_cast<size_t>(MAX_IOVECS_PER_CALL));
+        for (size_t i = 0; i < iovecs_count; i++) {
+            iovecs_array[i].iov_base = const_cast<uint8_t*>(buffers[buffers_done + i].data());
+            iovecs_array[i].iov_len = buffers[buffers_done + i].size();
+        }
+        buffers_done += iovecs_count;
+
+        struct iovec *iovecs = iovecs_array;
+        advance_iovecs(iovecs, iovecs_count, 0);
+        while (iovecs_count > 0) {
+            struct msghdr message;
+            memset(&message, 0, sizeof(message));
+            message.msg_iov = iovecs;
+            message.msg_iovlen = iovecs_count;
+            ssize_t result = ::sendmsg(m_fd, &message, MSG_NOSIGNAL);
+            CHECK(result >= 0, HAILO_FILE_OPERATION_FAILURE, "Write error, errno = {}", errno);
+            advance_iovecs(iovecs, iovecs_count, static_cast<size_t>(result));
+        }
+    }
+    return HAILO_SUCCESS;
+}
+
+hailo_status OsRawConnection::readv(MemoryView *buffers, size_t buffers_count)
+{
+    struct iovec iovecs_array[MAX_IOVECS_PER_CALL];
+    size_t buffers_done = 0;
+    while (buffers_done < buffers_count) {
+        size_t iovecs_count = std::min(buffers_count - buffers_done, static_cast<size_t>(MAX_IOVECS_PER_CALL));
+        for (size_t i = 0; i < iovecs_count; i++) {
+            iovecs_array[i].iov_base = buffers[buffers_done + i].data();
+            iovecs_array[i].iov_len = buffers[buffers_done + i].size();
+        }
+        buffers_done += iovecs_count;
+
+        struct iovec *iovecs = iovecs_array;
+        advance_iovecs(iovecs, iovecs_count, 0);
+        while (iovecs_count > 0) {
+            ssize_t result = ::readv(m_fd, iovecs, static_cast<int>(iovecs_count));
+            if (0 == result) {
+                return HAILO_COMMUNICATION_CLOSED; // 0 means the communication is closed
+            }
+            CHECK(result >= 0, HAILO_FILE_OPERATION_FAILURE, "Read error, errno = {}", errno);
+            advance_iovecs(iovecs, iovecs_count, static_cast<size_t>(result));
+        }
+    }
+    return HAILO_SUCCESS;
+}
+
 hailo_status OsRawConnection::close()
 {
     int result = ::shutdown(m_fd, SHUT_RDWR);
@@ -119,4 +388,4 @@ hailo_status OsRawConnection::close()
     CHECK(0 == result, HAILO_CLOSE_FAILURE, "Socket close failed, errno = {}", errno);
 
     return HAILO_SUCCESS;
-}
\ No newline at end of file
+}
@@ -14,6 +14,8 @@
 #include "hrpc/raw_connection.hpp"
 
 #include <memory>
+#include <string>
+#include <sys/socket.h>
 
 using namespace hailort;
 
@@ -24,10 +26,23 @@ class OsConnectionContext : public ConnectionContext
 {
 public:
     static Expected<std::shared_ptr<ConnectionContext>> create_shared(bool is_accepting);
+    static Expected<std::shared_ptr<ConnectionContext>> create_shared(bool is_accepting, const std::string &address);
 
-    OsConnectionContext(bool is_accepting) : ConnectionContext(is_accepting) {}
+    OsConnectionContext(bool is_accepting, int domain, const sockaddr_storage &address, socklen_t address_size) :
+        ConnectionContext(is_accepting), m_domain(domain), m_address(address), m_address_size(address_size) {}
 
     virtual ~OsConnectionContext() = default;
+
+    virtual bool supports_multiple_connections() const override { return true; }
+
+    int domain() const { return m_domain; }
+    const sockaddr *address() const { return reinterpret_cast<const sockaddr*>(&m_address); }
+    socklen_t address_size() const { return m_address_size; }
+
+private:
+    int m_domain;
+    sockaddr_storage m_address;
+    socklen_t m_address_size;
 };
 
 class OsRawConnection : public RawConnection
@@ -42,9 +57,13 @@ public:
     virtual hailo_status write(const uint8_t *buffer, size_t size) override;
     virtual hailo_status read(uint8_t *buffer, size_t size) override;
     virtual hailo_status close() override;
+    virtual hailo_status writev(const MemoryView *buffers, size_t buffers_count) override;
+    virtual hailo_status readv(MemoryView *buffers, size_t buffers_count) override;
 
     OsRawConnection(int fd, std::shared_ptr<OsConnectionContext> context) : m_fd(fd), m_context(context) {}
 private:
+    hailo_status set_socket_options();
+
     int m_fd;
     std::shared_ptr<OsConnectionContext> m_context;
 };
@@ -21,6 +21,13 @@ Expected<std::shared_ptr<ConnectionContext>> OsConnectionContext::create_shared(
     return make_unexpected(HAILO_NOT_IMPLEMENTED);
 }
 
+Expected<std::shared_ptr<ConnectionContext>> OsConnectionContext::create_shared(bool is_accepting, const std::string &address)
+{
+    (void)is_accepting;
+    (void)address;
+    return make_unexpected(HAILO_NOT_IMPLEMENTED);
+}
+
 Expected<std::shared_ptr<RawConnection>> OsRawConnection::create_shared(std::shared_ptr<OsConnectionContext> context)
 {
     (void)context;
@@ -14,6 +14,7 @@
 #include "hrpc/raw_connection.hpp"
 
 #include <memory>
+#include <string>
 
 using namespace hailort;
 
@@ -24,6 +25,7 @@ class OsConnectionContext : public ConnectionContext
 {
 public:
     static Expected<std::shared_ptr<ConnectionContext>> create_shared(bool is_accepting);
+    static Expected<std::shared_ptr<ConnectionContext>> create_shared(bool is_accepting, const std::string &address);
 };
 
 class OsRawConnection : public RawConnection
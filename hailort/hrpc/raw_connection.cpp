@@ -9,6 +9,7 @@
 
 #include "hailo/vdevice.hpp"
 #include "hrpc/raw_connection.hpp"
+#include "common/utils.hpp"
 #include "hrpc/os/pcie/raw_connection_internal.hpp"
 
 #ifdef _WIN32
@@ -24,6 +25,13 @@ using namespace hrpc;
 
 Expected<std::shared_ptr<ConnectionContext>> ConnectionContext::create_shared(bool is_accepting)
 {
+    if (!is_accepting) {
+        auto address = get_env_variable(HAILO_HRPC_ADDRESS_ENV_VAR);
+        if (address) {
+            return create_shared(is_accepting, address.value());
+        }
+    }
+
     // The env var HAILO_FORCE_HRPC_CLIENT_ENV_VAR is supported for debug purposes
     char *socket_com = std::getenv(HAILO_FORCE_SOCKET_COM_ENV_VAR); // TODO: Remove duplication
     auto force_socket_com = (nullptr != socket_com) && ("1" == std::string(socket_com));
@@ -35,6 +43,11 @@ Expected<std::shared_ptr<ConnectionContext>> ConnectionContext::create_shared(bo
     }
 }
 
+Expected<std::shared_ptr<ConnectionContext>> ConnectionContext::create_shared(bool is_accepting, const std::string &address)
+{
+    return OsConnectionContext::create_shared(is_accepting, address);
+}
+
 Expected<std::shared_ptr<RawConnection>> RawConnection::create_shared(std::shared_ptr<ConnectionContext> context)
 {
     // Create according to ConnectionContext type
@@ -44,4 +57,26 @@ Expected<std::shared_ptr<RawConnection>> RawConnection::create_shared(std::share
     } else {
         return PcieRawConnection::create_shared(std::dynamic_pointer_cast<PcieConnectionContext>(context));
     }
-}
\ No newline at end of file
+}
+
+hailo_status RawConnection::writev(const MemoryView *buffers, size_t buffers_count)
+{
+    for (size_t i = 0; i < buffers_count; i++) {
+        auto status = write(buffers[i].data(), buffers[i].size());
+        if (HAILO_SUCCESS != status) {
+            return status;
+        }
+    }
+    return HAILO_SUCCESS;
+}
+
+hailo_status RawConnection::readv(MemoryView *buffers, size_t buffers_count)
+{
+    for (size_t i = 0; i < buffers_count; i++) {
+        auto status = read(buffers[i].data(), buffers[i].size());
+        if (HAILO_SUCCESS != status) {
+            return status;
+        }
+    }
+    return HAILO_SUCCESS;
+}
@@ -11,12 +11,21 @@
 #define _RAW_CONNECTION_HPP_
 
 #include "hailo/expected.hpp"
+#include "hailo/buffer.hpp"
 #include "vdma/pcie_session.hpp"
 
 #include <memory>
+#include <string>
 
 using namespace hailort;
 
+/**
+ * Address of a remote hailort_server for the hrpc client to connect to, instead of the local PCIe connection.
+ * Given as "unix:<path>", "tcp:[<host>:]<port>" or "vsock:<cid>:<port>". hailort_server takes the same address as an argument.
+ * A TCP address without a host means the loopback interface. The connection is not authenticated.
+ */
+#define HAILO_HRPC_ADDRESS_ENV_VAR "HAILO_HRPC_ADDRESS"
+
 namespace hrpc
 {
 
@@ -24,8 +33,11 @@ class ConnectionContext
 {
 public:
     static Expected<std::shared_ptr<ConnectionContext>> create_shared(bool is_accepting);
+    static Expected<std::shared_ptr<ConnectionContext>> create_shared(bool is_accepting, const std::string &address);
 
     bool is_accepting() const { return m_is_accepting; }
+    // Whether a client may open several connections to the same server at once
+    virtual bool supports_multiple_connections() const { return false; }
 
     ConnectionContext(bool is_accepting) : m_is_accepting(is_accepting) {}
     virtual ~ConnectionContext() = default;
@@ -49,6 +61,11 @@ public:
     virtual hailo_status read(uint8_t *buffer, size_t size) = 0;
     virtual hailo_status close() = 0;
 
+    // Writes (reads) the buffers one after the other, as if they were a single buffer. Connections that support
+    // vectored I/O override these to transfer all of the buffers at once.
+    virtual hailo_status writev(const MemoryView *buffers, size_t buffers_count);
+    virtual hailo_status readv(MemoryView *buffers, size_t buffers_count);
+
 protected:
     std::chrono::milliseconds m_timeout = std::chrono::milliseconds(HAILO_INFINITE);
 };
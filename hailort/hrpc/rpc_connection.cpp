@@ -13,15 +13,32 @@ namespace hrpc
 {
 
 hailo_status RpcConnection::write_message(const rpc_message_header_t &header, const MemoryView &buffer) {
+    return write_message(header, buffer, {});
+}
+
+hailo_status RpcConnection::write_message(const rpc_message_header_t &header, const MemoryView &buffer,
+    const std::vector<MemoryView> &buffers)
+{
     auto header_with_magic = header;
     header_with_magic.magic = RPC_MESSAGE_MAGIC;
-    auto status = m_raw->write(reinterpret_cast<const uint8_t*>(&header_with_magic), sizeof(header_with_magic));
-    if (HAILO_COMMUNICATION_CLOSED == status) {
-        return make_unexpected(status);
+
+    MemoryView views[RPC_MAX_BUFFERS_PER_WRITE];
+    views[0] = MemoryView::create_const(&header_with_magic, sizeof(header_with_magic));
+    views[1] = MemoryView::create_const(buffer.data(), header.size);
+    size_t views_count = 2;
+    for (const auto &extra_buffer : buffers) {
+        if (ARRAY_ENTRIES(views) == views_count) {
+            auto status = m_raw->writev(views, views_count);
+            if (HAILO_COMMUNICATION_CLOSED == status) {
+                return make_unexpected(status);
+            }
+            CHECK_SUCCESS(status);
+            views_count = 0;
+        }
+        views[views_count++] = extra_buffer;
     }
-    CHECK_SUCCESS(status);
 
-    status = m_raw->write(buffer.data(), header.size);
+    auto status = m_raw->writev(views, views_count);
     if (HAILO_COMMUNICATION_CLOSED == status) {
         return make_unexpected(status);
     }
@@ -30,7 +47,7 @@ hailo_status RpcConnection::write_message(const rpc_message_header_t &header, co
     return HAILO_SUCCESS;
 }
 
-Expected<Buffer> RpcConnection::read_message(rpc_message_header_t &header) {
+Expected<MemoryView> RpcConnection::read_message(rpc_message_header_t &header, Buffer &receive_buffer) {
     auto status = m_raw->read(reinterpret_cast<uint8_t*>(&header), sizeof(header));
     if (HAILO_COMMUNICATION_CLOSED == status) {
         return make_unexpected(status);
@@ -39,14 +56,16 @@ Expected<Buffer> RpcConnection::read_message(rpc_message_header_t &header) {
     CHECK_AS_EXPECTED(RPC_MESSAGE_MAGIC == header.magic, HAILO_INTERNAL_FAILURE, "Invalid magic! {} != {}",
         header.magic, RPC_MESSAGE_MAGIC);
 
-    TRY(auto buffer, Buffer::create(header.size, BufferStorageParams::create_dma()));
-    status = m_raw->read(buffer.data(), header.size);
+    if (receive_buffer.size() < header.size) {
+        TRY(receive_buffer, Buffer::create(header.size, BufferStorageParams::create_dma()));
+    }
+    status = m_raw->read(receive_buffer.data(), header.size);
     if (HAILO_COMMUNICATION_CLOSED == status) {
         return make_unexpected(status);
     }
     CHECK_SUCCESS_AS_EXPECTED(status);
 
-    return buffer;
+    return MemoryView(receive_buffer.data(), header.size);
 }
 
 hailo_status RpcConnection::write_buffer(const MemoryView &buffer)
@@ -71,6 +90,17 @@ hailo_status RpcConnection::read_buffer(MemoryView buffer)
     return HAILO_SUCCESS;
 }
 
+hailo_status RpcConnection::read_buffers(std::vector<MemoryView> &buffers)
+{
+    auto status = m_raw->readv(buffers.data(), buffers.size());
+    if (HAILO_COMMUNICATION_CLOSED == status) {
+        return make_unexpected(status);
+    }
+    CHECK_SUCCESS(status);
+
+    return HAILO_SUCCESS;
+}
+
 hailo_status RpcConnection::close()
 {
     if (m_raw) {
@@ -79,4 +109,4 @@ hailo_status RpcConnection::close()
     return HAILO_SUCCESS;
 }
 
-} // namespace hrpc
\ No newline at end of file
+} // namespace hrpc
@@ -16,6 +16,8 @@
 #include "common/utils.hpp"
 
 #define RPC_MESSAGE_MAGIC (0x8A554432)
+// Messages with more buffers are written in several writes
+#define RPC_MAX_BUFFERS_PER_WRITE (32)
 
 
 namespace hrpc
@@ -38,10 +40,16 @@ public:
     explicit RpcConnection(std::shared_ptr<RawConnection> raw) : m_raw(raw) {}
 
     hailo_status write_message(const rpc_message_header_t &header, const MemoryView &buffer);
-    Expected<Buffer> read_message(rpc_message_header_t &header);
+    // Writes the message followed by the buffers, together with the header in a single write when the connection allows
+    hailo_status write_message(const rpc_message_header_t &header, const MemoryView &buffer,
+        const std::vector<MemoryView> &buffers);
+    // Reads the message into receive_buffer, which is reallocated only if it is too small. Returns a view of the message,
+    // valid until receive_buffer is used again.
+    Expected<MemoryView> read_message(rpc_message_header_t &header, Buffer &receive_buffer);
 
     hailo_status write_buffer(const MemoryView &buffer);
     hailo_status read_buffer(MemoryView buffer);
+    hailo_status read_buffers(std::vector<MemoryView> &buffers);
 
     hailo_status close();
 
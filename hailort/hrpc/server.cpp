@@ -8,16 +8,45 @@
  **/
 
 #include "server.hpp"
+#include "common/os_utils.hpp"
 
 namespace hrpc
 {
 
-ServerContext::ServerContext(Server &server, RpcConnection connection) :
-    m_server(server), m_connection(connection) {}
+ServerContext::ServerContext(RpcConnection connection) :
+    m_connection(connection) {}
 
-hailo_status ServerContext::trigger_callback(uint32_t callback_id, hailo_status callback_status, std::function<hailo_status(RpcConnection)> write_buffers_callback)
+hailo_status ServerContext::trigger_callback(rpc_object_handle_t configured_infer_model_handle, uint32_t callback_id,
+    hailo_status callback_status, const std::vector<MemoryView> &buffers)
 {
-    return m_server.trigger_callback(callback_id, m_connection, callback_status, write_buffers_callback);
+    uint64_t buffers_size = 0;
+    for (const auto &buffer : buffers) {
+        buffers_size += buffer.size();
+    }
+
+    uint8_t reply_buffer[CallbackCalledSerializer::REPLY_SIZE];
+    TRY(auto reply, CallbackCalledSerializer::serialize_reply(callback_status, configured_infer_model_handle, callback_id,
+        buffers_size, MemoryView(reply_buffer, sizeof(reply_buffer))));
+
+    rpc_message_header_t header;
+    header.action_id = static_cast<uint32_t>(HailoRpcActionID::CALLBACK_CALLED);
+    header.message_id = callback_id;
+    header.size = static_cast<uint32_t>(reply.size());
+
+    auto status = write_message(header, reply, buffers);
+    if ((HAILO_COMMUNICATION_CLOSED == status) || (HAILO_FILE_OPERATION_FAILURE == status)) {
+        return status;
+    }
+    CHECK_SUCCESS(status);
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status ServerContext::write_message(const rpc_message_header_t &header, const MemoryView &message,
+    const std::vector<MemoryView> &buffers)
+{
+    std::unique_lock<std::mutex> lock(m_write_mutex);
+    return m_connection.write_message(header, message, buffers);
 }
 
 RpcConnection &ServerContext::connection()
@@ -42,9 +71,23 @@ Expected<Buffer> Dispatcher::call_action(HailoRpcActionID action_id, const Memor
 
 hailo_status Server::serve()
 {
+    TRY(auto server_connection, RawConnection::create_shared(m_connection_context));
     while (true) {
-        TRY(auto client_connection, create_client_connection());
-        auto th = std::thread([this, client_connection]() { serve_client(client_connection); });
+        TRY(auto conn, server_connection->accept());
+        RpcConnection client_connection(conn);
+        {
+            std::unique_lock<std::mutex> lock(m_connections_mutex);
+            m_connections_count++;
+        }
+
+        auto th = std::thread([this, client_connection]() {
+            OsUtils::set_current_thread_name("HRPC_SERVER");
+            auto status = serve_client(client_connection);
+            if (HAILO_SUCCESS != status) {
+                LOGGER__ERROR("Failed serving client connection, status = {}", status);
+            }
+            (void)on_client_disconnected(client_connection);
+        });
         th.detach();
     }
     return HAILO_SUCCESS;
@@ -55,69 +98,45 @@ void Server::set_dispatcher(Dispatcher dispatcher)
     m_dispatcher = dispatcher;
 }
 
-Expected<RpcConnection> Server::create_client_connection()
-{
-    TRY(auto server_connection, RawConnection::create_shared(m_connection_context));
-    TRY(auto conn, server_connection->accept());
-
-    return RpcConnection(conn);
-}
-
 hailo_status Server::serve_client(RpcConnection client_connection)
 {
-    auto server_context = make_shared_nothrow<ServerContext>(*this, client_connection);
+    auto server_context = make_shared_nothrow<ServerContext>(client_connection);
     CHECK_NOT_NULL(server_context, HAILO_OUT_OF_HOST_MEMORY);
+
+    // Requests are handled one at a time, so they are all read into the same buffer
+    Buffer receive_buffer;
     while (true) {
         rpc_message_header_t header;
-        auto request = client_connection.read_message(header);
+        auto request = client_connection.read_message(header, receive_buffer);
         if (HAILO_COMMUNICATION_CLOSED == request.status()) {
-            cleanup_client_resources(client_connection);
             break; // Client EP is disconnected, exit this loop
         }
         CHECK_EXPECTED_AS_STATUS(request);
 
         assert(header.action_id < static_cast<uint32_t>(HailoRpcActionID::MAX_VALUE));
-        TRY(auto reply, m_dispatcher.call_action(static_cast<HailoRpcActionID>(header.action_id), MemoryView(*request), server_context));
-        {
-            std::unique_lock<std::mutex> lock(m_write_mutex);
-            header.size = static_cast<uint32_t>(reply.size());
-
-            auto status = client_connection.write_message(header, MemoryView(reply));
-            if ((HAILO_COMMUNICATION_CLOSED == status) || (HAILO_FILE_OPERATION_FAILURE == status)) {
-                lock.unlock(); // We need to acquire this lock when releasing the client resources (trigger cb)
-                cleanup_client_resources(client_connection);
-                break; // Client EP is disconnected, exit this loop
-            }
-            CHECK_SUCCESS(status);
+        TRY(auto reply, m_dispatcher.call_action(static_cast<HailoRpcActionID>(header.action_id), request.value(), server_context));
+
+        header.size = static_cast<uint32_t>(reply.size());
+        auto status = server_context->write_message(header, MemoryView(reply));
+        if ((HAILO_COMMUNICATION_CLOSED == status) || (HAILO_FILE_OPERATION_FAILURE == status)) {
+            break; // Client EP is disconnected, exit this loop
         }
+        CHECK_SUCCESS(status);
     }
 
     return HAILO_SUCCESS;
 }
 
-hailo_status Server::trigger_callback(uint32_t callback_id, RpcConnection connection, hailo_status callback_status,
-    std::function<hailo_status(RpcConnection)> write_buffers_callback)
+hailo_status Server::on_client_disconnected(RpcConnection client_connection)
 {
-    TRY(auto reply, CallbackCalledSerializer::serialize_reply(callback_status, callback_id));
-
-    std::unique_lock<std::mutex> lock(m_write_mutex);
-    rpc_message_header_t header;
-    header.action_id = static_cast<uint32_t>(HailoRpcActionID::CALLBACK_CALLED);
-    header.message_id = callback_id;
-    header.size = static_cast<uint32_t>(reply.size());
-
-    auto status = connection.write_message(header, MemoryView(reply));
-    if ((HAILO_COMMUNICATION_CLOSED == status) || (HAILO_FILE_OPERATION_FAILURE == status)) {
-        return status;
-    }
-    CHECK_SUCCESS(status);
-
-    if (write_buffers_callback) {
-        status = write_buffers_callback(connection);
-        CHECK_SUCCESS(status);
+    std::unique_lock<std::mutex> lock(m_connections_mutex);
+    m_connections_count--;
+    if (0 != m_connections_count) {
+        // Other connections of the client are still open, and may still use its resources
+        return client_connection.close();
     }
 
-    return HAILO_SUCCESS;
+    return cleanup_client_resources(client_connection);
 }
 
 } // namespace hrpc
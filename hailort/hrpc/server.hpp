@@ -12,6 +12,7 @@
 
 #include <functional>
 #include <thread>
+#include <mutex>
 
 #include "rpc_connection.hpp"
 #include "hailort_service/service_resource_manager.hpp"
@@ -21,18 +22,22 @@
 namespace hrpc
 {
 
-class Server;
 class ServerContext
 {
 public:
-    ServerContext(Server &server, RpcConnection connection);
-    hailo_status trigger_callback(uint32_t callback_id, hailo_status callback_status,
-        std::function<hailo_status(RpcConnection)> write_buffers_callback = nullptr);
+    explicit ServerContext(RpcConnection connection);
+    // Sends the callback's reply followed by the buffers, in a single write, on the connection of this context
+    hailo_status trigger_callback(rpc_object_handle_t configured_infer_model_handle, uint32_t callback_id,
+        hailo_status callback_status, const std::vector<MemoryView> &buffers = {});
     RpcConnection &connection();
 
+    // Writes are serialized per connection, so the clients' connections don't wait for each other
+    hailo_status write_message(const rpc_message_header_t &header, const MemoryView &message,
+        const std::vector<MemoryView> &buffers = {});
+
 private:
-    Server &m_server;
     RpcConnection m_connection;
+    std::mutex m_write_mutex;
 };
 using ServerContextPtr = std::shared_ptr<ServerContext>;
 
@@ -59,18 +64,18 @@ public:
 
     void set_dispatcher(Dispatcher dispatcher);
 
-    friend class ServerContext;
 protected:
     std::shared_ptr<ConnectionContext> m_connection_context;
 private:
-    Expected<RpcConnection> create_client_connection();
+    // Each connection is served by a thread of its own
     hailo_status serve_client(RpcConnection client_connection);
-    hailo_status trigger_callback(uint32_t callback_id, RpcConnection connection, hailo_status callback_status,
-        std::function<hailo_status(RpcConnection)> write_buffers_callback = nullptr);
+    hailo_status on_client_disconnected(RpcConnection client_connection);
     virtual hailo_status cleanup_client_resources(RpcConnection client_connection) = 0;
 
     Dispatcher m_dispatcher;
-    std::mutex m_write_mutex;
+    // A client may open several connections, its resources are released only once all of them are closed
+    std::mutex m_connections_mutex;
+    uint32_t m_connections_count = 0;
 };
 
 } // namespace hrpc
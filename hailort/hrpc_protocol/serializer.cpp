@@ -13,6 +13,8 @@
 #include "hailo/hailort_defaults.hpp"
 #include "common/utils.hpp"
 
+#include <cstring>
+
 // https://github.com/protocolbuffers/protobuf/tree/master/cmake#notes-on-compiler-warnings
 #if defined(_MSC_VER)
 #pragma warning(push)
@@ -580,11 +582,21 @@ Expected<rpc_object_handle_t> GetHwLatencyMeasurementSerializer::deserialize_req
     return request.configured_infer_model_handle().id();
 }
 
-Expected<Buffer> GetHwLatencyMeasurementSerializer::serialize_reply(hailo_status status, uint32_t avg_hw_latency)
+Expected<Buffer> GetHwLatencyMeasurementSerializer::serialize_reply(hailo_status status,
+    const LatencyMeasurementResultExt &latency_result)
 {
     ConfiguredInferModel_GetHwLatencyMeasurement_Reply reply;
     reply.set_status(status);
-    reply.set_avg_hw_latency(avg_hw_latency);
+    if (HAILO_SUCCESS == status) {
+        reply.set_avg_hw_latency(static_cast<uint32_t>(latency_result.avg_hw_latency.count()));
+        reply.set_p50_hw_latency(static_cast<uint32_t>(latency_result.p50_hw_latency.count()));
+        reply.set_p95_hw_latency(static_cast<uint32_t>(latency_result.p95_hw_latency.count()));
+        reply.set_p99_hw_latency(static_cast<uint32_t>(latency_result.p99_hw_latency.count()));
+        reply.set_max_hw_latency(static_cast<uint32_t>(latency_result.max_hw_latency.count()));
+        reply.set_measured_frames_count(latency_result.measured_frames_count);
+    } else {
+        reply.set_avg_hw_latency(INVALID_LATENCY_MEASUREMENT);
+    }
 
     TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
 
@@ -594,14 +606,22 @@ Expected<Buffer> GetHwLatencyMeasurementSerializer::serialize_reply(hailo_status
     return serialized_reply;
 }
 
-Expected<std::tuple<hailo_status, std::chrono::nanoseconds>> GetHwLatencyMeasurementSerializer::deserialize_reply(const MemoryView &serialized_reply)
+Expected<std::tuple<hailo_status, LatencyMeasurementResultExt>> GetHwLatencyMeasurementSerializer::deserialize_reply(const MemoryView &serialized_reply)
 {
     ConfiguredInferModel_GetHwLatencyMeasurement_Reply reply;
 
     CHECK_AS_EXPECTED(reply.ParseFromArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
         HAILO_RPC_FAILED, "Failed to de-serialize 'GetHwLatencyMeasurement'");
 
-    return std::make_tuple(static_cast<hailo_status>(reply.status()), std::chrono::nanoseconds(reply.avg_hw_latency()));
+    LatencyMeasurementResultExt latency_result{
+        std::chrono::nanoseconds(reply.avg_hw_latency()),
+        std::chrono::nanoseconds(reply.p50_hw_latency()),
+        std::chrono::nanoseconds(reply.p95_hw_latency()),
+        std::chrono::nanoseconds(reply.p99_hw_latency()),
+        std::chrono::nanoseconds(reply.max_hw_latency()),
+        reply.measured_frames_count()
+    };
+    return std::make_tuple(static_cast<hailo_status>(reply.status()), latency_result);
 }
 
 Expected<Buffer> ActivateSerializer::serialize_request(rpc_object_handle_t configured_infer_model_handle)
@@ -748,87 +768,100 @@ hailo_status ShutdownSerializer::deserialize_reply(const MemoryView &serialized_
     return static_cast<hailo_status>(reply.status());
 }
 
-Expected<Buffer> RunAsyncSerializer::serialize_request(rpc_object_handle_t configured_infer_model_handle, rpc_object_handle_t infer_model_handle,
-    rpc_object_handle_t callback_handle)
+constexpr size_t RunAsyncSerializer::REQUEST_SIZE;
+constexpr size_t RunAsyncSerializer::REPLY_SIZE;
+constexpr size_t CallbackCalledSerializer::REPLY_SIZE;
+
+template<typename T>
+static Expected<T*> init_fixed_message(MemoryView buffer)
 {
-    ConfiguredInferModel_AsyncInfer_Request request;
+    CHECK_AS_EXPECTED(buffer.size() >= sizeof(T), HAILO_INSUFFICIENT_BUFFER,
+        "Buffer too small for message ({} < {})", buffer.size(), sizeof(T));
+    auto message = reinterpret_cast<T*>(buffer.data());
+    message->header.version = RPC_FIXED_MESSAGE_VERSION;
+    message->header.size = static_cast<uint32_t>(sizeof(T));
+    return message;
+}
 
-    auto proto_configured_infer_model_handle = request.mutable_configured_infer_model_handle();
-    proto_configured_infer_model_handle->set_id(configured_infer_model_handle);
+template<typename T>
+static Expected<T> parse_fixed_message(const MemoryView &serialized_message)
+{
+    CHECK_AS_EXPECTED(serialized_message.size() >= sizeof(rpc_fixed_message_header_t), HAILO_RPC_FAILED,
+        "Message too small ({} bytes)", serialized_message.size());
 
-    auto proto_infer_model_handle = request.mutable_infer_model_handle();
-    proto_infer_model_handle->set_id(infer_model_handle);
+    // The message isn't necessarily aligned
+    rpc_fixed_message_header_t header = {};
+    std::memcpy(&header, serialized_message.data(), sizeof(header));
+    CHECK_AS_EXPECTED(RPC_FIXED_MESSAGE_VERSION == header.version, HAILO_RPC_FAILED,
+        "Unsupported message version {} (expected {}), client and server versions may mismatch", header.version,
+        RPC_FIXED_MESSAGE_VERSION);
+    CHECK_AS_EXPECTED((sizeof(T) == header.size) && (serialized_message.size() >= sizeof(T)), HAILO_RPC_FAILED,
+        "Invalid message size {} (expected {})", header.size, sizeof(T));
 
-    auto proto_cb_handle = request.mutable_callback_handle();
-    proto_cb_handle->set_id(callback_handle);
+    T message = {};
+    std::memcpy(&message, serialized_message.data(), sizeof(message));
+    return message;
+}
 
-    // TODO (HRT-13983) - check if we can use GetCachedSize
-    TRY(auto serialized_request, Buffer::create(request.ByteSizeLong(), BufferStorageParams::create_dma()));
-    CHECK_AS_EXPECTED(request.SerializeToArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'RunAsync'");
+Expected<MemoryView> RunAsyncSerializer::serialize_request(rpc_object_handle_t configured_infer_model_handle, rpc_object_handle_t infer_model_handle,
+    rpc_object_handle_t callback_handle, MemoryView buffer)
+{
+    TRY(auto request, init_fixed_message<rpc_run_async_request_t>(buffer));
+    request->configured_infer_model_handle = configured_infer_model_handle;
+    request->infer_model_handle = infer_model_handle;
+    request->callback_handle = callback_handle;
 
-    return serialized_request;
+    return MemoryView(buffer.data(), sizeof(*request));
 }
 
 Expected<std::tuple<rpc_object_handle_t, rpc_object_handle_t, rpc_object_handle_t>> RunAsyncSerializer::deserialize_request(
     const MemoryView &serialized_request)
 {
-    ConfiguredInferModel_AsyncInfer_Request request;
-
-    CHECK_AS_EXPECTED(request.ParseFromArray(serialized_request.data(), static_cast<int>(serialized_request.size())),
-        HAILO_RPC_FAILED, "Failed to de-serialize 'RunAsync'");
-
-    return std::make_tuple(request.configured_infer_model_handle().id(), request.infer_model_handle().id(),
-        request.callback_handle().id());
+    TRY(auto request, parse_fixed_message<rpc_run_async_request_t>(serialized_request));
+    return std::make_tuple(request.configured_infer_model_handle, request.infer_model_handle, request.callback_handle);
 }
 
 Expected<Buffer> RunAsyncSerializer::serialize_reply(hailo_status status)
 {
-    ConfiguredInferModel_AsyncInfer_Reply reply;
-    reply.set_status(status);
-
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
-
-    CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'RunAsync'");
+    TRY(auto serialized_reply, Buffer::create(REPLY_SIZE));
+    auto reply_view = serialize_reply(status, MemoryView(serialized_reply));
+    CHECK_EXPECTED(reply_view);
 
     return serialized_reply;
 }
 
-hailo_status RunAsyncSerializer::deserialize_reply(const MemoryView &serialized_reply)
+Expected<MemoryView> RunAsyncSerializer::serialize_reply(hailo_status status, MemoryView buffer)
 {
-    ConfiguredInferModel_AsyncInfer_Reply reply;
+    TRY(auto reply, init_fixed_message<rpc_run_async_reply_t>(buffer));
+    reply->status = static_cast<uint32_t>(status);
 
-    CHECK(reply.ParseFromArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
-        HAILO_RPC_FAILED, "Failed to de-serialize 'RunAsync'");
-
-    return static_cast<hailo_status>(reply.status());
+    return MemoryView(buffer.data(), sizeof(*reply));
 }
 
-Expected<Buffer> CallbackCalledSerializer::serialize_reply(hailo_status status, rpc_object_handle_t callback_handle)
+hailo_status RunAsyncSerializer::deserialize_reply(const MemoryView &serialized_reply)
 {
-    CallbackCalled_Reply reply;
-
-    reply.set_status(status);
-    auto proto_callback_handle = reply.mutable_callback_handle();
-    proto_callback_handle->set_id(callback_handle);
-
-    TRY(auto serialized_reply, Buffer::create(reply.ByteSizeLong(), BufferStorageParams::create_dma()));
-
-    CHECK_AS_EXPECTED(reply.SerializeToArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
-        HAILO_RPC_FAILED, "Failed to serialize 'CallbackCalled'");
-
-    return serialized_reply;
+    TRY(auto reply, parse_fixed_message<rpc_run_async_reply_t>(serialized_reply));
+    return static_cast<hailo_status>(reply.status);
 }
 
-Expected<std::tuple<hailo_status, rpc_object_handle_t>> CallbackCalledSerializer::deserialize_reply(const MemoryView &serialized_reply)
+Expected<MemoryView> CallbackCalledSerializer::serialize_reply(hailo_status status, rpc_object_handle_t configured_infer_model_handle,
+    rpc_object_handle_t callback_handle, uint64_t buffers_size, MemoryView buffer)
 {
-    CallbackCalled_Reply reply;
+    TRY(auto reply, init_fixed_message<rpc_callback_called_reply_t>(buffer));
+    reply->status = static_cast<uint32_t>(status);
+    reply->configured_infer_model_handle = configured_infer_model_handle;
+    reply->callback_handle = callback_handle;
+    reply->buffers_size = buffers_size;
 
-    CHECK_AS_EXPECTED(reply.ParseFromArray(serialized_reply.data(), static_cast<int>(serialized_reply.size())),
-        HAILO_RPC_FAILED, "Failed to de-serialize 'CallbackCalled'");
+    return MemoryView(buffer.data(), sizeof(*reply));
+}
 
-    return std::make_tuple(static_cast<hailo_status>(reply.status()), reply.callback_handle().id());
+Expected<std::tuple<hailo_status, rpc_object_handle_t, rpc_object_handle_t, uint64_t>> CallbackCalledSerializer::deserialize_reply(
+    const MemoryView &serialized_reply)
+{
+    TRY(auto reply, parse_fixed_message<rpc_callback_called_reply_t>(serialized_reply));
+    return std::make_tuple(static_cast<hailo_status>(reply.status), reply.configured_infer_model_handle, reply.callback_handle,
+        reply.buffers_size);
 }
 
 } /* namespace hailort */
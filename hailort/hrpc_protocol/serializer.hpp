@@ -13,6 +13,7 @@
 #include "hailo/hailort.h"
 #include "hailo/buffer.hpp"
 #include "hailo/expected.hpp"
+#include "hailo/network_group.hpp"
 
 #include <chrono>
 #include <unordered_map>
@@ -185,8 +186,8 @@ public:
     static Expected<Buffer> serialize_request(rpc_object_handle_t configured_infer_model_handle);
     static Expected<rpc_object_handle_t> deserialize_request(const MemoryView &serialized_request);
 
-    static Expected<Buffer> serialize_reply(hailo_status status, uint32_t avg_hw_latency = INVALID_LATENCY_MEASUREMENT);
-    static Expected<std::tuple<hailo_status, std::chrono::nanoseconds>> deserialize_reply(const MemoryView &serialized_reply);
+    static Expected<Buffer> serialize_reply(hailo_status status, const LatencyMeasurementResultExt &latency_result = {});
+    static Expected<std::tuple<hailo_status, LatencyMeasurementResultExt>> deserialize_reply(const MemoryView &serialized_reply);
 };
 
 class ActivateSerializer
@@ -225,16 +226,65 @@ public:
     static hailo_status deserialize_reply(const MemoryView &serialized_reply);
 };
 
+/*
+ * The per-frame messages (RunAsync and CallbackCalled) are not encoded with protobuf, but as packed structs with a
+ * fixed layout, prefixed by a version and size header. They are serialized into buffers given by the caller
+ * (usually on the stack), so sending and receiving them takes no allocations.
+ * RPC_FIXED_MESSAGE_VERSION must be bumped on any change in these structs.
+ */
+#define RPC_FIXED_MESSAGE_VERSION (3)
+
+#pragma pack(push, 1)
+struct rpc_fixed_message_header_t
+{
+    uint32_t version;
+    uint32_t size; // Size of the whole message, including this header
+};
+
+struct rpc_run_async_request_t
+{
+    rpc_fixed_message_header_t header;
+    rpc_object_handle_t configured_infer_model_handle;
+    rpc_object_handle_t infer_model_handle;
+    rpc_object_handle_t callback_handle;
+    // Protocol note: After this message, server expects to get the input buffers, one after the other, in order
+};
+
+struct rpc_run_async_reply_t
+{
+    rpc_fixed_message_header_t header;
+    uint32_t status;
+};
+
+struct rpc_callback_called_reply_t
+{
+    rpc_fixed_message_header_t header;
+    uint32_t status;
+    // Several configured infer models may share a connection, their callbacks are told apart by this handle
+    rpc_object_handle_t configured_infer_model_handle;
+    rpc_object_handle_t callback_handle;
+    // Total size of the buffers following this message, so a client that no longer knows the callback can skip them
+    uint64_t buffers_size;
+    // Protocol note: After this message, and only if status is HAILO_SUCCESS, client expects to get the output buffers, one after the other, in order
+};
+#pragma pack(pop)
+
 class RunAsyncSerializer
 {
 public:
     RunAsyncSerializer() = delete;
 
-    static Expected<Buffer> serialize_request(rpc_object_handle_t configured_infer_model_handle, rpc_object_handle_t infer_model_handle,
-        rpc_object_handle_t callback_handle);
+    static constexpr size_t REQUEST_SIZE = sizeof(rpc_run_async_request_t);
+    static constexpr size_t REPLY_SIZE = sizeof(rpc_run_async_reply_t);
+
+    // Serializes into @a buffer (of at least REQUEST_SIZE bytes), returns a view of the serialized request
+    static Expected<MemoryView> serialize_request(rpc_object_handle_t configured_infer_model_handle, rpc_object_handle_t infer_model_handle,
+        rpc_object_handle_t callback_handle, MemoryView buffer);
     static Expected<std::tuple<rpc_object_handle_t, rpc_object_handle_t, rpc_object_handle_t>> deserialize_request(const MemoryView &serialized_request);
 
     static Expected<Buffer> serialize_reply(hailo_status status);
+    // Serializes into @a buffer (of at least REPLY_SIZE bytes), returns a view of the serialized reply
+    static Expected<MemoryView> serialize_reply(hailo_status status, MemoryView buffer);
     static hailo_status deserialize_reply(const MemoryView &serialized_reply);
 };
 
@@ -243,8 +293,14 @@ class CallbackCalledSerializer
 public:
     CallbackCalledSerializer() = delete;
 
-    static Expected<Buffer> serialize_reply(hailo_status status, rpc_object_handle_t callback_handle = INVALID_HANDLE_ID);
-    static Expected<std::tuple<hailo_status, rpc_object_handle_t>> deserialize_reply(const MemoryView &serialized_reply);
+    static constexpr size_t REPLY_SIZE = sizeof(rpc_callback_called_reply_t);
+
+    // Serializes into @a buffer (of at least REPLY_SIZE bytes), returns a view of the serialized reply
+    static Expected<MemoryView> serialize_reply(hailo_status status, rpc_object_handle_t configured_infer_model_handle,
+        rpc_object_handle_t callback_handle, uint64_t buffers_size, MemoryView buffer);
+    // Returns the status, the configured infer model handle, the callback handle and the size of the following buffers
+    static Expected<std::tuple<hailo_status, rpc_object_handle_t, rpc_object_handle_t, uint64_t>> deserialize_reply(
+        const MemoryView &serialized_reply);
 };
 
 
@@ -59,6 +59,8 @@ GType gst_hailo_format_type_get_type (void)
             { HAILO_FORMAT_TYPE_UINT8,    "uint8",    "HAILO_FORMAT_TYPE_UINT8"},
             { HAILO_FORMAT_TYPE_UINT16,   "uint16",   "HAILO_FORMAT_TYPE_UINT16"},
             { HAILO_FORMAT_TYPE_FLOAT32,  "float32",  "HAILO_FORMAT_TYPE_FLOAT32"},
+            { HAILO_FORMAT_TYPE_FLOAT16,  "float16",  "HAILO_FORMAT_TYPE_FLOAT16"},
+            { HAILO_FORMAT_TYPE_BFLOAT16, "bfloat16", "HAILO_FORMAT_TYPE_BFLOAT16"},
             { HAILO_FORMAT_TYPE_MAX_ENUM,  NULL,      NULL },
         };
 
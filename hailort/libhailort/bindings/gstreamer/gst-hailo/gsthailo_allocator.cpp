@@ -38,22 +38,54 @@ static GstMemory *gst_hailo_allocator_alloc(GstAllocator* allocator, gsize size,
         return nullptr;
     }
 
+    if (nullptr != hailo_allocator->vdevice) {
+        // The buffers are only written by the device
+        auto mapped_buffer = DmaMappedBuffer::create(*hailo_allocator->vdevice, buffer->data(), buffer->size(),
+            HAILO_DMA_BUFFER_DIRECTION_D2H);
+        if (mapped_buffer) {
+            hailo_allocator->mapped_buffers.emplace(memory, mapped_buffer.release());
+        } else {
+            // The buffer is still usable, it will just be mapped on each inference
+            g_warning("Mapping buffer for allocator has failed, status = %d", mapped_buffer.status());
+        }
+    }
+
     hailo_allocator->buffers[memory] = std::move(buffer.release());
     return memory;
 }
 
 static void gst_hailo_allocator_free(GstAllocator* allocator, GstMemory *mem) {
     GstHailoAllocator *hailo_allocator = GST_HAILO_ALLOCATOR(allocator);
+    // Unmapping before the buffer is released
+    hailo_allocator->mapped_buffers.erase(mem);
     hailo_allocator->buffers.erase(mem);
 }
 
+static void gst_hailo_allocator_finalize(GObject *object) {
+    GstHailoAllocator *hailo_allocator = GST_HAILO_ALLOCATOR(object);
+    hailo_allocator->mapped_buffers.clear();
+    hailo_allocator->buffers.clear();
+    hailo_allocator->vdevice.reset();
+
+    G_OBJECT_CLASS(gst_hailo_allocator_parent_class)->finalize(object);
+}
+
+void gst_hailo_allocator_set_vdevice(GstHailoAllocator *allocator, std::shared_ptr<VDevice> vdevice) {
+    allocator->vdevice = vdevice;
+}
+
 static void gst_hailo_allocator_class_init(GstHailoAllocatorClass* klass) {
+    GObjectClass *gobject_class = G_OBJECT_CLASS(klass);
     GstAllocatorClass* allocator_class = GST_ALLOCATOR_CLASS(klass);
 
+    gobject_class->finalize = gst_hailo_allocator_finalize;
+
     allocator_class->alloc = gst_hailo_allocator_alloc;
     allocator_class->free = gst_hailo_allocator_free;
 }
 
 static void gst_hailo_allocator_init(GstHailoAllocator* allocator) {
     allocator->buffers = std::unordered_map<GstMemory*, Buffer>();    
+    allocator->vdevice = nullptr;
+    allocator->mapped_buffers = std::unordered_map<GstMemory*, DmaMappedBuffer>();
 }
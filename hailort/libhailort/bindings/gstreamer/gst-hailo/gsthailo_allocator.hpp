@@ -21,6 +21,8 @@
 #define _GST_HAILO_ALLOCATOR_HPP_
 
 #include "common.hpp"
+#include "hailo/vdevice.hpp"
+#include "hailo/dma_mapped_buffer.hpp"
 
 using namespace hailort;
 
@@ -36,6 +38,10 @@ struct GstHailoAllocator
 {
     GstAllocator parent;
     std::unordered_map<GstMemory*, Buffer> buffers;
+    // When set, each allocated buffer is mapped to the vdevice once, so inferences writing to it skip the mapping.
+    // The vdevice is kept alive until all of the mapped buffers are freed.
+    std::shared_ptr<VDevice> vdevice;
+    std::unordered_map<GstMemory*, DmaMappedBuffer> mapped_buffers;
 };
 
 struct GstHailoAllocatorClass
@@ -45,6 +51,9 @@ struct GstHailoAllocatorClass
 
 GType gst_hailo_allocator_get_type(void);
 
+// Must be called before any memory is allocated
+void gst_hailo_allocator_set_vdevice(GstHailoAllocator *allocator, std::shared_ptr<VDevice> vdevice);
+
 G_END_DECLS
 
 #endif /* _GST_HAILO_ALLOCATOR_HPP_ */
\ No newline at end of file
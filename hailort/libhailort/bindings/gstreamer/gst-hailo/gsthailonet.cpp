@@ -25,8 +25,10 @@
 
 #include <algorithm>
 #include <unordered_map>
+#include <sstream>
 
 #define WAIT_FOR_ASYNC_READY_TIMEOUT (std::chrono::milliseconds(10000))
+#define WAIT_FOR_ONGOING_FRAMES_TIMEOUT (std::chrono::milliseconds(10000))
 
 enum
 {
@@ -53,6 +55,7 @@ enum
     PROP_MULTI_PROCESS_SERVICE,
     PROP_PASS_THROUGH,
     PROP_FORCE_WRITABLE,
+    PROP_SHARE_NETWORK,
 
     // Deprecated
     PROP_VDEVICE_KEY,
@@ -71,6 +74,24 @@ static bool gst_hailo_should_use_dma_buffers()
     return (nullptr != env) && (0 == g_strcmp0(env, "1"));
 }
 
+static void gst_hailonet_release_shared_infer_model(GstHailoNet *self)
+{
+    if (nullptr == self->shared_infer_model) {
+        return;
+    }
+
+    // The model outlives this hailonet when shared, so its frames won't be aborted by releasing it.
+    // Their callbacks reference this hailonet, so we wait for them to complete first.
+    std::unique_lock<std::mutex> lock(self->flush_mutex);
+    auto done = self->flush_cv.wait_for(lock, WAIT_FOR_ONGOING_FRAMES_TIMEOUT, [self] () {
+        return 0 == self->ongoing_frames;
+    });
+    if (!done) {
+        g_warning("Timeout waiting for %u ongoing frames of the shared network", self->ongoing_frames.load());
+    }
+    self->shared_infer_model.reset();
+}
+
 static hailo_status gst_hailonet_deconfigure(GstHailoNet *self)
 {
     // This will wakeup any blocking calls to deuque
@@ -79,6 +100,7 @@ static hailo_status gst_hailonet_deconfigure(GstHailoNet *self)
     }
 
     std::unique_lock<std::mutex> lock(self->infer_mutex);
+    gst_hailonet_release_shared_infer_model(self);
     self->configured_infer_model.reset();
     self->is_configured = false;
     return HAILO_SUCCESS;
@@ -95,15 +117,15 @@ static void gst_hailonet_unref_input_caps(GstHailoNet *self)
 static hailo_status gst_hailonet_free(GstHailoNet *self)
 {
     std::unique_lock<std::mutex> lock(self->infer_mutex);
+    gst_hailonet_release_shared_infer_model(self);
     self->configured_infer_model.reset();
     self->infer_model.reset();
     self->vdevice.reset();
 
-    {
-        std::unique_lock<std::mutex> lock(self->thread_queue_mutex);
-        self->is_thread_running = false;
+    self->is_thread_running = false;
+    if (nullptr != self->thread_queue) {
+        self->thread_queue->stop();
     }
-    self->thread_cv.notify_all();
 
     if (self->thread.joinable()) {
         self->thread.join();
@@ -113,9 +135,7 @@ static hailo_status gst_hailonet_free(GstHailoNet *self)
         gst_queue_array_free(self->input_queue);
     }
 
-    if (nullptr != self->thread_queue) {
-        gst_queue_array_free(self->thread_queue);
-    }
+    self->thread_queue.reset();
 
     while(!self->curr_event_queue.empty()) {
         auto event = self->curr_event_queue.front();
@@ -292,6 +312,67 @@ static void gst_hailonet_handle_buffer_events(GstHailoNet *self, GstBuffer *buff
     self->events_queue_per_buffer.erase(buffer);
 }
 
+static bool gst_hailonet_should_share_network(GstHailoNet *self)
+{
+    if (!self->props.m_share_network.get()) {
+        return false;
+    }
+
+    if (HAILO_SCHEDULING_ALGORITHM_NONE == self->props.m_scheduling_algorithm.get()) {
+        g_warning("share-network requires a scheduling-algorithm other than 'none', the network will not be shared!");
+        return false;
+    }
+
+    if (!self->props.m_vdevice_group_id.was_changed() && !self->props.m_vdevice_key.was_changed()) {
+        g_warning("share-network requires vdevice-group-id to be set, the network will not be shared!");
+        return false;
+    }
+
+    return true;
+}
+
+// Hailonets with the same configure string configure the same HEF identically over the same vdevice group,
+// so they can run their frames through a single ConfiguredInferModel.
+static std::string gst_hailonet_get_configure_string(GstHailoNet *self)
+{
+    std::ostringstream oss;
+
+    oss << self->infer_model->hef().hash() << ",";
+    if (self->props.m_vdevice_group_id.was_changed()) {
+        oss << self->props.m_vdevice_group_id.get() << ",";
+    } else {
+        oss << self->props.m_vdevice_key.get() << ",";
+    }
+    oss << self->props.m_device_id.get() << "," << self->props.m_device_count.get() << ",";
+    oss << self->props.m_multi_process_service.get() << ",";
+    oss << self->props.m_batch_size.get() << ",";
+    oss << self->props.m_input_format_type.get() << "," << self->props.m_output_format_type.get() << ",";
+    oss << self->props.m_nms_score_threshold.get() << "," << self->props.m_nms_iou_threshold.get() << ",";
+    oss << self->props.m_nms_max_proposals_per_class.get() << ",";
+    oss << self->props.m_input_from_meta.get() << "," << self->props.m_no_transform.get();
+
+    return oss.str();
+}
+
+// Called (under the config manager's lock) by the first hailonet configuring a shared network.
+// Its scheduler params apply to all of the hailonets sharing it.
+static Expected<std::shared_ptr<SharedConfiguredInferModel>> gst_hailonet_configure_shared_infer_model(GstHailoNet *self)
+{
+    auto shared_infer_model = make_shared_nothrow<SharedConfiguredInferModel>();
+    CHECK_AS_EXPECTED(nullptr != shared_infer_model, HAILO_OUT_OF_HOST_MEMORY);
+
+    TRY(auto configured_infer_model, self->infer_model->configure());
+    shared_infer_model->configured_infer_model = make_shared_nothrow<ConfiguredInferModel>(std::move(configured_infer_model));
+    CHECK_AS_EXPECTED(nullptr != shared_infer_model->configured_infer_model, HAILO_OUT_OF_HOST_MEMORY);
+
+    auto status = gst_hailonet_set_scheduler_params(self, shared_infer_model->configured_infer_model);
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
+    shared_infer_model->vdevice = self->vdevice;
+    shared_infer_model->infer_model = self->infer_model;
+    return shared_infer_model;
+}
+
 static hailo_status gst_hailonet_configure(GstHailoNet *self)
 {
     if (self->is_configured) {
@@ -329,6 +410,14 @@ static hailo_status gst_hailonet_configure(GstHailoNet *self)
         }
     }
 
+    if (gst_hailonet_should_share_network(self)) {
+        TRY(self->shared_infer_model, InferModelConfigManager::get_instance().get_or_configure(
+            gst_hailonet_get_configure_string(self), [self] () { return gst_hailonet_configure_shared_infer_model(self); }));
+        self->configured_infer_model = self->shared_infer_model->configured_infer_model;
+        self->is_configured = true;
+        return HAILO_SUCCESS;
+    }
+
     TRY(auto configured_infer_model, self->infer_model->configure());
 
     auto ptr = make_shared_nothrow<ConfiguredInferModel>(std::move(configured_infer_model));
@@ -354,6 +443,13 @@ static void gst_hailonet_init_allocator(GstHailoNet *self)
     } else {
         self->allocator = GST_HAILO_ALLOCATOR(g_object_new(GST_TYPE_HAILO_ALLOCATOR, "name", name, NULL));
         gst_object_ref_sink(self->allocator);
+
+        // The output buffers are recycled by their pools, so they are mapped to the device once instead of on every inference.
+        // Mapping is done on the vdevice running the model, which is another hailonet's vdevice when the network is shared.
+        if (!self->props.m_multi_process_service.get()) {
+            auto vdevice = (nullptr != self->shared_infer_model) ? self->shared_infer_model->vdevice : self->vdevice;
+            gst_hailo_allocator_set_vdevice(self->allocator, vdevice);
+        }
     }
 
     g_free(name);
@@ -368,24 +464,23 @@ static hailo_status gst_hailonet_allocate_infer_resources(GstHailoNet *self)
 
     TRY(const auto async_queue_size, self->configured_infer_model->get_async_queue_size());
     self->input_queue = gst_queue_array_new(static_cast<guint>(async_queue_size));
-    self->thread_queue = gst_queue_array_new(static_cast<guint>(async_queue_size));
+    // The outputs pool size limits the number of buffers waiting to be pushed (0 means unlimited)
+    const size_t max_buffers_in_thread_queue = (0 == self->props.m_outputs_max_pool_size.get()) ?
+        MAX_OUTPUTS_POOL_SIZE : self->props.m_outputs_max_pool_size.get();
+    self->thread_queue = make_unique_nothrow<OutputBufferQueue>(max_buffers_in_thread_queue);
+    CHECK_NOT_NULL(self->thread_queue, HAILO_OUT_OF_HOST_MEMORY);
     self->is_thread_running = true;
     self->thread = std::thread([self] () {
         while (self->is_thread_running) {
-            GstBuffer *buffer = nullptr;
-            {
-                std::unique_lock<std::mutex> lock(self->thread_queue_mutex);
-                self->thread_cv.wait(lock, [self] () {
-                    return (self->buffers_in_thread_queue > 0) || !self->is_thread_running;
-                });
-                if (!self->is_thread_running) {
-                    break;
-                }
-
-                buffer = static_cast<GstBuffer*>(gst_queue_array_pop_head(self->thread_queue));
-                self->buffers_in_thread_queue--;
+            GstBuffer *buffer = self->thread_queue->pop();
+            if (nullptr == buffer) {
+                break;
             }
-            self->thread_cv.notify_all();
+            if (!self->is_thread_running) {
+                gst_buffer_unref(buffer);
+                break;
+            }
+
             if (GST_IS_PAD(self->srcpad)) { // Checking because we fail here when exiting the application
                 GstFlowReturn ret = gst_pad_push(self->srcpad, buffer);
                 if ((GST_FLOW_OK != ret) && (GST_FLOW_FLUSHING != ret) && ((GST_FLOW_EOS != ret)) && (!self->has_got_eos)) {
@@ -579,6 +674,13 @@ static void gst_hailonet_set_property(GObject *object, guint property_id, const
     case PROP_FORCE_WRITABLE:
         self->props.m_should_force_writable = g_value_get_boolean(value);
         break;
+    case PROP_SHARE_NETWORK:
+        if (self->is_configured) {
+            g_warning("The network was already configured so changing the share-network property will not take place!");
+            break;
+        }
+        self->props.m_share_network = g_value_get_boolean(value);
+        break;
     case PROP_OUTPUTS_MIN_POOL_SIZE:
         if (self->is_configured) {
             g_warning("The network has already been configured, the output's minimum pool size cannot be changed!");
@@ -723,6 +825,9 @@ static void gst_hailonet_get_property(GObject *object, guint property_id, GValue
     case PROP_FORCE_WRITABLE:
         g_value_set_boolean(value, self->props.m_should_force_writable.get());
         break;
+    case PROP_SHARE_NETWORK:
+        g_value_set_boolean(value, self->props.m_share_network.get());
+        break;
     case PROP_OUTPUTS_MIN_POOL_SIZE:
         g_value_set_uint(value, self->props.m_outputs_min_pool_size.get());
         break;
@@ -839,6 +944,12 @@ static void gst_hailonet_class_init(GstHailoNetClass *klass)
             "But in some cases (when the buffer is marked as not shared - see gst_buffer_copy documentation), it will do a deep copy."
             "By default, the hailonet element will not force the input buffer to be writable and will raise an error when the buffer is read-only.", false,
         (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+    g_object_class_install_property(gobject_class, PROP_SHARE_NETWORK,
+        g_param_spec_boolean("share-network", "Share the configured network", "Controls whether hailonets running the same HEF share a single configured network, "
+            "so the scheduler batches their frames together instead of switching between duplicate networks. "
+            "Relevant only with 'scheduling-algorithm' different than HAILO_SCHEDULING_ALGORITHM_NONE and with 'vdevice-group-id' set. "
+            "The network is shared only between hailonets with the same network related properties, and the scheduler properties of the first one to configure it apply to all.", false,
+        (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
 
     g_object_class_install_property(gobject_class, PROP_SCHEDULING_ALGORITHM,
         g_param_spec_enum("scheduling-algorithm", "Scheduling policy for automatic network group switching", "Controls the Model Scheduler algorithm of HailoRT. "
@@ -910,17 +1021,10 @@ static void gst_hailonet_class_init(GstHailoNetClass *klass)
 
 static void gst_hailonet_push_buffer_to_thread(GstHailoNet *self, GstBuffer *buffer)
 {
-    {
-        std::unique_lock<std::mutex> lock(self->thread_queue_mutex);
-        self->thread_cv.wait(lock, [self] () {
-            bool is_unlimited_pool_not_empty = (self->props.m_outputs_max_pool_size.get() == 0) && (self->buffers_in_thread_queue < MAX_OUTPUTS_POOL_SIZE);
-            bool is_pool_empty = self->buffers_in_thread_queue < self->props.m_outputs_max_pool_size.get();
-            return is_unlimited_pool_not_empty || is_pool_empty;
-        });
-        gst_queue_array_push_tail(self->thread_queue, buffer);
-        self->buffers_in_thread_queue++;
-    }
-    self->thread_cv.notify_all();
+    if (!self->thread_queue->push(buffer)) {
+        // The element is being freed
+        gst_buffer_unref(buffer);
+    }
 }
 
 // TODO: This function should be refactored. It does many unrelated things and the user need to know that he should unmap the buffer
@@ -1087,6 +1191,11 @@ static hailo_status gst_hailonet_fill_single_input_binding(GstHailoNet *self, ha
 
 static hailo_status gst_hailonet_call_run_async(GstHailoNet *self, const std::unordered_map<std::string, TensorInfo> &tensors)
 {
+    std::unique_lock<std::mutex> shared_run_lock;
+    if (nullptr != self->shared_infer_model) {
+        shared_run_lock = std::unique_lock<std::mutex>(self->shared_infer_model->run_mutex);
+    }
+
     auto status = self->configured_infer_model->wait_for_async_ready(WAIT_FOR_ASYNC_READY_TIMEOUT);
     CHECK_SUCCESS(status);
 
@@ -1114,13 +1223,12 @@ static hailo_status gst_hailonet_call_run_async(GstHailoNet *self, const std::un
             gst_buffer_unref(info.buffer);
         }
 
-        {
-            std::unique_lock<std::mutex> lock(self->flush_mutex);
-            self->ongoing_frames--;
-        }
-        self->flush_cv.notify_all();
-
         gst_hailonet_push_buffer_to_thread(self, buffer);
+
+        // Last access to self - once ongoing_frames drops, the element may be torn down
+        std::unique_lock<std::mutex> lock(self->flush_mutex);
+        self->ongoing_frames--;
+        self->flush_cv.notify_all();
     }));
     job.detach();
 
@@ -1461,7 +1569,6 @@ static void gst_hailonet_init(GstHailoNet *self)
     self->thread_queue = nullptr;
     self->is_thread_running = false;
     self->has_got_eos = false;
-    self->buffers_in_thread_queue = 0;
     self->props = HailoNetProperties();
     self->vdevice = nullptr;
     self->is_configured = false;
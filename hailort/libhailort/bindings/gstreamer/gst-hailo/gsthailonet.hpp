@@ -32,6 +32,8 @@
 #include "common.hpp"
 #include "gsthailo_allocator.hpp"
 #include "gsthailo_dmabuf_allocator.hpp"
+#include "infer_model_config_manager.hpp"
+#include "output_buffer_queue.hpp"
 
 #include <queue>
 #include <condition_variable>
@@ -56,7 +58,7 @@ public:
         m_input_format_type(HAILO_FORMAT_TYPE_AUTO), m_output_format_type(HAILO_FORMAT_TYPE_AUTO),
         m_nms_score_threshold(0), m_nms_iou_threshold(0), m_nms_max_proposals_per_class(0), m_input_from_meta(false),
         m_no_transform(false), m_multi_process_service(HAILO_DEFAULT_MULTI_PROCESS_SERVICE), m_should_force_writable(false),
-        m_vdevice_key(DEFAULT_VDEVICE_KEY)
+        m_share_network(false), m_vdevice_key(DEFAULT_VDEVICE_KEY)
     {}
 
     HailoElemStringProperty m_hef_path;
@@ -81,6 +83,7 @@ public:
     HailoElemProperty<gboolean> m_no_transform;
     HailoElemProperty<gboolean> m_multi_process_service;
     HailoElemProperty<gboolean> m_should_force_writable;
+    HailoElemProperty<gboolean> m_share_network;
 
     // Deprecated
     HailoElemProperty<guint32> m_vdevice_key;
@@ -95,8 +98,7 @@ typedef struct _GstHailoNet {
     std::queue<GstEvent*> curr_event_queue;
     GstQueueArray *input_queue;
 
-    GstQueueArray *thread_queue;
-    std::atomic_uint32_t buffers_in_thread_queue;
+    std::unique_ptr<OutputBufferQueue> thread_queue;
     std::thread thread;
     HailoNetProperties props;
     GstCaps *input_caps;
@@ -105,9 +107,11 @@ typedef struct _GstHailoNet {
     std::mutex sink_probe_change_state_mutex;
     bool did_critical_failure_happen;
 
-    std::unique_ptr<VDevice> vdevice;
+    std::shared_ptr<VDevice> vdevice;
     std::shared_ptr<InferModel> infer_model;
     std::shared_ptr<ConfiguredInferModel> configured_infer_model;
+    // Set when the configured model is shared with other hailonets (see 'share-network')
+    std::shared_ptr<SharedConfiguredInferModel> shared_infer_model;
     ConfiguredInferModel::Bindings infer_bindings;
     bool is_configured;
     std::mutex infer_mutex;
@@ -126,8 +130,6 @@ typedef struct _GstHailoNet {
     std::unordered_map<std::string, hailo_vstream_info_t> output_vstream_infos;
 
     std::mutex input_queue_mutex;
-    std::mutex thread_queue_mutex;
-    std::condition_variable thread_cv;
 } GstHailoNet;
 
 typedef struct _GstHailoNetClass {
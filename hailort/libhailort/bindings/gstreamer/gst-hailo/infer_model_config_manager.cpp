@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2021-2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the LGPL 2.1 license (https://www.gnu.org/licenses/old-licenses/lgpl-2.1.txt)
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "infer_model_config_manager.hpp"
+
+
+InferModelConfigManager &InferModelConfigManager::get_instance()
+{
+    static InferModelConfigManager manager;
+    return manager;
+}
+
+Expected<std::shared_ptr<SharedConfiguredInferModel>> InferModelConfigManager::get_or_configure(const std::string &configure_string,
+    const ConfigureFunc &configure)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    auto found = m_configured_infer_models.find(configure_string);
+    if (found != m_configured_infer_models.end()) {
+        auto shared_infer_model = found->second.lock();
+        if (nullptr != shared_infer_model) {
+            return shared_infer_model;
+        }
+        // All of the hailonets using it were deconfigured
+        m_configured_infer_models.erase(found);
+    }
+
+    TRY(auto shared_infer_model, configure());
+    m_configured_infer_models[configure_string] = shared_infer_model;
+    return shared_infer_model;
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2021-2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the LGPL 2.1 license (https://www.gnu.org/licenses/old-licenses/lgpl-2.1.txt)
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+#ifndef _INFER_MODEL_CONFIG_MANAGER_HPP_
+#define _INFER_MODEL_CONFIG_MANAGER_HPP_
+
+#include "common.hpp"
+#include "hailo/vdevice.hpp"
+#include "hailo/infer_model.hpp"
+
+#include <functional>
+#include <unordered_map>
+#include <mutex>
+#include <string>
+
+using namespace hailort;
+
+// A ConfiguredInferModel shared by the hailonets running the same HEF with compatible properties over the same
+// vdevice group - so the scheduler sees a single core op, and frames of all of these hailonets are batched together.
+// Each hailonet still passes its own callback to run_async(), so results are routed back to the hailonet that sent them.
+struct SharedConfiguredInferModel final
+{
+    // The VDevice and InferModel the model was configured with, kept alive as long as any hailonet uses the model
+    std::shared_ptr<VDevice> vdevice;
+    std::shared_ptr<InferModel> infer_model;
+    std::shared_ptr<ConfiguredInferModel> configured_infer_model;
+
+    // Taken around wait_for_async_ready() and run_async(), so a single free slot isn't claimed by two hailonets
+    std::mutex run_mutex;
+};
+
+class InferModelConfigManager final
+{
+public:
+    using ConfigureFunc = std::function<Expected<std::shared_ptr<SharedConfiguredInferModel>>()>;
+
+    static InferModelConfigManager &get_instance();
+
+    // Returns the model configured under @a configure_string by another hailonet, or configures it using @a configure
+    Expected<std::shared_ptr<SharedConfiguredInferModel>> get_or_configure(const std::string &configure_string,
+        const ConfigureFunc &configure);
+
+private:
+    InferModelConfigManager() : m_configured_infer_models() {}
+
+    std::unordered_map<std::string, std::weak_ptr<SharedConfiguredInferModel>> m_configured_infer_models;
+    std::mutex m_mutex;
+};
+
+#endif /* _INFER_MODEL_CONFIG_MANAGER_HPP_ */
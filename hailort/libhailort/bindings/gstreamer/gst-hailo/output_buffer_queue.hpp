@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2021-2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the LGPL 2.1 license (https://www.gnu.org/licenses/old-licenses/lgpl-2.1.txt)
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+#ifndef _GST_HAILO_OUTPUT_BUFFER_QUEUE_HPP_
+#define _GST_HAILO_OUTPUT_BUFFER_QUEUE_HPP_
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#include <gst/gst.h>
+#pragma GCC diagnostic pop
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+// Bounded queue of the buffers pushed out of hailonet by its src pad thread.
+// Pushing and popping are lock-free (each slot carries a sequence number, so pushing is safe from both the inference
+// completion callbacks and the pass-through path), and the mutex is only taken to park a side that has to wait -
+// the consumer on an empty queue, or a producer on a full one.
+class OutputBufferQueue final
+{
+public:
+    explicit OutputBufferQueue(size_t max_size) :
+        m_slots(get_capacity(max_size)), m_mask(m_slots.size() - 1), m_max_size(max_size),
+        m_push_index(0), m_pop_index(0), m_is_stopped(false), m_is_consumer_waiting(false), m_waiting_producers(0)
+    {
+        for (size_t i = 0; i < m_slots.size(); i++) {
+            m_slots[i].sequence.store(i, std::memory_order_relaxed);
+            m_slots[i].buffer = nullptr;
+        }
+    }
+
+    OutputBufferQueue(const OutputBufferQueue &other) = delete;
+    OutputBufferQueue &operator=(const OutputBufferQueue &other) = delete;
+
+    // Blocks while the queue holds max_size buffers. Returns false if the queue was stopped.
+    bool push(GstBuffer *buffer)
+    {
+        while (!try_push(buffer)) {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_waiting_producers++;
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            m_cv.wait(lock, [this] () { return !is_full() || m_is_stopped; });
+            m_waiting_producers--;
+            if (m_is_stopped) {
+                return false;
+            }
+        }
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_is_consumer_waiting.load(std::memory_order_relaxed)) {
+            wake_up();
+        }
+        return true;
+    }
+
+    // Blocks until a buffer is pushed. Must be called from a single thread. Returns nullptr if the queue was stopped.
+    GstBuffer *pop()
+    {
+        GstBuffer *buffer = nullptr;
+        while (!try_pop(buffer)) {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_is_consumer_waiting.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            m_cv.wait(lock, [this] () { return !is_empty() || m_is_stopped; });
+            m_is_consumer_waiting.store(false, std::memory_order_relaxed);
+            if (m_is_stopped) {
+                return nullptr;
+            }
+        }
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (0 != m_waiting_producers.load(std::memory_order_relaxed)) {
+            wake_up();
+        }
+        return buffer;
+    }
+
+    // Wakes up all waiting threads. Buffers left in the queue are not released.
+    void stop()
+    {
+        m_is_stopped = true;
+        wake_up();
+    }
+
+private:
+    struct Slot {
+        std::atomic<size_t> sequence;
+        GstBuffer *buffer;
+    };
+
+    static size_t get_capacity(size_t max_size)
+    {
+        size_t capacity = 1;
+        while (capacity < max_size) {
+            capacity <<= 1;
+        }
+        return capacity;
+    }
+
+    bool is_full() const
+    {
+        return (m_push_index.load(std::memory_order_acquire) - m_pop_index.load(std::memory_order_acquire)) >= m_max_size;
+    }
+
+    bool is_empty() const
+    {
+        const auto pop_index = m_pop_index.load(std::memory_order_relaxed);
+        return m_slots[pop_index & m_mask].sequence.load(std::memory_order_acquire) != (pop_index + 1);
+    }
+
+    bool try_push(GstBuffer *buffer)
+    {
+        auto push_index = m_push_index.load(std::memory_order_relaxed);
+        while (true) {
+            if ((push_index - m_pop_index.load(std::memory_order_acquire)) >= m_max_size) {
+                return false;
+            }
+
+            auto &slot = m_slots[push_index & m_mask];
+            const auto sequence = slot.sequence.load(std::memory_order_acquire);
+            if (sequence == push_index) {
+                if (m_push_index.compare_exchange_weak(push_index, push_index + 1, std::memory_order_relaxed)) {
+                    slot.buffer = buffer;
+                    slot.sequence.store(push_index + 1, std::memory_order_release);
+                    return true;
+                }
+                // push_index was reloaded by the failed exchange
+            } else if (sequence < push_index) {
+                // The slot wasn't popped yet
+                return false;
+            } else {
+                push_index = m_push_index.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool try_pop(GstBuffer *&buffer)
+    {
+        const auto pop_index = m_pop_index.load(std::memory_order_relaxed);
+        auto &slot = m_slots[pop_index & m_mask];
+        if (slot.sequence.load(std::memory_order_acquire) != (pop_index + 1)) {
+            return false;
+        }
+
+        buffer = slot.buffer;
+        slot.sequence.store(pop_index + m_slots.size(), std::memory_order_release);
+        m_pop_index.store(pop_index + 1, std::memory_order_release);
+        return true;
+    }
+
+    void wake_up()
+    {
+        {
+            // Taking the lock makes sure a thread that is about to wait has either seen the change or is waiting
+            std::lock_guard<std::mutex> lock(m_mutex);
+        }
+        m_cv.notify_all();
+    }
+
+    std::vector<Slot> m_slots;
+    const size_t m_mask;
+    const size_t m_max_size;
+    std::atomic<size_t> m_push_index;
+    std::atomic<size_t> m_pop_index;
+    std::atomic_bool m_is_stopped;
+    std::atomic_bool m_is_consumer_waiting;
+    std::atomic_uint32_t m_waiting_producers;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+};
+
+#endif /* _GST_HAILO_OUTPUT_BUFFER_QUEUE_HPP_ */
@@ -1,4 +1,5 @@
 from enum import Enum, IntEnum
+import asyncio
 import signal
 import struct
 
@@ -162,6 +163,23 @@ def get_status_message(status_code):
     return status_str
 
 
+def set_thread_policy(thread_policy):
+    """
+    Sets the CPU affinity and scheduling policies of HailoRT's threads in this process. The policies apply to threads
+    created after the call, of every VDevice in the process.
+
+    Args:
+        thread_policy (str): The policies, as a list of ``<thread role> [cpus=<list>] [policy=other|fifo|rr]
+            [priority=<1-99>] [nice=<-20-19>]`` entries separated by ';', e.g.
+            ``"CHANNEL_INTR cpus=2 policy=fifo priority=50; * cpus=0-1"``. A role ending with '*' matches all roles
+            with the given prefix. The policies override the ones given by the HAILO_THREAD_POLICY or
+            HAILO_THREAD_POLICY_FILE environment variables, and replace the ones given by a previous call. An empty
+            string leaves only the environment variables' policies.
+    """
+    with ExceptionWrapper():
+        _pyhailort.set_thread_policy(thread_policy)
+
+
 class HailoUdpScan(object):
     def __init__(self):
         self._logger = default_logger()
@@ -753,6 +771,21 @@ class ConfiguredNetwork(object):
         """
         return self._configured_network.set_scheduler_priority(priority)
 
+    def get_latency_measurement(self, network_name=""):
+        """Returns the hw latency of the network (only available if latency measurement was enabled).
+            If `HAILO_LATENCY_CLEAR_AFTER_GET` was set, each call returns only the frames measured since the previous call.
+
+        Args:
+            network_name (str, optional): Network name of the requested latency measurement. If not passed, all the
+                networks in the network group are addressed.
+
+        Returns:
+            :class:`LatencyMeasurementResult`: The average, p50, p95, p99 and max hw latency (in milliseconds) and the
+            number of frames measured.
+        """
+        with ExceptionWrapper():
+            return self._configured_network.get_latency_measurement(network_name)
+
     def init_cache(self, read_offset, write_offset_delta):
         return self._configured_network.init_cache(read_offset, write_offset_delta)
 
@@ -1234,13 +1267,11 @@ class HailoRTTransformUtils(object):
     @staticmethod
     def output_raw_buffer_to_nms_tf_format_single_frame(raw_output_buffer, converted_output_frame, number_of_classes,
         max_bboxes_per_class, quantized_empty_bbox, offset=0):
-        for class_i in range(number_of_classes):
-            class_bboxes_amount = int(raw_output_buffer[offset])
-            offset += 1
-            if 0 != class_bboxes_amount:
-                converted_output_frame[class_i][ : class_bboxes_amount][:] = raw_output_buffer[offset : offset + (BBOX_PARAMS * class_bboxes_amount)].reshape(class_bboxes_amount, BBOX_PARAMS)
-                offset += BBOX_PARAMS * class_bboxes_amount
-            converted_output_frame[class_i][class_bboxes_amount : max_bboxes_per_class][:] = quantized_empty_bbox
+        dtype = converted_output_frame.dtype
+        raw_output_buffer = numpy.ascontiguousarray(raw_output_buffer, dtype=dtype)
+        empty_bbox = numpy.ascontiguousarray(numpy.broadcast_to(quantized_empty_bbox, [BBOX_PARAMS]), dtype=dtype)
+        _pyhailort.convert_nms_buffer_to_tf_format(raw_output_buffer, converted_output_frame,
+            HailoRTTransformUtils._get_format_type(dtype), number_of_classes, max_bboxes_per_class, empty_bbox, offset)
 
     @staticmethod
     def output_raw_buffer_to_nms_format(raw_output_buffer, number_of_classes):
@@ -1251,17 +1282,9 @@ class HailoRTTransformUtils(object):
 
     @staticmethod
     def output_raw_buffer_to_nms_format_single_frame(raw_output_buffer, number_of_classes, offset=0):
-        converted_output_frame = []
-        for class_i in range(number_of_classes):
-            class_bboxes_amount = int(raw_output_buffer[offset])
-            offset += 1
-            if class_bboxes_amount == 0:
-                converted_output_frame.append(numpy.empty([0, BBOX_PARAMS]))
-            else:
-                converted_output_frame.append(raw_output_buffer[offset : offset + (BBOX_PARAMS * class_bboxes_amount)].reshape(
-                    class_bboxes_amount, BBOX_PARAMS))
-                offset += BBOX_PARAMS * class_bboxes_amount
-        return converted_output_frame
+        raw_output_buffer = numpy.ascontiguousarray(raw_output_buffer)
+        return _pyhailort.convert_nms_buffer_to_hailo_format(raw_output_buffer,
+            HailoRTTransformUtils._get_format_type(raw_output_buffer.dtype), number_of_classes, offset)
 
     @staticmethod
     def _output_raw_buffer_to_nms_with_byte_mask_format(raw_output_buffer, number_of_classes, batch_size, image_height, image_width,
@@ -1311,36 +1334,9 @@ class HailoRTTransformUtils(object):
     @staticmethod
     def _output_raw_buffer_to_nms_with_byte_mask_tf_format_single_frame(raw_output_buffer, converted_output_frame, number_of_classes,
         max_boxes, image_height, image_width):
-
-        detections = _pyhailort.convert_nms_with_byte_mask_buffer_to_detections(raw_output_buffer)
-        bbox_idx = 0
-        for detection in detections:
-            if (bbox_idx >= max_boxes):
-                return
-            bbox = numpy.array([detection.box.y_min, detection.box.x_min, detection.box.y_max, detection.box.x_max,
-                    detection.score, detection.class_id])
-            bbox_mask = detection.mask()
-
-            y_min = numpy.ceil(bbox[0] * image_height)
-            x_min = numpy.ceil(bbox[1] * image_width)
-            bbox_width = numpy.ceil((bbox[3] - bbox[1]) * image_width)
-            resized_mask = numpy.zeros(image_height*image_width, dtype="uint8")
-
-            for i in range(bbox_mask.size):
-                if (bbox_mask[i] == 1):
-                    x = int(x_min + (i % bbox_width))
-                    y = int(y_min + (i // bbox_width))
-                    if (x >= image_width):
-                        x = image_width - 1
-                    if ( y >= image_height):
-                        y = image_height - 1
-                    idx = (image_width * y) + x
-                    resized_mask[idx] = 1
-
-            bbox_with_mask = numpy.append(bbox, resized_mask)
-            converted_output_frame[bbox_idx] = bbox_with_mask
-            bbox_idx += 1
-
+        _pyhailort.convert_nms_with_byte_mask_buffer_to_tf_format(numpy.ascontiguousarray(raw_output_buffer),
+            converted_output_frame, HailoRTTransformUtils._get_format_type(converted_output_frame.dtype), max_boxes,
+            image_height, image_width)
 
     @staticmethod
     def _get_format_type(dtype):
@@ -1350,6 +1346,8 @@ class HailoRTTransformUtils(object):
             return FormatType.UINT16
         elif dtype == numpy.float32:
             return FormatType.FLOAT32
+        elif dtype == numpy.float16:
+            return FormatType.FLOAT16
         raise HailoRTException("unsupported data type {}".format(dtype))
 
 # TODO: HRT-10427 - Remove
@@ -2818,6 +2816,18 @@ class InferModel:
         with ExceptionWrapper():
             self._infer_model.set_power_mode(power_mode)
 
+    def set_hw_latency_measurement_flags(self, latency):
+        """
+        Sets the hw latency measurement flags of the InferModel. The measurement is queried using
+        :func:`ConfiguredInferModel.get_hw_latency_measurement`.
+
+        Args:
+            latency (_pyhailort.LatencyMeasurementFlags): The latency measurement flags to set. Flags may be combined,
+                e.g. `LatencyMeasurementFlags.MEASURE | LatencyMeasurementFlags.CLEAR_AFTER_GET`.
+        """
+        with ExceptionWrapper():
+            self._infer_model.set_hw_latency_measurement_flags(_pyhailort.LatencyMeasurementFlags(int(latency)))
+
     def configure(self):
         """
         Configures the InferModel object. Also checks the validity of the configuration's formats.
@@ -3146,6 +3156,7 @@ class ConfiguredInferModel:
         self._output_names = infer_model.output_names
         self._infer_model = infer_model
         self._buffer_guards = deque()
+        self._asyncio_dispatcher = None
 
     def __enter__(self):
         return self
@@ -3286,6 +3297,118 @@ class ConfiguredInferModel:
         job = AsyncInferJob(cpp_job)
         return job
 
+    def run_async_batch(self, input_buffers, output_buffers, completion_queue, timeout_ms=1000):
+        """
+        Launches an asynchronous inference operation per frame of the given stacked buffers, in a single call.
+        Unlike :func:`ConfiguredInferModel.run_async`, no python code runs per frame - the frames are launched with the
+        GIL released, and their completions are collected by the given completion queue, to be drained in bulk.
+
+        Args:
+            input_buffers (dict[str: numpy.array or list of numpy.array]): Keys are the input names, and values are
+                the frames, either stacked along the first axis of a single buffer or given as a list.
+            output_buffers (dict[str: numpy.array]): Keys are the output names, and values are C-contiguous buffers
+                for the frames, stacked along their first axis.
+            completion_queue (:class:`AsyncInferCompletionQueue`): The queue the frames' completions are pushed to.
+                The buffers are kept alive by the queue until all of their frames are drained.
+            timeout_ms (int, optional): Amount of time to wait until the model is ready for each frame, in milliseconds.
+
+        Returns:
+            range: The ids of the launched frames, as reported by :func:`AsyncInferCompletionQueue.drain`.
+
+        Raises:
+            :class:`HailoRTTimeout` in case the model was not ready for a frame in the given timeout. Frames launched
+            before it still complete through the completion queue.
+            :class:`HailoRTException` in case of an error.
+        """
+        input_buffers = {name: numpy.ascontiguousarray(buffer if isinstance(buffer, numpy.ndarray) else numpy.stack(buffer))
+            for name, buffer in input_buffers.items()}
+        for name, buffer in output_buffers.items():
+            if not isinstance(buffer, numpy.ndarray) or not buffer.flags.c_contiguous:
+                raise HailoRTInvalidArgumentException(
+                    f"Output buffer of {name} must be a C-contiguous numpy array, stacked along its first axis")
+
+        frames_count = len(next(iter(input_buffers.values()))) if input_buffers else len(next(iter(output_buffers.values())))
+        with ExceptionWrapper():
+            first_frame_id = self._configured_infer_model.run_async_batch(input_buffers, output_buffers,
+                completion_queue._queue, timedelta(milliseconds=timeout_ms))
+        return range(first_frame_id, first_frame_id + frames_count)
+
+    async def infer_async(self, bindings, timeout_ms=1000):
+        """
+        Runs an asynchronous inference with the provided bindings, as a coroutine of the running asyncio event loop.
+        The frames of all of the bindings are launched together by a single :func:`ConfiguredInferModel.run_async_batch`
+        call, and their completions are signaled through a file descriptor watched by the event loop. All of the
+        completions available on a wake-up are delivered at once, so a single-threaded asyncio application can keep
+        many frames in flight.
+
+        Args:
+            bindings (:obj:`ConfiguredInferModel.Bindings` or list of :obj:`ConfiguredInferModel.Bindings`): The bindings
+                for the inputs and outputs of the model, a frame per bindings. Their buffers must be C-contiguous.
+            timeout_ms (int, optional): Amount of time to wait until the model is ready for each frame, in milliseconds.
+                Waiting happens only if the model is also fed from outside of this event loop, as frames are launched
+                only after frames of this event loop complete once the model's async queue is full.
+
+        Note:
+            The output buffers of the bindings are filled once the coroutine completes. Frames of multiple bindings are
+            stacked into a single batch, and their outputs are copied back to the bindings' buffers. More bindings than
+            the model's async queue size (see :func:`ConfiguredInferModel.get_async_queue_size`) are launched in batches
+            of that size.
+            Cancelling the coroutine, or failing to launch a batch, cancels the batches already launched: their frames
+            still run, and their buffers are kept alive until they complete, but their results are dropped.
+            Not supported on Windows.
+
+        Raises:
+            :class:`HailoRTException` in case of an error, either launching a batch or reported by a frame's completion.
+        """
+        loop = asyncio.get_running_loop()
+        dispatcher = self._get_asyncio_dispatcher(loop)
+        bindings = list(bindings) if isinstance(bindings, (list, tuple)) else [bindings]
+
+        launched_batches = []
+        try:
+            for first_index in range(0, len(bindings), dispatcher.max_in_flight_count):
+                batch_bindings = bindings[first_index:first_index + dispatcher.max_in_flight_count]
+                input_buffers = {name: self._get_stacked_buffer([b.input(name).get_buffer() for b in batch_bindings], name)
+                    for name in self._input_names}
+                output_buffers = {name: self._get_stacked_buffer([b.output(name).get_buffer(None) for b in batch_bindings], name)
+                    for name in self._output_names}
+
+                # The event loop must not block on a full async queue, so wait for the frames of this loop to complete
+                while dispatcher.in_flight_count + len(batch_bindings) > dispatcher.max_in_flight_count:
+                    await dispatcher.wait_for_completions()
+                future = dispatcher.launch(self, input_buffers, output_buffers, timeout_ms)
+                launched_batches.append((batch_bindings, output_buffers, future))
+
+            await asyncio.gather(*[future for _, _, future in launched_batches])
+        except BaseException:
+            for _, _, future in launched_batches:
+                future.cancel()
+            raise
+
+        for batch_bindings, output_buffers, _ in launched_batches:
+            if len(batch_bindings) == 1:
+                continue # The output buffers are views of the bindings' buffers
+            for name, stacked_buffer in output_buffers.items():
+                for binding, frame in zip(batch_bindings, stacked_buffer):
+                    binding.output(name).get_buffer(None)[...] = frame
+
+    def _get_asyncio_dispatcher(self, loop):
+        if (self._asyncio_dispatcher is None) or (self._asyncio_dispatcher.loop is not loop):
+            if (self._asyncio_dispatcher is not None) and (self._asyncio_dispatcher.in_flight_count > 0):
+                raise HailoRTInvalidOperationException(
+                    "infer_async cannot be used from another event loop while frames of a previous loop are in flight")
+            self._asyncio_dispatcher = _AsyncioInferDispatcher(loop, self.get_async_queue_size())
+        return self._asyncio_dispatcher
+
+    @staticmethod
+    def _get_stacked_buffer(buffers, name):
+        if not all(isinstance(buffer, numpy.ndarray) for buffer in buffers):
+            raise HailoRTInvalidArgumentException(f"The buffer of {name} was not set")
+        if len(buffers) == 1:
+            # A view of the frame as a batch of a single frame, see run_async_batch
+            return buffers[0][numpy.newaxis]
+        return numpy.stack(buffers)
+
     def set_scheduler_timeout(self, timeout_ms):
         """
         Sets the minimum number of send requests required before the network is considered ready to get run time from the scheduler.
@@ -3355,6 +3478,21 @@ class ConfiguredInferModel:
         with ExceptionWrapper():
             return self._configured_infer_model.get_async_queue_size()
 
+    def get_hw_latency_measurement(self):
+        """
+        Returns the hw latency of the model (only available if latency measurement was enabled using
+        :func:`InferModel.set_hw_latency_measurement_flags`).
+
+        Returns:
+            :class:`LatencyMeasurementResult`: The average, p50, p95, p99 and max hw latency (in milliseconds) and the
+            number of frames measured.
+
+        Raises:
+            :class:`HailoRTException` in case of an error, or if no frame was measured yet.
+        """
+        with ExceptionWrapper():
+            return self._configured_infer_model.get_hw_latency_measurement()
+
     def shutdown(self):
         """
         Shuts the inference down. After calling this method, the model is no longer usable.
@@ -3433,6 +3571,127 @@ class AsyncInferJob:
             self._job.wait(timedelta(milliseconds=timeout_ms))
 
 
+class AsyncInferCompletionQueue:
+    """
+    Collects the completions of frames launched by :func:`ConfiguredInferModel.run_async_batch`.
+    Completions are collected natively, without taking the GIL, and are drained in bulk.
+    Deleting the queue waits for the frames that are still running, as their buffers are in use by the device.
+    """
+
+    def __init__(self):
+        self._queue = _pyhailort.AsyncInferCompletionQueue()
+
+    def drain(self, max_count=0, timeout_ms=1000):
+        """
+        Waits for completed frames, and returns them.
+
+        Args:
+            max_count (int, optional): The maximum number of completions to return. 0 (default) returns all of the
+                completions available.
+            timeout_ms (int, optional): The maximum time to wait for a first completion, in milliseconds.
+
+        Returns:
+            list of (int, int): Pairs of frame id and status. A status of 0 means the frame completed successfully,
+            otherwise it is the error's hailo_status code. An empty list is returned if no frame completed in the
+            given timeout.
+
+        Note:
+            The buffers of a batch are released once all of its frames are drained.
+        """
+        with ExceptionWrapper():
+            return self._queue.drain(max_count, timedelta(milliseconds=timeout_ms))
+
+    @property
+    def pending_frames_count(self):
+        """
+        The number of launched frames that were not drained yet.
+        """
+        return self._queue.pending_frames_count()
+
+    def fileno(self):
+        """
+        Gets a file descriptor that is readable while there are completions to drain. It is signaled once until the
+        queue is drained empty, so event loops (e.g. asyncio's ``add_reader``) wake up once per burst of completions.
+        The file descriptor is owned by the queue, and must not be read nor closed by the caller.
+
+        Returns:
+            int: The file descriptor.
+
+        Raises:
+            :class:`HailoRTException` in case of an error, or if not supported on the current platform (Windows).
+        """
+        with ExceptionWrapper():
+            return self._queue.fileno()
+
+
+class _AsyncioInferBatch:
+    """
+    The frames launched by a single :func:`_AsyncioInferDispatcher.launch`, resolved together once all of them complete.
+    """
+
+    def __init__(self, future, frames_count):
+        self.future = future
+        self.remaining_frames_count = frames_count
+        self.status = 0
+
+
+class _AsyncioInferDispatcher:
+    """
+    Resolves the futures of the batches launched by :func:`ConfiguredInferModel.infer_async` on an event loop.
+    The completion queue's file descriptor is watched while frames are in flight, and each wake-up drains all of the
+    available completions at once.
+    """
+
+    def __init__(self, loop, max_in_flight_count):
+        self.loop = loop
+        self.max_in_flight_count = max(1, max_in_flight_count)
+        self._completion_queue = AsyncInferCompletionQueue()
+        self._fd = self._completion_queue.fileno()
+        self._batches = {} # The batch of each in flight frame, by frame id
+        self._is_reading = False
+        self._completed_event = asyncio.Event()
+
+    @property
+    def in_flight_count(self):
+        return len(self._batches)
+
+    def launch(self, configured_infer_model, input_buffers, output_buffers, timeout_ms):
+        frame_ids = configured_infer_model.run_async_batch(input_buffers, output_buffers, self._completion_queue,
+            timeout_ms)
+        batch = _AsyncioInferBatch(self.loop.create_future(), len(frame_ids))
+        for frame_id in frame_ids:
+            self._batches[frame_id] = batch
+        if not self._is_reading:
+            self.loop.add_reader(self._fd, self._on_completions)
+            self._is_reading = True
+        return batch.future
+
+    async def wait_for_completions(self):
+        self._completed_event.clear()
+        await self._completed_event.wait()
+
+    def _on_completions(self):
+        for frame_id, status in self._completion_queue.drain(0, timeout_ms=0):
+            batch = self._batches.pop(frame_id, None)
+            if batch is None:
+                continue
+            batch.remaining_frames_count -= 1
+            if status and not batch.status:
+                batch.status = status
+            # The future is done if the batch was cancelled
+            if (batch.remaining_frames_count > 0) or batch.future.done():
+                continue
+            if batch.status:
+                batch.future.set_exception(ExceptionWrapper.create_exception_from_status(batch.status))
+            else:
+                batch.future.set_result(None)
+        self._completed_event.set()
+
+        if not self._batches:
+            self.loop.remove_reader(self._fd)
+            self._is_reading = False
+
+
 class VDevice(object):
     """Hailo virtual device representation."""
 
@@ -33,6 +33,11 @@ public:
             return "uint16";
         case HAILO_FORMAT_TYPE_FLOAT32:
             return "float32";
+        case HAILO_FORMAT_TYPE_FLOAT16:
+            return "float16";
+        case HAILO_FORMAT_TYPE_BFLOAT16:
+            // numpy has no native bfloat16 dtype, the raw bits are exposed as uint16
+            return "uint16";
         default:
             throw HailoRTStatusException("Invalid format type.");
         }
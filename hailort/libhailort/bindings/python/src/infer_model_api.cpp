@@ -10,10 +10,14 @@
 #include "bindings_common.hpp"
 #include "hailo/infer_model.hpp"
 
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
 #include <chrono>
 #include <condition_variable>
 #include <cstddef>
 #include <functional>
+#include <iostream>
 #include <memory>
 #include <mutex>
 #include <pybind11/gil.h>           // py::gil_scoped_release
@@ -21,6 +25,14 @@
 #include <pybind11/functional.h>    // handle std::function
 #include <pybind11/chrono.h>        // handle std::chrono::milliseconds
 
+#if defined(__linux__)
+#include <sys/eventfd.h>
+#include <unistd.h>
+#elif !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 using namespace hailort;
 
 void InferModelWrapper::set_batch_size(uint16_t batch_size)
@@ -33,6 +45,11 @@ void InferModelWrapper::set_power_mode(hailo_power_mode_t power_mode)
     m_infer_model->set_power_mode(power_mode);
 }
 
+void InferModelWrapper::set_hw_latency_measurement_flags(hailo_latency_measurement_flags_t latency)
+{
+    m_infer_model->set_hw_latency_measurement_flags(latency);
+}
+
 std::vector<InferModelInferStreamWrapper> InferModelWrapper::inputs()
 {
     auto infer_streams = m_infer_model->inputs();
@@ -330,6 +347,13 @@ size_t ConfiguredInferModelWrapper::get_async_queue_size()
     return size.release();
 }
 
+LatencyMeasurementResultExt ConfiguredInferModelWrapper::get_hw_latency_measurement()
+{
+    auto latency_result = m_configured_infer_model.get_hw_latency_measurement_ext();
+    VALIDATE_EXPECTED(latency_result);
+    return latency_result.release();
+}
+
 void ConfiguredInferModelWrapper::shutdown()
 {
     auto status = m_configured_infer_model.shutdown();
@@ -366,6 +390,267 @@ void ConfiguredInferModelWrapper::execute_callbacks()
     }
 }
 
+uint64_t ConfiguredInferModelWrapper::run_async_batch(const std::map<std::string, py::array> &input_buffers,
+    const std::map<std::string, py::array> &output_buffers, AsyncInferCompletionQueue &completion_queue,
+    std::chrono::milliseconds timeout)
+{
+    std::vector<BatchStreamBuffer> streams;
+    std::vector<py::object> buffers;
+    size_t frames_count = 0;
+    auto add_streams = [&](const std::map<std::string, py::array> &stacked_buffers, bool is_input) {
+        for (const auto &name_buffer_pair : stacked_buffers) {
+            const auto &buffer = name_buffer_pair.second;
+            if (!(buffer.flags() & py::array::c_style) || (buffer.ndim() < 1) || (0 == buffer.shape(0))) {
+                std::cerr << "Buffer of " << name_buffer_pair.first << " must be a non-empty C-contiguous array, stacked by frames";
+                THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
+            }
+            const auto buffer_frames_count = static_cast<size_t>(buffer.shape(0));
+            if (buffers.empty()) {
+                frames_count = buffer_frames_count;
+            } else if (buffer_frames_count != frames_count) {
+                std::cerr << "Buffer of " << name_buffer_pair.first << " holds " << buffer_frames_count <<
+                    " frames, while other buffers hold " << frames_count;
+                THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
+            }
+
+            auto buffer_copy = buffer;
+            // Inputs are only read, so read-only arrays are accepted for them
+            auto data = is_input ? const_cast<uint8_t*>(static_cast<const uint8_t*>(buffer_copy.data())) :
+                static_cast<uint8_t*>(buffer_copy.mutable_data());
+            streams.push_back(BatchStreamBuffer{name_buffer_pair.first, is_input, data,
+                static_cast<size_t>(buffer.nbytes()) / frames_count});
+            buffers.emplace_back(std::move(buffer_copy));
+        }
+    };
+    add_streams(input_buffers, true);
+    add_streams(output_buffers, false);
+    if (buffers.empty()) {
+        std::cerr << "No buffers were given for the batch";
+        THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
+    }
+
+    // Registered before launching, as the frames may complete (and be drained by another python thread) right away
+    const auto first_frame_id = completion_queue.add_batch(std::move(buffers), frames_count);
+
+    size_t launched_frames_count = 0;
+    hailo_status status = HAILO_SUCCESS;
+    {
+        py::gil_scoped_release release;
+        status = launch_batch(streams, frames_count, first_frame_id, completion_queue, timeout, launched_frames_count);
+    }
+    if (launched_frames_count < frames_count) {
+        completion_queue.cancel_frames(first_frame_id + launched_frames_count, frames_count - launched_frames_count);
+    }
+    VALIDATE_STATUS(status);
+
+    return first_frame_id;
+}
+
+hailo_status ConfiguredInferModelWrapper::launch_batch(const std::vector<BatchStreamBuffer> &streams, size_t frames_count,
+    uint64_t first_frame_id, AsyncInferCompletionQueue &completion_queue, std::chrono::milliseconds timeout,
+    size_t &launched_frames_count)
+{
+    for (launched_frames_count = 0; launched_frames_count < frames_count; launched_frames_count++) {
+        auto bindings = m_configured_infer_model.create_bindings();
+        if (!bindings) {
+            return bindings.status();
+        }
+
+        for (const auto &stream : streams) {
+            auto infer_stream = stream.is_input ? bindings->input(stream.name) : bindings->output(stream.name);
+            if (!infer_stream) {
+                return infer_stream.status();
+            }
+            auto status = infer_stream->set_buffer(MemoryView(stream.data + (launched_frames_count * stream.frame_size),
+                stream.frame_size));
+            if (HAILO_SUCCESS != status) {
+                return status;
+            }
+        }
+
+        auto status = m_configured_infer_model.wait_for_async_ready(timeout);
+        if (HAILO_SUCCESS != status) {
+            return status;
+        }
+
+        auto job = m_configured_infer_model.run_async(bindings.release(),
+            completion_queue.create_callback(first_frame_id + launched_frames_count));
+        if (!job) {
+            return job.status();
+        }
+        job->detach();
+    }
+
+    return HAILO_SUCCESS;
+}
+
+AsyncInferCompletionQueue::~AsyncInferCompletionQueue()
+{
+    // Frames that are not drained yet are either in the completions queue or still running
+    const auto pending_count = pending_frames_count();
+    if (0 == pending_count) {
+        return;
+    }
+
+    py::gil_scoped_release release; // The callbacks don't take the GIL, but other python threads may need it
+    std::unique_lock<std::mutex> lock(m_completions->mutex);
+    m_completions->cv.wait(lock, [this, pending_count]() { return m_completions->queue.size() >= pending_count; });
+}
+
+uint64_t AsyncInferCompletionQueue::add_batch(std::vector<py::object> &&buffers, size_t frames_count)
+{
+    const auto first_frame_id = m_next_frame_id;
+    m_next_frame_id += frames_count;
+    m_batches.emplace(first_frame_id, Batch{std::move(buffers), frames_count});
+    return first_frame_id;
+}
+
+void AsyncInferCompletionQueue::cancel_frames(uint64_t first_frame_id, size_t frames_count)
+{
+    release_frames(first_frame_id, frames_count);
+}
+
+void AsyncInferCompletionQueue::release_frames(uint64_t frame_id, size_t frames_count)
+{
+    auto batch = m_batches.upper_bound(frame_id);
+    if (m_batches.begin() == batch) {
+        return;
+    }
+    batch--;
+
+    assert(batch->second.pending_frames_count >= frames_count);
+    batch->second.pending_frames_count -= frames_count;
+    if (0 == batch->second.pending_frames_count) {
+        // Drops the references to the batch's buffers (the GIL is held)
+        m_batches.erase(batch);
+    }
+}
+
+std::function<void(const AsyncInferCompletionInfo &)> AsyncInferCompletionQueue::create_callback(uint64_t frame_id)
+{
+    auto completions = m_completions;
+    return [completions, frame_id](const AsyncInferCompletionInfo &info) {
+        {
+            std::lock_guard<std::mutex> lock(completions->mutex);
+            completions->queue.emplace_back(frame_id, info.status);
+            completions->notify();
+        }
+        completions->cv.notify_one();
+    };
+}
+
+std::vector<std::pair<uint64_t, int>> AsyncInferCompletionQueue::drain(size_t max_count, std::chrono::milliseconds timeout)
+{
+    std::vector<std::pair<uint64_t, int>> completed;
+    {
+        py::gil_scoped_release release;
+        std::unique_lock<std::mutex> lock(m_completions->mutex);
+        m_completions->cv.wait_for(lock, timeout, [this]() { return !m_completions->queue.empty(); });
+
+        auto &queue = m_completions->queue;
+        const auto count = (0 == max_count) ? queue.size() : std::min(max_count, queue.size());
+        completed.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            completed.emplace_back(queue.front().first, static_cast<int>(queue.front().second));
+            queue.pop_front();
+        }
+        if (queue.empty()) {
+            m_completions->clear_notification();
+        }
+    }
+
+    for (const auto &completion : completed) {
+        release_frames(completion.first, 1);
+    }
+    return completed;
+}
+
+size_t AsyncInferCompletionQueue::pending_frames_count() const
+{
+    size_t count = 0;
+    for (const auto &batch : m_batches) {
+        count += batch.second.pending_frames_count;
+    }
+    return count;
+}
+
+int AsyncInferCompletionQueue::fileno()
+{
+    std::lock_guard<std::mutex> lock(m_completions->mutex);
+    if (-1 != m_completions->notification_read_fd) {
+        return m_completions->notification_read_fd;
+    }
+
+#if defined(__linux__)
+    const auto fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (-1 == fd) {
+        std::cerr << "Failed creating the completion queue's eventfd, errno = " << errno;
+        THROW_STATUS_ERROR(HAILO_FILE_OPERATION_FAILURE);
+    }
+    m_completions->notification_read_fd = fd;
+    m_completions->notification_write_fd = fd;
+#elif !defined(_WIN32)
+    int fds[2];
+    if (0 != pipe(fds)) {
+        std::cerr << "Failed creating the completion queue's pipe, errno = " << errno;
+        THROW_STATUS_ERROR(HAILO_FILE_OPERATION_FAILURE);
+    }
+    for (const auto fd : fds) {
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        fcntl(fd, F_SETFD, FD_CLOEXEC);
+    }
+    m_completions->notification_read_fd = fds[0];
+    m_completions->notification_write_fd = fds[1];
+#else
+    std::cerr << "Completion queue file descriptors are not supported on Windows";
+    THROW_STATUS_ERROR(HAILO_NOT_SUPPORTED);
+#endif
+
+    // Completions that arrived before the fd was created must be drained as well
+    if (!m_completions->queue.empty()) {
+        m_completions->notify();
+    }
+    return m_completions->notification_read_fd;
+}
+
+AsyncInferCompletionQueue::Completions::~Completions()
+{
+#if !defined(_WIN32)
+    if (-1 != notification_read_fd) {
+        close(notification_read_fd);
+    }
+    if ((-1 != notification_write_fd) && (notification_read_fd != notification_write_fd)) {
+        close(notification_write_fd);
+    }
+#endif
+}
+
+void AsyncInferCompletionQueue::Completions::notify()
+{
+#if !defined(_WIN32)
+    // A single write per non-empty period, so a burst of completions wakes the event loop once
+    if ((-1 == notification_write_fd) || is_notified) {
+        return;
+    }
+    const uint64_t value = 1;
+    if (sizeof(value) == write(notification_write_fd, &value, sizeof(value))) {
+        is_notified = true;
+    }
+#endif
+}
+
+void AsyncInferCompletionQueue::Completions::clear_notification()
+{
+#if !defined(_WIN32)
+    if ((-1 == notification_read_fd) || !is_notified) {
+        return;
+    }
+    uint64_t value = 0;
+    while (0 < read(notification_read_fd, &value, sizeof(value))) {}
+    is_notified = false;
+#endif
+}
+
 void AsyncInferJobWrapper::wait(std::chrono::milliseconds timeout)
 {
     // TODO: currently waiting for 2 TIMEOUT (worst case). Fix it
@@ -386,6 +671,7 @@ void InferModelWrapper::bind(py::module &m)
         .def("configure", &InferModelWrapper::configure)
         .def("set_batch_size", &InferModelWrapper::set_batch_size)
         .def("set_power_mode", &InferModelWrapper::set_power_mode)
+        .def("set_hw_latency_measurement_flags", &InferModelWrapper::set_hw_latency_measurement_flags)
         .def("get_input_names", &InferModelWrapper::get_input_names)
         .def("get_output_names", &InferModelWrapper::get_output_names)
         .def("inputs", &InferModelWrapper::inputs)
@@ -418,7 +704,10 @@ void ConfiguredInferModelWrapper::bind(py::module &m)
         .def("set_scheduler_threshold", &ConfiguredInferModelWrapper::set_scheduler_threshold)
         .def("set_scheduler_priority", &ConfiguredInferModelWrapper::set_scheduler_priority)
         .def("get_async_queue_size", &ConfiguredInferModelWrapper::get_async_queue_size)
+        .def("get_hw_latency_measurement", &ConfiguredInferModelWrapper::get_hw_latency_measurement)
         .def("shutdown", &ConfiguredInferModelWrapper::shutdown)
+        // run_async_batch releases the GIL by itself, after collecting the buffers
+        .def("run_async_batch", &ConfiguredInferModelWrapper::run_async_batch)
         ;
 }
 
@@ -463,6 +752,19 @@ void InferModelInferStreamWrapper::bind(py::module &m)
         ;
 }
 
+void AsyncInferCompletionQueue::bind(py::module &m)
+{
+    py::class_<
+        AsyncInferCompletionQueue, std::shared_ptr<AsyncInferCompletionQueue>
+    >(m, "AsyncInferCompletionQueue")
+        .def(py::init<>())
+        // drain releases the GIL by itself while waiting, and takes it back to release the drained frames' buffers
+        .def("drain", &AsyncInferCompletionQueue::drain)
+        .def("pending_frames_count", &AsyncInferCompletionQueue::pending_frames_count)
+        .def("fileno", &AsyncInferCompletionQueue::fileno)
+        ;
+}
+
 void AsyncInferJobWrapper::bind(py::module &m)
 {
     py::class_<
@@ -19,6 +19,8 @@
 #include <thread>
 #include <vector>
 #include <queue>
+#include <deque>
+#include <map>
 
 namespace hailort {
 
@@ -27,6 +29,7 @@ class ConfiguredInferModelBindingsWrapper;
 class ConfiguredInferModelBindingsInferStreamWrapper;
 class InferModelInferStreamWrapper;
 class AsyncInferJobWrapper;
+class AsyncInferCompletionQueue;
 
 using AsyncInferCallBack = std::function<void(const int)>;
 using AsyncInferCallBackAndStatus = std::pair<AsyncInferCallBack, AsyncInferCompletionInfo>;
@@ -104,12 +107,27 @@ public:
     void set_scheduler_threshold(uint32_t threshold);
     void set_scheduler_priority(uint8_t priority);
     size_t get_async_queue_size();
+    LatencyMeasurementResultExt get_hw_latency_measurement();
     void shutdown();
+    // Launches a frame per entry of the stacked buffers' first axis, with the GIL released. The frames' completions
+    // are pushed to @a completion_queue, so no python code runs per frame. Returns the first frame's id.
+    uint64_t run_async_batch(const std::map<std::string, py::array> &input_buffers,
+        const std::map<std::string, py::array> &output_buffers, AsyncInferCompletionQueue &completion_queue,
+        std::chrono::milliseconds timeout);
 
     static void bind(py::module &m);
 
 private:
+    struct BatchStreamBuffer {
+        std::string name;
+        bool is_input;
+        uint8_t *data;
+        size_t frame_size;
+    };
+
     void execute_callbacks();
+    hailo_status launch_batch(const std::vector<BatchStreamBuffer> &streams, size_t frames_count, uint64_t first_frame_id,
+        AsyncInferCompletionQueue &completion_queue, std::chrono::milliseconds timeout, size_t &launched_frames_count);
 
     ConfiguredInferModel m_configured_infer_model;
     std::mutex m_queue_mutex;
@@ -174,6 +192,64 @@ private:
     InferModel::InferStream m_infer_stream;
 };
 
+// Completions of the frames launched by ConfiguredInferModelWrapper::run_async_batch(). Completions are pushed by
+// libhailort's threads without taking the GIL, and python drains them in bulk.
+class AsyncInferCompletionQueue final
+{
+public:
+    AsyncInferCompletionQueue() :
+        m_completions(std::make_shared<Completions>()),
+        m_next_frame_id(0)
+    {}
+    // Waits for the frames still running, as the device accesses their buffers. Requires the GIL.
+    ~AsyncInferCompletionQueue();
+
+    // Registers a batch of frames, keeping its buffers alive until all of its frames are drained. Requires the GIL.
+    uint64_t add_batch(std::vector<py::object> &&buffers, size_t frames_count);
+    // Unregisters frames of a batch that were not launched. Requires the GIL.
+    void cancel_frames(uint64_t first_frame_id, size_t frames_count);
+    std::function<void(const AsyncInferCompletionInfo &)> create_callback(uint64_t frame_id);
+
+    // Waits up to @a timeout for completions, and returns up to @a max_count (all if 0) pairs of frame id and status
+    std::vector<std::pair<uint64_t, int>> drain(size_t max_count, std::chrono::milliseconds timeout);
+    size_t pending_frames_count() const;
+    // A file descriptor that is readable while there are completions to drain, for integrating with event loops
+    // (e.g. asyncio's add_reader). It is created on the first call, and owned by the queue.
+    int fileno();
+
+    static void bind(py::module &m);
+
+private:
+    struct Completions {
+        ~Completions();
+
+        // Both are called with the mutex held
+        void notify();
+        void clear_notification();
+
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::deque<std::pair<uint64_t, hailo_status>> queue;
+        // An eventfd (a pipe on other platforms), signaled once per non-empty period of the queue. Created by fileno().
+        int notification_read_fd = -1;
+        int notification_write_fd = -1;
+        bool is_notified = false;
+    };
+
+    struct Batch {
+        std::vector<py::object> buffers;
+        size_t pending_frames_count;
+    };
+
+    void release_frames(uint64_t frame_id, size_t frames_count);
+
+    // Shared with the callbacks, which may outlive this object
+    std::shared_ptr<Completions> m_completions;
+    // By the batch's first frame id. Accessed only with the GIL held, as it holds python objects
+    std::map<uint64_t, Batch> m_batches;
+    uint64_t m_next_frame_id;
+};
+
 class AsyncInferJobWrapper final
 {
 public:
@@ -26,6 +26,7 @@ void ConfiguredNetworkGroupWrapper::bind(py::module &m)
         .def("set_scheduler_timeout", &ConfiguredNetworkGroupWrapper::set_scheduler_timeout)
         .def("set_scheduler_threshold", &ConfiguredNetworkGroupWrapper::set_scheduler_threshold)
         .def("set_scheduler_priority", &ConfiguredNetworkGroupWrapper::set_scheduler_priority)
+        .def("get_latency_measurement", &ConfiguredNetworkGroupWrapper::get_latency_measurement)
         .def("init_cache", &ConfiguredNetworkGroupWrapper::init_cache)
         .def("get_cache_info", &ConfiguredNetworkGroupWrapper::get_cache_info)
         .def("update_cache_offset", &ConfiguredNetworkGroupWrapper::update_cache_offset)
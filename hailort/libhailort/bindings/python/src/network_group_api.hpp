@@ -136,6 +136,14 @@ public:
         VALIDATE_STATUS(status);
     }
 
+    LatencyMeasurementResultExt get_latency_measurement(const std::string &network_name="")
+    {
+        auto latency_result = get().get_latency_measurement_ext(network_name);
+        VALIDATE_EXPECTED(latency_result);
+
+        return latency_result.release();
+    }
+
     void init_cache(uint32_t read_offset, int32_t write_offset_delta)
     {
         auto status = get().init_cache(read_offset, write_offset_delta);
@@ -0,0 +1,281 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file nms_api.cpp
+ * @brief NMS output conversions python bindings functions
+ **/
+
+#include "hailo/hailort_common.hpp"
+#include "hailo/quantization.hpp"
+
+#include "nms_api.hpp"
+#include "bindings_common.hpp"
+
+#include <pybind11/gil.h>           // py::gil_scoped_release
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+
+namespace hailort
+{
+
+static const size_t BBOX_WITH_MASK_PARAMS = 6; // 4 coordinates + score + class_idx
+
+static void validate_contiguous(const py::array &buffer, const std::string &name)
+{
+    if (!(buffer.flags() & py::array::c_style)) {
+        std::cerr << "NMS conversion requires a C-contiguous " << name << " buffer";
+        THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
+    }
+}
+
+template<typename T>
+void NmsBindings::convert_nms_buffer_to_tf_format_impl(const T *src, size_t src_elements_count, T *dst,
+    uint32_t number_of_classes, uint32_t max_bboxes_per_class, const T *empty_bbox)
+{
+    const size_t class_size = static_cast<size_t>(max_bboxes_per_class) * HailoRTCommon::BBOX_PARAMS;
+    size_t offset = 0;
+    for (uint32_t class_index = 0; class_index < number_of_classes; class_index++) {
+        if (offset >= src_elements_count) {
+            std::cerr << "NMS buffer is too small for " << number_of_classes << " classes";
+            THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
+        }
+        const auto bboxes_count = static_cast<size_t>(static_cast<float32_t>(src[offset]));
+        offset++;
+        if ((bboxes_count > max_bboxes_per_class) ||
+            ((offset + (bboxes_count * HailoRTCommon::BBOX_PARAMS)) > src_elements_count)) {
+            std::cerr << "Invalid bboxes count " << bboxes_count << " for class " << class_index << " in NMS buffer";
+            THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
+        }
+
+        auto dst_class = dst + (class_index * class_size);
+        const auto bboxes_size = bboxes_count * HailoRTCommon::BBOX_PARAMS;
+        std::copy(src + offset, src + offset + bboxes_size, dst_class);
+        offset += bboxes_size;
+        for (size_t bbox_index = bboxes_count; bbox_index < max_bboxes_per_class; bbox_index++) {
+            std::copy(empty_bbox, empty_bbox + HailoRTCommon::BBOX_PARAMS, dst_class + (bbox_index * HailoRTCommon::BBOX_PARAMS));
+        }
+    }
+}
+
+void NmsBindings::convert_nms_buffer_to_tf_format(py::array src_buffer, py::array dst_frame, const hailo_format_type_t &dtype,
+    uint32_t number_of_classes, uint32_t max_bboxes_per_class, py::array empty_bbox, size_t offset)
+{
+    validate_contiguous(src_buffer, "src");
+    validate_contiguous(dst_frame, "dst");
+    validate_contiguous(empty_bbox, "empty bbox");
+    const auto dst_elements_count = static_cast<size_t>(number_of_classes) * max_bboxes_per_class * HailoRTCommon::BBOX_PARAMS;
+    if ((static_cast<size_t>(dst_frame.size()) < dst_elements_count) ||
+        (static_cast<size_t>(empty_bbox.size()) < HailoRTCommon::BBOX_PARAMS) ||
+        (static_cast<size_t>(src_buffer.size()) < offset) ||
+        (src_buffer.itemsize() != dst_frame.itemsize()) || (src_buffer.itemsize() != empty_bbox.itemsize())) {
+        std::cerr << "Invalid buffers for NMS conversion to tf format";
+        THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
+    }
+
+    const auto src_elements_count = static_cast<size_t>(src_buffer.size()) - offset;
+    const auto src = static_cast<const uint8_t*>(src_buffer.data()) + (offset * src_buffer.itemsize());
+    auto dst = dst_frame.mutable_data();
+    const auto empty = empty_bbox.data();
+
+    py::gil_scoped_release release;
+    switch (dtype) {
+        case HAILO_FORMAT_TYPE_UINT8:
+            convert_nms_buffer_to_tf_format_impl<uint8_t>(src, src_elements_count, static_cast<uint8_t*>(dst),
+                number_of_classes, max_bboxes_per_class, static_cast<const uint8_t*>(empty));
+            break;
+        case HAILO_FORMAT_TYPE_UINT16:
+            convert_nms_buffer_to_tf_format_impl<uint16_t>(reinterpret_cast<const uint16_t*>(src), src_elements_count,
+                static_cast<uint16_t*>(dst), number_of_classes, max_bboxes_per_class, static_cast<const uint16_t*>(empty));
+            break;
+        case HAILO_FORMAT_TYPE_FLOAT32:
+            convert_nms_buffer_to_tf_format_impl<float32_t>(reinterpret_cast<const float32_t*>(src), src_elements_count,
+                static_cast<float32_t*>(dst), number_of_classes, max_bboxes_per_class, static_cast<const float32_t*>(empty));
+            break;
+        case HAILO_FORMAT_TYPE_FLOAT16:
+            convert_nms_buffer_to_tf_format_impl<fp16_t>(reinterpret_cast<const fp16_t*>(src), src_elements_count,
+                static_cast<fp16_t*>(dst), number_of_classes, max_bboxes_per_class, static_cast<const fp16_t*>(empty));
+            break;
+        default: {
+            py::gil_scoped_acquire acquire;
+            std::cerr << "NMS conversion to tf format isn't supported for format type = " << HailoRTBindingsCommon::convert_format_type_to_string(dtype);
+            THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
+            break;
+        }
+    }
+}
+
+template<typename T>
+py::list NmsBindings::convert_nms_buffer_to_hailo_format_impl(py::array src_buffer, uint32_t number_of_classes, size_t offset)
+{
+    const auto src = static_cast<const T*>(src_buffer.data());
+    const auto src_elements_count = static_cast<size_t>(src_buffer.size());
+    const auto item_size = static_cast<py::ssize_t>(sizeof(T));
+    const auto bbox_params = static_cast<py::ssize_t>(HailoRTCommon::BBOX_PARAMS);
+
+    py::list converted_frame;
+    for (uint32_t class_index = 0; class_index < number_of_classes; class_index++) {
+        if (offset >= src_elements_count) {
+            std::cerr << "NMS buffer is too small for " << number_of_classes << " classes";
+            THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
+        }
+        const auto bboxes_count = static_cast<size_t>(static_cast<float32_t>(src[offset]));
+        offset++;
+        if (0 == bboxes_count) {
+            // Same as numpy.empty([0, BBOX_PARAMS]), which is float64
+            converted_frame.append(py::array_t<double>(std::vector<py::ssize_t>{0, bbox_params}));
+            continue;
+        }
+        if ((offset + (bboxes_count * HailoRTCommon::BBOX_PARAMS)) > src_elements_count) {
+            std::cerr << "Invalid bboxes count " << bboxes_count << " for class " << class_index << " in NMS buffer";
+            THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
+        }
+
+        // A view of the class bboxes, which keeps the src buffer alive
+        converted_frame.append(py::array(src_buffer.dtype(),
+            std::vector<py::ssize_t>{static_cast<py::ssize_t>(bboxes_count), bbox_params},
+            std::vector<py::ssize_t>{bbox_params * item_size, item_size}, src + offset, src_buffer));
+        offset += bboxes_count * HailoRTCommon::BBOX_PARAMS;
+    }
+    return converted_frame;
+}
+
+py::list NmsBindings::convert_nms_buffer_to_hailo_format(py::array src_buffer, const hailo_format_type_t &dtype,
+    uint32_t number_of_classes, size_t offset)
+{
+    validate_contiguous(src_buffer, "src");
+    switch (dtype) {
+        case HAILO_FORMAT_TYPE_UINT8:
+            return convert_nms_buffer_to_hailo_format_impl<uint8_t>(src_buffer, number_of_classes, offset);
+        case HAILO_FORMAT_TYPE_UINT16:
+            return convert_nms_buffer_to_hailo_format_impl<uint16_t>(src_buffer, number_of_classes, offset);
+        case HAILO_FORMAT_TYPE_FLOAT32:
+            return convert_nms_buffer_to_hailo_format_impl<float32_t>(src_buffer, number_of_classes, offset);
+        case HAILO_FORMAT_TYPE_FLOAT16:
+            return convert_nms_buffer_to_hailo_format_impl<fp16_t>(src_buffer, number_of_classes, offset);
+        default:
+            std::cerr << "NMS conversion isn't supported for format type = " << HailoRTBindingsCommon::convert_format_type_to_string(dtype);
+            THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
+    }
+}
+
+template<typename T>
+void NmsBindings::convert_nms_with_byte_mask_buffer_to_tf_format_impl(const uint8_t *src, size_t src_size, T *dst,
+    uint32_t max_bboxes, uint32_t image_height, uint32_t image_width)
+{
+    const auto image_size = static_cast<size_t>(image_height) * image_width;
+    const auto dst_bbox_size = BBOX_WITH_MASK_PARAMS + image_size;
+
+    uint16_t detections_count = 0;
+    memcpy(&detections_count, src, sizeof(detections_count));
+    size_t buffer_offset = sizeof(detections_count);
+    const auto bboxes_count = std::min(static_cast<uint32_t>(detections_count), max_bboxes);
+    for (uint32_t bbox_index = 0; bbox_index < bboxes_count; bbox_index++) {
+        if ((buffer_offset + sizeof(hailo_detection_with_byte_mask_t)) > src_size) {
+            break;
+        }
+        hailo_detection_with_byte_mask_t detection{};
+        memcpy(&detection, src + buffer_offset, sizeof(detection));
+        const auto mask = src + buffer_offset + sizeof(detection);
+        const auto mask_size = std::min(detection.mask_size, src_size - (buffer_offset + sizeof(detection)));
+        buffer_offset += sizeof(detection) + detection.mask_size;
+
+        // Computed in double precision, as numpy does
+        const double bbox[BBOX_WITH_MASK_PARAMS] = {
+            detection.box.y_min, detection.box.x_min, detection.box.y_max, detection.box.x_max,
+            detection.score, static_cast<double>(detection.class_id)
+        };
+        auto dst_bbox = dst + (bbox_index * dst_bbox_size);
+        for (size_t i = 0; i < BBOX_WITH_MASK_PARAMS; i++) {
+            dst_bbox[i] = static_cast<T>(bbox[i]);
+        }
+
+        // The mask is given for the bbox only - paint it over the whole image. Mask pixels before the image's top/left
+        // edges are cropped, pixels past its bottom/right edges are clipped to the last row/column.
+        auto dst_mask = dst_bbox + BBOX_WITH_MASK_PARAMS;
+        std::fill(dst_mask, dst_mask + image_size, static_cast<T>(0));
+        const auto y_min = static_cast<int64_t>(std::ceil(bbox[0] * image_height));
+        const auto x_min = static_cast<int64_t>(std::ceil(bbox[1] * image_width));
+        const auto mask_width = static_cast<int64_t>(std::ceil((bbox[3] - bbox[1]) * image_width));
+        if (mask_width <= 0) {
+            continue;
+        }
+
+        const auto last_row = static_cast<int64_t>(image_height) - 1;
+        const auto last_col = static_cast<int64_t>(image_width) - 1;
+        // Mask columns before first_col are cropped, columns from unclipped_width on are clipped to the last column
+        const auto first_col = static_cast<size_t>(std::max(-x_min, int64_t(0)));
+        const auto unclipped_width = static_cast<size_t>(std::max(std::min(mask_width, last_col - x_min + 1), int64_t(0)));
+        for (size_t row_start = 0; row_start < mask_size; row_start += static_cast<size_t>(mask_width)) {
+            const auto row = y_min + (static_cast<int64_t>(row_start) / mask_width);
+            if (row < 0) {
+                continue;
+            }
+            const auto mask_row = mask + row_start;
+            const auto row_width = std::min(static_cast<size_t>(mask_width), mask_size - row_start);
+            auto dst_row = dst_mask + (std::min(row, last_row) * image_width);
+
+            size_t col = first_col;
+            for (; col < std::min(row_width, unclipped_width); col++) {
+                if (1 == mask_row[col]) {
+                    dst_row[x_min + static_cast<int64_t>(col)] = static_cast<T>(1);
+                }
+            }
+            for (col = std::max(col, unclipped_width); col < row_width; col++) {
+                if (1 == mask_row[col]) {
+                    dst_row[std::min(x_min + static_cast<int64_t>(col), last_col)] = static_cast<T>(1);
+                }
+            }
+        }
+    }
+}
+
+void NmsBindings::convert_nms_with_byte_mask_buffer_to_tf_format(py::array src_buffer, py::array dst_frame,
+    const hailo_format_type_t &dst_dtype, uint32_t max_bboxes, uint32_t image_height, uint32_t image_width)
+{
+    validate_contiguous(src_buffer, "src");
+    validate_contiguous(dst_frame, "dst");
+    const auto dst_elements_count = static_cast<size_t>(max_bboxes) *
+        (BBOX_WITH_MASK_PARAMS + (static_cast<size_t>(image_height) * image_width));
+    const auto src_size = static_cast<size_t>(src_buffer.nbytes());
+    if ((static_cast<size_t>(dst_frame.size()) < dst_elements_count) || (src_size < sizeof(uint16_t)) ||
+        (0 == image_height) || (0 == image_width)) {
+        std::cerr << "Invalid buffers for NMS with byte mask conversion to tf format";
+        THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
+    }
+
+    const auto src = static_cast<const uint8_t*>(src_buffer.data());
+    auto dst = dst_frame.mutable_data();
+
+    py::gil_scoped_release release;
+    switch (dst_dtype) {
+        case HAILO_FORMAT_TYPE_UINT8:
+            convert_nms_with_byte_mask_buffer_to_tf_format_impl<uint8_t>(src, src_size, static_cast<uint8_t*>(dst),
+                max_bboxes, image_height, image_width);
+            break;
+        case HAILO_FORMAT_TYPE_UINT16:
+            convert_nms_with_byte_mask_buffer_to_tf_format_impl<uint16_t>(src, src_size, static_cast<uint16_t*>(dst),
+                max_bboxes, image_height, image_width);
+            break;
+        case HAILO_FORMAT_TYPE_FLOAT32:
+            convert_nms_with_byte_mask_buffer_to_tf_format_impl<float32_t>(src, src_size, static_cast<float32_t*>(dst),
+                max_bboxes, image_height, image_width);
+            break;
+        case HAILO_FORMAT_TYPE_FLOAT16:
+            convert_nms_with_byte_mask_buffer_to_tf_format_impl<fp16_t>(src, src_size, static_cast<fp16_t*>(dst),
+                max_bboxes, image_height, image_width);
+            break;
+        default: {
+            py::gil_scoped_acquire acquire;
+            std::cerr << "NMS with byte mask conversion to tf format isn't supported for format type = " << HailoRTBindingsCommon::convert_format_type_to_string(dst_dtype);
+            THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
+            break;
+        }
+    }
+}
+
+} /* namespace hailort */
@@ -0,0 +1,53 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file nms_api.hpp
+ * @brief NMS output conversions python bindings functions
+ **/
+
+#ifndef _HAILO_NMS_API_HPP_
+#define _HAILO_NMS_API_HPP_
+
+#include "hailo/hailort.h"
+
+#include "utils.hpp"
+
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+
+
+namespace hailort
+{
+
+class NmsBindings
+{
+public:
+    // Converts a single frame of HAILO_NMS format (starting at @a offset elements of @a src_buffer) into @a dst_frame,
+    // shaped [number_of_classes, max_bboxes_per_class, BBOX_PARAMS]. Missing bboxes are filled with @a empty_bbox.
+    static void convert_nms_buffer_to_tf_format(py::array src_buffer, py::array dst_frame, const hailo_format_type_t &dtype,
+        uint32_t number_of_classes, uint32_t max_bboxes_per_class, py::array empty_bbox, size_t offset);
+    // Splits a single frame of HAILO_NMS format into a list of per class arrays, shaped [bboxes_count, BBOX_PARAMS].
+    // The arrays are views of @a src_buffer.
+    static py::list convert_nms_buffer_to_hailo_format(py::array src_buffer, const hailo_format_type_t &dtype,
+        uint32_t number_of_classes, size_t offset);
+    // Converts a single frame of HAILO_NMS_WITH_BYTE_MASK format into @a dst_frame, shaped
+    // [max_bboxes, 6 + image_height * image_width] - each bbox followed by its mask, painted over the whole image.
+    static void convert_nms_with_byte_mask_buffer_to_tf_format(py::array src_buffer, py::array dst_frame,
+        const hailo_format_type_t &dst_dtype, uint32_t max_bboxes, uint32_t image_height, uint32_t image_width);
+
+private:
+    template<typename T>
+    static void convert_nms_buffer_to_tf_format_impl(const T *src, size_t src_elements_count, T *dst,
+        uint32_t number_of_classes, uint32_t max_bboxes_per_class, const T *empty_bbox);
+    template<typename T>
+    static py::list convert_nms_buffer_to_hailo_format_impl(py::array src_buffer, uint32_t number_of_classes, size_t offset);
+    template<typename T>
+    static void convert_nms_with_byte_mask_buffer_to_tf_format_impl(const uint8_t *src, size_t src_size, T *dst,
+        uint32_t max_bboxes, uint32_t image_height, uint32_t image_width);
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_NMS_API_HPP_ */
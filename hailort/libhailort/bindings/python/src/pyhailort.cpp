@@ -19,6 +19,7 @@ using namespace std;
 #include "network_group_api.hpp"
 #include "device_api.hpp"
 #include "quantization_api.hpp"
+#include "nms_api.hpp"
 
 #include "utils.hpp"
 
@@ -105,6 +106,12 @@ std::string get_status_message(uint32_t status_in)
     }
 }
 
+void set_thread_policy(const std::string &thread_policy)
+{
+    auto status = hailo_set_thread_policy(thread_policy.c_str());
+    VALIDATE_STATUS(status);
+}
+
 class NetworkRateLimiter final
 {
 public:
@@ -179,7 +186,11 @@ PYBIND11_MODULE(_pyhailort, m) {
     validate_versions_match();
 
     m.def("get_status_message", &get_status_message);
+    m.def("set_thread_policy", &set_thread_policy);
     m.def("convert_nms_with_byte_mask_buffer_to_detections", &convert_nms_with_byte_mask_buffer_to_detections);
+    m.def("convert_nms_with_byte_mask_buffer_to_tf_format", &NmsBindings::convert_nms_with_byte_mask_buffer_to_tf_format);
+    m.def("convert_nms_buffer_to_tf_format", &NmsBindings::convert_nms_buffer_to_tf_format);
+    m.def("convert_nms_buffer_to_hailo_format", &NmsBindings::convert_nms_buffer_to_hailo_format);
     m.def("dequantize_output_buffer_in_place", &QuantizationBindings::dequantize_output_buffer_in_place);
     m.def("dequantize_output_buffer", &QuantizationBindings::dequantize_output_buffer);
     m.def("quantize_input_buffer", &QuantizationBindings::quantize_input_buffer);
@@ -225,6 +236,26 @@ PYBIND11_MODULE(_pyhailort, m) {
         .def(py::pickle(&PowerMeasurementData::get_state, &PowerMeasurementData::set_state))
         ;
 
+    py::class_<LatencyMeasurementResultExt>(m, "LatencyMeasurementResult")
+        .def_property_readonly("avg_hw_latency_ms", [](const LatencyMeasurementResultExt &self) {
+            return std::chrono::duration<double, std::milli>(self.avg_hw_latency).count();
+        }, "float, The average hw latency in milliseconds")
+        .def_property_readonly("p50_hw_latency_ms", [](const LatencyMeasurementResultExt &self) {
+            return std::chrono::duration<double, std::milli>(self.p50_hw_latency).count();
+        }, "float, The median hw latency in milliseconds")
+        .def_property_readonly("p95_hw_latency_ms", [](const LatencyMeasurementResultExt &self) {
+            return std::chrono::duration<double, std::milli>(self.p95_hw_latency).count();
+        }, "float, The 95th percentile hw latency in milliseconds")
+        .def_property_readonly("p99_hw_latency_ms", [](const LatencyMeasurementResultExt &self) {
+            return std::chrono::duration<double, std::milli>(self.p99_hw_latency).count();
+        }, "float, The 99th percentile hw latency in milliseconds")
+        .def_property_readonly("max_hw_latency_ms", [](const LatencyMeasurementResultExt &self) {
+            return std::chrono::duration<double, std::milli>(self.max_hw_latency).count();
+        }, "float, The maximum hw latency in milliseconds")
+        .def_readonly("measured_frames_count", &LatencyMeasurementResultExt::measured_frames_count,
+            "uint, The number of frames measured")
+        ;
+
     py::class_<hailo_rectangle_t>(m, "HailoRectangle")
         .def_readonly("y_min", &hailo_rectangle_t::y_min)
         .def_readonly("x_min", &hailo_rectangle_t::x_min)
@@ -534,6 +565,8 @@ PYBIND11_MODULE(_pyhailort, m) {
         .value("UINT8", HAILO_FORMAT_TYPE_UINT8)
         .value("UINT16", HAILO_FORMAT_TYPE_UINT16)
         .value("FLOAT32", HAILO_FORMAT_TYPE_FLOAT32)
+        .value("FLOAT16", HAILO_FORMAT_TYPE_FLOAT16, "IEEE-754 half precision. Supported only as a host side format.")
+        .value("BFLOAT16", HAILO_FORMAT_TYPE_BFLOAT16, "Brain floating point, exposed to numpy as uint16 storage. Supported only as a host side format.")
         ;
 
     py::enum_<hailo_format_order_t>(m, "FormatOrder")
@@ -810,7 +843,7 @@ PYBIND11_MODULE(_pyhailort, m) {
         ))
         ;
 
-    py::enum_<hailo_latency_measurement_flags_t>(m, "LatencyMeasurementFlags")
+    py::enum_<hailo_latency_measurement_flags_t>(m, "LatencyMeasurementFlags", py::arithmetic())
         .value("NONE", HAILO_LATENCY_NONE)
         .value("CLEAR_AFTER_GET", HAILO_LATENCY_CLEAR_AFTER_GET)
         .value("MEASURE", HAILO_LATENCY_MEASURE)
@@ -1179,6 +1212,7 @@ PYBIND11_MODULE(_pyhailort, m) {
 
     ActivatedAppContextManagerWrapper::bind(m);
     AsyncInferJobWrapper::bind(m);
+    AsyncInferCompletionQueue::bind(m);
     ConfiguredInferModelBindingsInferStreamWrapper::bind(m);
     ConfiguredInferModelBindingsWrapper::bind(m);
     ConfiguredInferModelWrapper::bind(m);
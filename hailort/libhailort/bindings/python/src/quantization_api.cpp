@@ -33,6 +33,10 @@ void QuantizationBindings::dequantize_output_buffer_from_uint8(py::array src_buf
             Quantization::dequantize_output_buffer<float32_t, uint8_t>(static_cast<uint8_t*>(src_buffer.mutable_data()),
                 static_cast<float32_t*>(dst_buffer.mutable_data()), shape_size, quant_info);
             break;
+        case HAILO_FORMAT_TYPE_FLOAT16:
+            Quantization::dequantize_output_buffer<fp16_t, uint8_t>(static_cast<uint8_t*>(src_buffer.mutable_data()),
+                static_cast<fp16_t*>(dst_buffer.mutable_data()), shape_size, quant_info);
+            break;
         default:
             std::cerr << "Output quantization isn't supported from src format type uint8 to dst format type = " << HailoRTBindingsCommon::convert_format_type_to_string(dst_dtype);
             THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
@@ -52,6 +56,10 @@ void QuantizationBindings::dequantize_output_buffer_from_uint16(py::array src_bu
             Quantization::dequantize_output_buffer<float32_t, uint16_t>(static_cast<uint16_t*>(src_buffer.mutable_data()),
                 static_cast<float32_t*>(dst_buffer.mutable_data()), shape_size, quant_info);
             break;
+        case HAILO_FORMAT_TYPE_FLOAT16:
+            Quantization::dequantize_output_buffer<fp16_t, uint16_t>(static_cast<uint16_t*>(src_buffer.mutable_data()),
+                static_cast<fp16_t*>(dst_buffer.mutable_data()), shape_size, quant_info);
+            break;
         default:
             std::cerr << "Output quantization isn't supported from src dormat type uint16 to dst format type = " << HailoRTBindingsCommon::convert_format_type_to_string(dst_dtype);
             THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
@@ -90,6 +98,10 @@ void QuantizationBindings::dequantize_output_buffer_from_uint8_in_place(py::arra
             Quantization::dequantize_output_buffer_in_place<float32_t, uint8_t>(
                 static_cast<float32_t*>(dst_buffer.mutable_data()), shape_size, quant_info);
             break;
+        case HAILO_FORMAT_TYPE_FLOAT16:
+            Quantization::dequantize_output_buffer_in_place<fp16_t, uint8_t>(
+                static_cast<fp16_t*>(dst_buffer.mutable_data()), shape_size, quant_info);
+            break;
         default:
             std::cerr << "Output quantization isn't supported from src format type uint8 to dst format type = " << HailoRTBindingsCommon::convert_format_type_to_string(dst_dtype);
             THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
@@ -109,6 +121,10 @@ void QuantizationBindings::dequantize_output_buffer_from_uint16_in_place(py::arr
             Quantization::dequantize_output_buffer_in_place<float32_t, uint16_t>(
                 static_cast<float32_t*>(dst_buffer.mutable_data()), shape_size, quant_info);
             break;
+        case HAILO_FORMAT_TYPE_FLOAT16:
+            Quantization::dequantize_output_buffer_in_place<fp16_t, uint16_t>(
+                static_cast<fp16_t*>(dst_buffer.mutable_data()), shape_size, quant_info);
+            break;
         default:
             std::cerr << "Output quantization isn't supported from src dormat type uint16 to dst format type = " << HailoRTBindingsCommon::convert_format_type_to_string(dst_dtype);
             THROW_STATUS_ERROR(HAILO_INVALID_ARGUMENT);
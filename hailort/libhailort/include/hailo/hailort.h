@@ -551,6 +551,18 @@ typedef enum {
     /** Data format type float32_t - used only on host side (Translated in the quantization process) */
     HAILO_FORMAT_TYPE_FLOAT32               = 3,
 
+    /**
+     * Data format type IEEE 754 half precision float - 2 bytes per item, used only on host side
+     * (Translated in the quantization process)
+     */
+    HAILO_FORMAT_TYPE_FLOAT16               = 4,
+
+    /**
+     * Data format type bfloat16 (upper 16 bits of a float32_t) - 2 bytes per item, used only on host side
+     * (Translated in the quantization process)
+     */
+    HAILO_FORMAT_TYPE_BFLOAT16              = 5,
+
     /** Max enum value to maintain ABI Integrity */
     HAILO_FORMAT_TYPE_MAX_ENUM              = HAILO_MAX_ENUM
 } hailo_format_type_t;
@@ -738,6 +750,25 @@ typedef enum {
      */
     HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK         = 20,
 
+    /**
+     * NMS_BY_SCORE format - the detections of all classes, sorted by score in descending order
+     *
+     * - Host side
+     *      \code
+     *      struct (packed) {
+     *          uint16_t detections_count;
+     *          hailo_detection_t[detections_count];
+     *      };
+     *      \endcode
+     *
+     *      The buffer is sized for number_of_classes * max_bboxes_per_class detections, which is also the top-K
+     *      limit on the number of detections written (up to UINT16_MAX). The host format type supported
+     *      ::HAILO_FORMAT_TYPE_FLOAT32.
+     *
+     * - Not used for device side
+     */
+    HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE               = 21,
+
     /** Max enum value to maintain ABI Integrity */
     HAILO_FORMAT_ORDER_MAX_ENUM             = HAILO_MAX_ENUM
 } hailo_format_order_t;
@@ -1181,6 +1212,69 @@ typedef enum {
     HAILO_PIPELINE_ELEM_STATS_MAX_ENUM              = HAILO_MAX_ENUM
 } hailo_pipeline_elem_stats_flags_t;
 
+/** Host pre-processing resize modes */
+typedef enum {
+    /** No pre-processing, input frames must match the model's input shape */
+    HAILO_RESIZE_MODE_NONE          = 0,
+    /** Resize the whole frame to the model's input shape, aspect ratio is not kept */
+    HAILO_RESIZE_MODE_STRETCH       = 1,
+    /** Resize keeping the aspect ratio, the uncovered area is filled with ::hailo_preprocess_params_t.padding_value */
+    HAILO_RESIZE_MODE_LETTERBOX     = 2,
+    /** Resize keeping the aspect ratio, the frame is center-cropped to cover the model's input */
+    HAILO_RESIZE_MODE_CROP          = 3,
+
+    /** Max enum value to maintain ABI Integrity */
+    HAILO_RESIZE_MODE_MAX_ENUM      = HAILO_MAX_ENUM
+} hailo_resize_mode_t;
+
+#define HAILO_PREPROCESS_MAX_CHANNELS (3)
+
+/**
+ * Host pre-processing params.
+ * When @a resize_mode is not ::HAILO_RESIZE_MODE_NONE, user frames are of size @a src_width x @a src_height in
+ * @a src_order and are resized to the model's input shape as part of the input transformation.
+ * @note Source frames are always ::HAILO_FORMAT_TYPE_UINT8.
+ * @note Used by the InferModel API (InferModel::InferStream::set_preprocess_params()).
+ */
+typedef struct {
+    hailo_resize_mode_t resize_mode;
+    uint32_t src_width;
+    uint32_t src_height;
+    /** Source frame order. Supported orders are ::HAILO_FORMAT_ORDER_NHWC (RGB) and ::HAILO_FORMAT_ORDER_NV12 */
+    hailo_format_order_t src_order;
+    /** Per channel value of the letterbox padding area */
+    uint8_t padding_value[HAILO_PREPROCESS_MAX_CHANNELS];
+    /** If true, each channel is normalized as (x - mean) / std, producing a ::HAILO_FORMAT_TYPE_FLOAT32 frame */
+    bool normalize;
+    float32_t mean[HAILO_PREPROCESS_MAX_CHANNELS];
+    float32_t std[HAILO_PREPROCESS_MAX_CHANNELS];
+} hailo_preprocess_params_t;
+
+/**
+ * Mapping between the model's input coordinates and the source frame coordinates, as applied by the host pre-processing:
+ * model_x = src_x * scale_x + offset_x, model_y = src_y * scale_y + offset_y (in pixels).
+ */
+typedef struct {
+    float32_t scale_x;
+    float32_t scale_y;
+    float32_t offset_x;
+    float32_t offset_y;
+} hailo_preprocess_transform_info_t;
+
+/** Split of a high resolution frame into a grid of overlapping tiles, each inferred as a separate frame */
+typedef struct {
+    /** Number of tiles along the frame's width */
+    uint32_t columns;
+    /** Number of tiles along the frame's height */
+    uint32_t rows;
+    /** Overlap between adjacent tiles, as a fraction of the tile size, in the range [0, 1) */
+    float32_t overlap;
+    /** If true, the whole frame is inferred as an additional tile, for objects larger than a single tile */
+    bool add_full_frame_tile;
+    /** IoU threshold of the NMS merging the detections of all tiles */
+    float32_t nms_iou_threshold;
+} hailo_tiling_params_t;
+
 /** Virtual stream params */
 typedef struct {
     hailo_format_t user_buffer_format;
@@ -1351,6 +1445,17 @@ typedef struct {
     */
     uint8_t *mask;
 } hailo_detection_with_byte_mask_t;
+
+typedef struct {
+    /** Detection's box coordinates */
+    hailo_rectangle_t box;
+
+    /** Detection's score */
+    float32_t score;
+
+    /** Detection's class id */
+    uint16_t class_id;
+} hailo_detection_t;
 #pragma pack(pop)
 
 /**
@@ -1778,6 +1883,18 @@ typedef struct {
     float64_t avg_hw_latency_ms;
 } hailo_latency_measurement_result_t;
 
+/** Latency measurement result with the latency distribution, returned by ::hailo_get_latency_measurement_ext */
+typedef struct {
+    float64_t avg_hw_latency_ms;
+    /** Latency percentiles and maximum of the measured frames (percentiles are accurate up to ~3%) */
+    float64_t p50_hw_latency_ms;
+    float64_t p95_hw_latency_ms;
+    float64_t p99_hw_latency_ms;
+    float64_t max_hw_latency_ms;
+    /** Number of frames measured */
+    uint64_t measured_frames_count;
+} hailo_latency_measurement_result_ext_t;
+
 typedef struct {
     char stream_name[HAILO_MAX_STREAM_NAME_SIZE];
     uint32_t rate;
@@ -1909,6 +2026,20 @@ typedef enum {
  */
 HAILORTAPI hailo_status hailo_get_library_version(hailo_version_t *version);
 
+/**
+ * Sets the CPU affinity and scheduling policies of HailoRT's threads in the calling process.
+ * The policies are given as a list of "<thread role> [cpus=<list>] [policy=other|fifo|rr] [priority=<1-99>]
+ * [nice=<-20-19>]" entries separated by ';' (e.g. "CHANNEL_INTR cpus=2 policy=fifo priority=50; * cpus=0-1").
+ * A role ending with '*' matches all roles with the given prefix.
+ * The policies override the ones given by the HAILO_THREAD_POLICY or HAILO_THREAD_POLICY_FILE environment variables,
+ * and replace the ones given by a previous call. They apply to threads created after the call, of every VDevice in
+ * the process.
+ *
+ * @param[in] thread_policy     The policies. If NULL or empty, only the environment variables' policies are used.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ */
+HAILORTAPI hailo_status hailo_set_thread_policy(const char *thread_policy);
+
 /**
  * Returns a string format of @ status.
  * 
@@ -2901,6 +3032,7 @@ HAILORTAPI hailo_status hailo_get_output_stream(
 
 /**
  * Returns the network latency (only available if latency measurement was enabled).
+ * If ::HAILO_LATENCY_CLEAR_AFTER_GET was set, each call returns only the frames measured since the previous call.
  *
  * @param[in]  configured_network_group     NetworkGroup to get the latency measurement from.
  * @param[in]  network_name                 Network name of the requested latency measurement.
@@ -2912,6 +3044,20 @@ HAILORTAPI hailo_status hailo_get_output_stream(
 HAILORTAPI hailo_status hailo_get_latency_measurement(hailo_configured_network_group configured_network_group,
     const char *network_name, hailo_latency_measurement_result_t *result);
 
+/**
+ * Returns the network latency distribution (only available if latency measurement was enabled).
+ * If ::HAILO_LATENCY_CLEAR_AFTER_GET was set, each call returns only the frames measured since the previous call.
+ *
+ * @param[in]  configured_network_group     NetworkGroup to get the latency measurement from.
+ * @param[in]  network_name                 Network name of the requested latency measurement.
+ *                                          If NULL is passed, all the networks in the network group will be addressed,
+ *                                          and the resulted measurement is of the frames of all networks.
+ * @param[out] result                       Output latency result.
+ * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+ */
+HAILORTAPI hailo_status hailo_get_latency_measurement_ext(hailo_configured_network_group configured_network_group,
+    const char *network_name, hailo_latency_measurement_result_ext_t *result);
+
 /**
  * Sets the maximum time period that may pass before receiving run time from the scheduler.
  * This will occur providing at least one send request has been sent, there is no minimum requirement for send
@@ -36,6 +36,9 @@ public:
         "Mismatch bbox params size");
     static const uint32_t BBOX_PARAMS = sizeof(hailo_bbox_t) / sizeof(uint16_t);
     static const uint32_t DETECTION_WITH_BYTE_MASK_SIZE = sizeof(hailo_detection_with_byte_mask_t);
+    static const uint32_t DETECTION_SIZE = sizeof(hailo_detection_t);
+    // HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE detections counter is uint16_t
+    static const uint32_t MAX_NMS_BY_SCORE_DETECTIONS = UINT16_MAX;
     static const uint32_t MAX_DEFUSED_LAYER_COUNT = 9;
     static const size_t HW_DATA_ALIGNMENT = 8;
     static const uint32_t MUX_INFO_COUNT = 32;
@@ -120,7 +123,8 @@ public:
     {
         if (type == HAILO_FORMAT_TYPE_FLOAT32) {
             return 4;
-        } else if (type == HAILO_FORMAT_TYPE_UINT16) {
+        } else if ((type == HAILO_FORMAT_TYPE_UINT16) || (type == HAILO_FORMAT_TYPE_FLOAT16) ||
+            (type == HAILO_FORMAT_TYPE_BFLOAT16)) {
             return 2;
         } else if (type == HAILO_FORMAT_TYPE_UINT8) {
             return 1;
@@ -129,6 +133,18 @@ public:
         return 1;
     }
 
+    /**
+     * Indicates whether the given format type is a host-side floating point type (i.e. the data is de-quantized).
+     *
+     * @param[in] type             A ::hailo_format_type_t object.
+     * @return true if @a type is ::HAILO_FORMAT_TYPE_FLOAT32, ::HAILO_FORMAT_TYPE_FLOAT16 or ::HAILO_FORMAT_TYPE_BFLOAT16.
+     */
+    static constexpr bool is_float_format_type(hailo_format_type_t type)
+    {
+        return ((HAILO_FORMAT_TYPE_FLOAT32 == type) || (HAILO_FORMAT_TYPE_FLOAT16 == type) ||
+            (HAILO_FORMAT_TYPE_BFLOAT16 == type));
+    }
+
     /**
      * Gets the format type of a stream by the hw data bytes parameter.
      *
@@ -164,6 +180,10 @@ public:
             return "UINT16";
         case HAILO_FORMAT_TYPE_FLOAT32:
             return "FLOAT32";
+        case HAILO_FORMAT_TYPE_FLOAT16:
+            return "FLOAT16";
+        case HAILO_FORMAT_TYPE_BFLOAT16:
+            return "BFLOAT16";
         case HAILO_FORMAT_TYPE_AUTO:
             return "AUTO";
         default:
@@ -250,6 +270,8 @@ public:
             return "YYYYUV";
         case HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK:
             return "HAILO NMS WITH BYTE MASK";
+        case HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE:
+            return "HAILO NMS BY SCORE";
         default:
             return "Nan";
         }
@@ -302,6 +324,19 @@ public:
         return frame_size;
     }
 
+    /**
+     * Gets `HAILO_NMS_BY_SCORE` host frame size in bytes by nms_shape.
+     *
+     * @param[in] nms_shape             The NMS shape to get size from.
+     * @return The HAILO_NMS_BY_SCORE host frame size.
+     */
+    static constexpr uint32_t get_nms_by_score_host_frame_size(const hailo_nms_shape_t &nms_shape)
+    {
+        // Counter + detections of all classes
+        return static_cast<uint32_t>(sizeof(uint16_t)) +
+            (nms_shape.number_of_classes * nms_shape.max_bboxes_per_class * DETECTION_SIZE);
+    }
+
     /**
      * Gets NMS hw frame size in bytes by nms info.
      *
@@ -411,7 +446,8 @@ public:
 
     static constexpr bool is_nms(const hailo_format_order_t &order)
     {
-        return ((HAILO_FORMAT_ORDER_HAILO_NMS == order) || (HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK == order));
+        return ((HAILO_FORMAT_ORDER_HAILO_NMS == order) || (HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK == order) ||
+            (HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE == order));
     }
 
     // TODO HRT-10073: change to supported features list
@@ -39,6 +39,7 @@ public:
 
     static hailo_vstream_params_t get_vstreams_params();
     static hailo_vstream_params_t get_vstreams_params(bool unused, hailo_format_type_t format_type);
+    static hailo_preprocess_params_t get_preprocess_params();
 
     static Expected<hailo_stream_parameters_t> get_stream_parameters(hailo_stream_interface_t interface,
             hailo_stream_direction_t direction);
@@ -265,12 +265,74 @@ public:
     Expected<AsyncInferJob> run_async(const std::vector<Bindings> &bindings,
         std::function<void(const AsyncInferCompletionInfo &)> callback = ASYNC_INFER_EMPTY_CALLBACK);
 
+    /**
+     * Launches an asynchronous inference operation over multiple regions of interest (ROIs) of a single source frame.
+     * Each ROI is cropped from @a src_frame and resized into the model's input shape according to @a preprocess_params,
+     * directly into an input buffer allocated by the library. All ROIs are launched back to back as a single job, so the
+     * device may process them in one batch (see InferModel::set_batch_size()).
+     * The completion of all ROIs is notified through a single call to the provided callback function.
+     *
+     * @param[in] src_frame          The source frame, with the dimensions and order described by @a preprocess_params.
+     * @param[in] preprocess_params  Describes the source frame and how each ROI is resized into the model's input.
+     * @param[in] rois               The regions of interest, in normalized [0, 1] coordinates of the source frame.
+     * @param[in] bindings           Bindings per ROI, holding the output buffers of that ROI. Their input buffers are
+     *                               not used (nor modified).
+     * @param[in] callback           The function to be called upon completion of the inference of all ROIs.
+     *
+     * @return Upon success, returns an instance of Expected<AsyncInferJob> representing the launched job.
+     *  Otherwise, returns Unexpected of ::hailo_status error.
+     * @note Supported only for models with a single input, configured with ::HAILO_FORMAT_ORDER_NHWC order,
+     *  ::HAILO_FORMAT_TYPE_UINT8 type (::HAILO_FORMAT_TYPE_FLOAT32 if normalization is requested) and without
+     *  pre-processing of its own.
+     * @note @a src_frame may be reused once this function returns. The output buffers should be kept intact until the
+     *  async job is completed.
+     * @note The resize mode of @a preprocess_params is applied to each ROI as if it was a whole frame.
+     * @note All ROIs are queued at once, so the async queue must have room for @a rois.size() frames - call
+     *  wait_for_async_ready() with @a frames_count of @a rois.size() beforehand. If @a rois.size() is greater than
+     *  get_async_queue_size(), ::HAILO_INVALID_ARGUMENT is returned.
+     */
+    Expected<AsyncInferJob> run_async_rois(const MemoryView src_frame, const hailo_preprocess_params_t &preprocess_params,
+        const std::vector<hailo_rectangle_t> &rois, const std::vector<Bindings> &bindings,
+        std::function<void(const AsyncInferCompletionInfo &)> callback = ASYNC_INFER_EMPTY_CALLBACK);
+
+    /**
+     * Launches an asynchronous tiled inference of a high resolution frame.
+     * The frame is split into a grid of overlapping tiles, each tile is pre-processed directly from @a src_frame into
+     * the model's input, and all tiles are launched together as a single batch (see run_async_rois()).
+     * Once all tiles are done, their detections are remapped to the whole frame and merged with a global NMS into
+     * @a nms_output, before the provided callback function is called.
+     *
+     * @param[in] src_frame          The source frame, with the dimensions and order described by @a preprocess_params.
+     * @param[in] preprocess_params  Describes the source frame and how each tile is resized into the model's input.
+     * @param[in] tiling_params      The tiles grid, and the IoU threshold of the NMS merging their detections.
+     * @param[in] nms_output         Buffer for the merged detections of the whole frame, in ::HAILO_FORMAT_ORDER_HAILO_NMS
+     *                               order and ::HAILO_FORMAT_TYPE_FLOAT32 type. Boxes are normalized to the whole frame.
+     * @param[in] callback           The function to be called upon completion of the merged result.
+     *
+     * @return Upon success, returns an instance of Expected<AsyncInferJob> representing the launched job.
+     *  Otherwise, returns Unexpected of ::hailo_status error.
+     * @note Supported only for models with a single input (see run_async_rois()) and a single NMS output, configured with
+     *  ::HAILO_FORMAT_ORDER_HAILO_NMS order and ::HAILO_FORMAT_TYPE_FLOAT32 type.
+     * @note As in run_async_rois(), the async queue must have room for all tiles (rows * columns frames, plus one if
+     *  add_full_frame_tile is set).
+     * @note @a nms_output should be kept intact until the async job is completed.
+     */
+    Expected<AsyncInferJob> run_async_tiles(const MemoryView src_frame, const hailo_preprocess_params_t &preprocess_params,
+        const hailo_tiling_params_t &tiling_params, MemoryView nms_output,
+        std::function<void(const AsyncInferCompletionInfo &)> callback = ASYNC_INFER_EMPTY_CALLBACK);
+
     /**
     * @return Upon success, returns Expected of LatencyMeasurementResult object containing the output latency result.
     *  Otherwise, returns Unexpected of ::hailo_status error.
     */
     Expected<LatencyMeasurementResult> get_hw_latency_measurement();
 
+    /**
+    * @return Upon success, returns Expected of LatencyMeasurementResultExt object containing the latency distribution
+    *  of the measured frames. Otherwise, returns Unexpected of ::hailo_status error.
+    */
+    Expected<LatencyMeasurementResultExt> get_hw_latency_measurement_ext();
+
     /**
      * Sets the maximum time period that may pass before receiving run time from the scheduler.
      * This will occur providing at least one send request has been sent, there is no minimum requirement for send
@@ -460,6 +522,25 @@ public:
          */
         void set_nms_max_accumulated_mask_size(uint32_t max_accumulated_mask_size);
 
+        /**
+         * Enables host pre-processing of the stream's frames.
+         * Once set, the stream's buffers are user frames of the size and order given in @a params, which are resized
+         * (and letterboxed or cropped) into the model's input shape as part of the input transformation.
+         * In that case the stream's format is ignored, and get_frame_size() returns the size of a source frame.
+         *
+         * @param[in] params    The pre-processing params. Use ::HAILO_RESIZE_MODE_NONE to disable pre-processing.
+         * @note Relevant only for input streams.
+         */
+        void set_preprocess_params(const hailo_preprocess_params_t &params);
+
+        /**
+         * @return upon success, an Expected of ::hailo_preprocess_transform_info_t, mapping the model's input coordinates
+         *  to the source frame coordinates - can be used in order to map detections back to the source frame.
+         *  Otherwise, returns Unexpected of ::hailo_status error.
+         * @note In case pre-processing is disabled, returns an unexpected of ::HAILO_INVALID_OPERATION.
+         */
+        Expected<hailo_preprocess_transform_info_t> get_preprocess_transform_info() const;
+
     private:
         friend class InferModelBase;
         friend class InferModelHrpcClient;
@@ -72,6 +72,18 @@ struct LatencyMeasurementResult {
     std::chrono::nanoseconds avg_hw_latency;
 };
 
+/** Latency measurement result info with the latency distribution */
+struct LatencyMeasurementResultExt {
+    std::chrono::nanoseconds avg_hw_latency;
+    /** Latency percentiles and maximum of the measured frames (percentiles are accurate up to ~3%) */
+    std::chrono::nanoseconds p50_hw_latency;
+    std::chrono::nanoseconds p95_hw_latency;
+    std::chrono::nanoseconds p99_hw_latency;
+    std::chrono::nanoseconds max_hw_latency;
+    /** Number of frames measured */
+    uint64_t measured_frames_count;
+};
+
 struct HwInferResults {
     uint16_t batch_count;
     size_t total_transfer_size;
@@ -213,6 +225,18 @@ public:
      */
     virtual Expected<LatencyMeasurementResult> get_latency_measurement(const std::string &network_name="") = 0;
 
+    /**
+     * Returns the latency distribution of the measured frames.
+     * If ::HAILO_LATENCY_CLEAR_AFTER_GET was set, each call returns only the frames measured since the previous call.
+     *
+     * @param[in]  network_name             Network name of the requested latency measurement.
+     *                                      If not passed, all the networks in the network group will be addressed,
+     *                                      and the resulted measurement is of the frames of all networks.
+     * @return Upon success, returns Expected of LatencyMeasurementResultExt object containing the output latency result.
+     *         Otherwise, returns Unexpected of ::hailo_status error.
+     */
+    virtual Expected<LatencyMeasurementResultExt> get_latency_measurement_ext(const std::string &network_name="") = 0;
+
     /**
      * Gets output streams and their vstream params from vstreams names.
      *
@@ -15,11 +15,18 @@
 
 #include <math.h>
 #include <fenv.h>
+#include <string.h>
+#include <type_traits>
+#include <algorithm>
 
 static const float32_t INVALID_QP_VALUE = 0;
 
 #ifdef _MSC_VER
 #include <immintrin.h>
+#elif defined(__F16C__)
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
 #endif
 
 /** hailort namespace */
@@ -56,6 +63,126 @@ private:
     int m_original_rounding_method;
 };
 
+inline uint32_t float32_to_bits(float32_t value)
+{
+    uint32_t bits = 0;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+inline float32_t bits_to_float32(uint32_t bits)
+{
+    float32_t value = 0;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/*! IEEE 754 half precision floating point value (matches ::HAILO_FORMAT_TYPE_FLOAT16), stored as its raw bits. */
+struct fp16_t final
+{
+    fp16_t() = default;
+
+    /** Converts an arithmetic value to half precision, rounding to nearest even. */
+    template <typename U, typename = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+    fp16_t(U value) :
+        bits(from_float32(static_cast<float32_t>(value)))
+    {}
+
+    operator float32_t() const
+    {
+        return to_float32(bits);
+    }
+
+    static inline uint16_t from_float32(float32_t value)
+    {
+        static const uint32_t F16_MAX_AS_F32 = (127 + 16) << 23;
+        static const uint32_t F32_INFINITY = 255 << 23;
+        static const uint32_t F16_MIN_NORMAL_AS_F32 = 113 << 23;
+        static const uint32_t DENORM_MAGIC = ((127 - 15) + (23 - 10) + 1) << 23;
+
+        uint32_t f = float32_to_bits(value);
+        const uint32_t sign = f & 0x80000000u;
+        f ^= sign;
+
+        uint32_t result = 0;
+        if (f >= F16_MAX_AS_F32) {
+            // Overflow to infinity, NaN stays (quiet) NaN
+            result = (f > F32_INFINITY) ? 0x7E00 : 0x7C00;
+        } else if (f < F16_MIN_NORMAL_AS_F32) {
+            // Subnormal or zero - let the FPU do the rounding
+            result = float32_to_bits(bits_to_float32(f) + bits_to_float32(DENORM_MAGIC)) - DENORM_MAGIC;
+        } else {
+            const uint32_t mantissa_odd = (f >> 13) & 1;
+            f += (static_cast<uint32_t>(15 - 127) << 23) + 0xFFF;
+            f += mantissa_odd;
+            result = f >> 13;
+        }
+        return static_cast<uint16_t>(result | (sign >> 16));
+    }
+
+    static inline float32_t to_float32(uint16_t half)
+    {
+        static const uint32_t SHIFTED_EXP = 0x7C00 << 13;
+        static const uint32_t MAGIC = 113 << 23;
+
+        uint32_t f = (half & 0x7FFFu) << 13;
+        const uint32_t exp = SHIFTED_EXP & f;
+        f += (127 - 15) << 23;
+        if (SHIFTED_EXP == exp) {
+            // Infinity / NaN
+            f += (128 - 16) << 23;
+        } else if (0 == exp) {
+            // Zero / subnormal - renormalize
+            f += 1 << 23;
+            f = float32_to_bits(bits_to_float32(f) - bits_to_float32(MAGIC));
+        }
+        f |= static_cast<uint32_t>(half & 0x8000u) << 16;
+        return bits_to_float32(f);
+    }
+
+    uint16_t bits;
+};
+
+/*! bfloat16 floating point value (matches ::HAILO_FORMAT_TYPE_BFLOAT16) - the upper 16 bits of a float32_t. */
+struct bf16_t final
+{
+    bf16_t() = default;
+
+    /** Converts an arithmetic value to bfloat16, rounding to nearest even. */
+    template <typename U, typename = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+    bf16_t(U value) :
+        bits(from_float32(static_cast<float32_t>(value)))
+    {}
+
+    operator float32_t() const
+    {
+        return to_float32(bits);
+    }
+
+    static inline uint16_t from_float32(float32_t value)
+    {
+        const uint32_t f = float32_to_bits(value);
+        const uint32_t rounded = (f + 0x7FFF + ((f >> 16) & 1)) >> 16;
+        const uint32_t quiet_nan = (f >> 16) | 0x40;
+        // Branch free, so loops over buffers can be auto-vectorized
+        return static_cast<uint16_t>(((f & 0x7FFFFFFFu) > 0x7F800000u) ? quiet_nan : rounded);
+    }
+
+    static inline float32_t to_float32(uint16_t bfloat)
+    {
+        return bits_to_float32(static_cast<uint32_t>(bfloat) << 16);
+    }
+
+    uint16_t bits;
+};
+
+static_assert(sizeof(fp16_t) == sizeof(uint16_t), "fp16_t must be 2 bytes");
+static_assert(sizeof(bf16_t) == sizeof(uint16_t), "bf16_t must be 2 bytes");
+
+template <typename T>
+struct is_half_float : std::integral_constant<bool,
+    std::is_same<T, fp16_t>::value || std::is_same<T, bf16_t>::value> {};
+
 /*! Hailo device requires input data to be quantized/scaled before it is sent. Similarly, data outputted
  * from the device needs to be 'de-quantized'/rescaled as well.
  * When a neural network is compiled, each input/output layer in the neural network is assigned two floating point values
@@ -83,15 +210,7 @@ public:
     template <typename T, typename Q>
     static void dequantize_output_buffer(Q *src_ptr, T *dst_ptr, uint32_t buffer_elements_count, hailo_quant_info_t quant_info)
     {
-        if (is_identity_qp(quant_info)) {
-            for (uint32_t i = 0; i < buffer_elements_count; i++) {
-                dst_ptr[i] = (T)(src_ptr[i]);
-            }
-        } else {
-            for (uint32_t i = 0; i < buffer_elements_count; i++) {
-                dst_ptr[i] = dequantize_output<T, Q>(src_ptr[i], quant_info);
-            }
-        }
+        dequantize_output_buffer_impl<T, Q>(src_ptr, dst_ptr, buffer_elements_count, quant_info, is_half_float<T>());
     }
 
     /**
@@ -119,15 +238,7 @@ public:
     template <typename T, typename Q>
     static void dequantize_output_buffer_in_place(T *dst_ptr, uint32_t offset, uint32_t buffer_elements_count, float32_t qp_zp, float32_t qp_scale)
     {
-        if (is_identity_qp(qp_zp, qp_scale)) {
-            for (int32_t i = (int32_t)buffer_elements_count - 1; i >= 0; i--) {
-                dst_ptr[offset + i] = (T)(*((Q*)dst_ptr + offset + i));
-            }
-        } else {
-            for (int32_t i = (int32_t)buffer_elements_count - 1; i >= 0; i--) {
-                dst_ptr[offset + i] = dequantize_output<T, Q>(*((Q*)dst_ptr + offset + i), qp_zp, qp_scale);
-            }
-        }
+        dequantize_output_buffer_in_place_impl<T, Q>(dst_ptr, offset, buffer_elements_count, qp_zp, qp_scale, is_half_float<T>());
     }
 
     /**
@@ -141,16 +252,7 @@ public:
     template <typename T, typename Q>
     static void quantize_input_buffer(T *src_ptr, Q *dst_ptr, uint32_t buffer_elements_count, hailo_quant_info_t quant_info)
     {
-        auto rounding_tonearest_guard = RoundingToNearestGuard();
-        if (is_identity_qp(quant_info)) {
-            for (uint32_t i = 0; i < buffer_elements_count; i++) {
-                dst_ptr[i] = (Q)bankers_round(src_ptr[i]);
-            }
-        } else {
-            for (uint32_t i = 0; i < buffer_elements_count; i++) {
-                dst_ptr[i] = quantize_input<T, Q>(src_ptr[i], quant_info);
-            }
-        }
+        quantize_input_buffer_impl<T, Q>(src_ptr, dst_ptr, buffer_elements_count, quant_info, is_half_float<T>());
     }
 
     /**
@@ -258,7 +360,193 @@ public:
             && (quant_info.limvals_min == INVALID_QP_VALUE) && (quant_info.limvals_max == INVALID_QP_VALUE));
     }
 
+    /**
+     * Converts @a elements_count float32_t values pointed by @a src_ptr to half precision values in @a dst_ptr.
+     * Uses F16C (x86) or NEON (aarch64) conversion instructions when the library is compiled with them.
+     *
+     * @param[in] src_ptr                   A pointer to the float32_t source buffer.
+     * @param[out] dst_ptr                  A pointer to the half precision destination buffer.
+     * @param[in] elements_count            The number of elements to convert.
+     */
+    static inline void convert_float32_buffer(const float32_t *src_ptr, fp16_t *dst_ptr, uint32_t elements_count)
+    {
+        uint32_t i = 0;
+#if defined(__F16C__)
+        for (; (i + 8) <= elements_count; i += 8) {
+            const __m256 values = _mm256_loadu_ps(src_ptr + i);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_ptr + i), _mm256_cvtps_ph(values, _MM_FROUND_TO_NEAREST_INT));
+        }
+#elif defined(__aarch64__)
+        for (; (i + 4) <= elements_count; i += 4) {
+            const float16x4_t values = vcvt_f16_f32(vld1q_f32(src_ptr + i));
+            vst1_u16(reinterpret_cast<uint16_t*>(dst_ptr + i), vreinterpret_u16_f16(values));
+        }
+#endif
+        for (; i < elements_count; i++) {
+            dst_ptr[i].bits = fp16_t::from_float32(src_ptr[i]);
+        }
+    }
+
+    /**
+     * Converts @a elements_count float32_t values pointed by @a src_ptr to bfloat16 values in @a dst_ptr.
+     *
+     * @param[in] src_ptr                   A pointer to the float32_t source buffer.
+     * @param[out] dst_ptr                  A pointer to the bfloat16 destination buffer.
+     * @param[in] elements_count            The number of elements to convert.
+     */
+    static inline void convert_float32_buffer(const float32_t *src_ptr, bf16_t *dst_ptr, uint32_t elements_count)
+    {
+        for (uint32_t i = 0; i < elements_count; i++) {
+            dst_ptr[i].bits = bf16_t::from_float32(src_ptr[i]);
+        }
+    }
+
+    /**
+     * Converts @a elements_count half precision values pointed by @a src_ptr to float32_t values in @a dst_ptr.
+     * Uses F16C (x86) or NEON (aarch64) conversion instructions when the library is compiled with them.
+     *
+     * @param[in] src_ptr                   A pointer to the half precision source buffer.
+     * @param[out] dst_ptr                  A pointer to the float32_t destination buffer.
+     * @param[in] elements_count            The number of elements to convert.
+     */
+    static inline void convert_to_float32_buffer(const fp16_t *src_ptr, float32_t *dst_ptr, uint32_t elements_count)
+    {
+        uint32_t i = 0;
+#if defined(__F16C__)
+        for (; (i + 8) <= elements_count; i += 8) {
+            const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_ptr + i));
+            _mm256_storeu_ps(dst_ptr + i, _mm256_cvtph_ps(values));
+        }
+#elif defined(__aarch64__)
+        for (; (i + 4) <= elements_count; i += 4) {
+            const float16x4_t values = vreinterpret_f16_u16(vld1_u16(reinterpret_cast<const uint16_t*>(src_ptr + i)));
+            vst1q_f32(dst_ptr + i, vcvt_f32_f16(values));
+        }
+#endif
+        for (; i < elements_count; i++) {
+            dst_ptr[i] = fp16_t::to_float32(src_ptr[i].bits);
+        }
+    }
+
+    /**
+     * Converts @a elements_count bfloat16 values pointed by @a src_ptr to float32_t values in @a dst_ptr.
+     *
+     * @param[in] src_ptr                   A pointer to the bfloat16 source buffer.
+     * @param[out] dst_ptr                  A pointer to the float32_t destination buffer.
+     * @param[in] elements_count            The number of elements to convert.
+     */
+    static inline void convert_to_float32_buffer(const bf16_t *src_ptr, float32_t *dst_ptr, uint32_t elements_count)
+    {
+        for (uint32_t i = 0; i < elements_count; i++) {
+            dst_ptr[i] = bf16_t::to_float32(src_ptr[i].bits);
+        }
+    }
+
 private:
+    // Half precision buffers are converted in blocks through a float32_t scratch buffer on the stack,
+    // so the (de)quantization math stays in float32_t and the conversion itself can be vectorized.
+    // Not defined out of line (this is a header only class), so it must not be odr-used - e.g. passed to std::min as is.
+    static const uint32_t HALF_FLOAT_CONVERSION_BLOCK_SIZE = 64;
+
+    template <typename T, typename Q>
+    static void dequantize_output_buffer_impl(Q *src_ptr, T *dst_ptr, uint32_t buffer_elements_count, hailo_quant_info_t quant_info,
+        std::false_type /* is_half_float */)
+    {
+        if (is_identity_qp(quant_info)) {
+            for (uint32_t i = 0; i < buffer_elements_count; i++) {
+                dst_ptr[i] = (T)(src_ptr[i]);
+            }
+        } else {
+            for (uint32_t i = 0; i < buffer_elements_count; i++) {
+                dst_ptr[i] = dequantize_output<T, Q>(src_ptr[i], quant_info);
+            }
+        }
+    }
+
+    template <typename T, typename Q>
+    static void dequantize_output_buffer_impl(Q *src_ptr, T *dst_ptr, uint32_t buffer_elements_count, hailo_quant_info_t quant_info,
+        std::true_type /* is_half_float */)
+    {
+        const bool is_identity = is_identity_qp(quant_info);
+        float32_t block[HALF_FLOAT_CONVERSION_BLOCK_SIZE];
+        for (uint32_t i = 0; i < buffer_elements_count; i += HALF_FLOAT_CONVERSION_BLOCK_SIZE) {
+            const uint32_t block_size = std::min(uint32_t{HALF_FLOAT_CONVERSION_BLOCK_SIZE}, buffer_elements_count - i);
+            for (uint32_t j = 0; j < block_size; j++) {
+                block[j] = is_identity ? (float32_t)(src_ptr[i + j]) :
+                    dequantize_output<float32_t, Q>(src_ptr[i + j], quant_info.qp_zp, quant_info.qp_scale);
+            }
+            convert_float32_buffer(block, dst_ptr + i, block_size);
+        }
+    }
+
+    template <typename T, typename Q>
+    static void dequantize_output_buffer_in_place_impl(T *dst_ptr, uint32_t offset, uint32_t buffer_elements_count, float32_t qp_zp,
+        float32_t qp_scale, std::false_type /* is_half_float */)
+    {
+        if (is_identity_qp(qp_zp, qp_scale)) {
+            for (int32_t i = (int32_t)buffer_elements_count - 1; i >= 0; i--) {
+                dst_ptr[offset + i] = (T)(*((Q*)dst_ptr + offset + i));
+            }
+        } else {
+            for (int32_t i = (int32_t)buffer_elements_count - 1; i >= 0; i--) {
+                dst_ptr[offset + i] = dequantize_output<T, Q>(*((Q*)dst_ptr + offset + i), qp_zp, qp_scale);
+            }
+        }
+    }
+
+    template <typename T, typename Q>
+    static void dequantize_output_buffer_in_place_impl(T *dst_ptr, uint32_t offset, uint32_t buffer_elements_count, float32_t qp_zp,
+        float32_t qp_scale, std::true_type /* is_half_float */)
+    {
+        static_assert(sizeof(T) >= sizeof(Q), "In place de-quantization requires the dst type to be at least as wide as the src type");
+        // Blocks are handled from the end of the buffer, so the dst elements written never overrun src elements not read yet
+        const bool is_identity = is_identity_qp(qp_zp, qp_scale);
+        float32_t block[HALF_FLOAT_CONVERSION_BLOCK_SIZE];
+        uint32_t end = buffer_elements_count;
+        while (end > 0) {
+            const uint32_t block_size = std::min(uint32_t{HALF_FLOAT_CONVERSION_BLOCK_SIZE}, end);
+            const uint32_t start = end - block_size;
+            const Q *src_ptr = (Q*)dst_ptr + offset + start;
+            for (uint32_t j = 0; j < block_size; j++) {
+                block[j] = is_identity ? (float32_t)(src_ptr[j]) : dequantize_output<float32_t, Q>(src_ptr[j], qp_zp, qp_scale);
+            }
+            convert_float32_buffer(block, dst_ptr + offset + start, block_size);
+            end = start;
+        }
+    }
+
+    template <typename T, typename Q>
+    static void quantize_input_buffer_impl(T *src_ptr, Q *dst_ptr, uint32_t buffer_elements_count, hailo_quant_info_t quant_info,
+        std::false_type /* is_half_float */)
+    {
+        auto rounding_tonearest_guard = RoundingToNearestGuard();
+        if (is_identity_qp(quant_info)) {
+            for (uint32_t i = 0; i < buffer_elements_count; i++) {
+                dst_ptr[i] = (Q)bankers_round(src_ptr[i]);
+            }
+        } else {
+            for (uint32_t i = 0; i < buffer_elements_count; i++) {
+                dst_ptr[i] = quantize_input<T, Q>(src_ptr[i], quant_info);
+            }
+        }
+    }
+
+    template <typename T, typename Q>
+    static void quantize_input_buffer_impl(T *src_ptr, Q *dst_ptr, uint32_t buffer_elements_count, hailo_quant_info_t quant_info,
+        std::true_type /* is_half_float */)
+    {
+        auto rounding_tonearest_guard = RoundingToNearestGuard();
+        const bool is_identity = is_identity_qp(quant_info);
+        float32_t block[HALF_FLOAT_CONVERSION_BLOCK_SIZE];
+        for (uint32_t i = 0; i < buffer_elements_count; i += HALF_FLOAT_CONVERSION_BLOCK_SIZE) {
+            const uint32_t block_size = std::min(uint32_t{HALF_FLOAT_CONVERSION_BLOCK_SIZE}, buffer_elements_count - i);
+            convert_to_float32_buffer(src_ptr + i, block, block_size);
+            for (uint32_t j = 0; j < block_size; j++) {
+                dst_ptr[i + j] = is_identity ? (Q)bankers_round(block[j]) : quantize_input<float32_t, Q>(block[j], quant_info);
+            }
+        }
+    }
+
     template <typename T, typename Q>
     static inline Q quantize_input(T number, hailo_quant_info_t quant_info)
     {
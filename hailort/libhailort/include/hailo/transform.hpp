@@ -25,7 +25,7 @@ namespace hailort
 {
 
 /*! Object used for input stream transformation*/
-class HAILORTAPI InputTransformContext final
+class HAILORTAPI InputTransformContext
 {
 public:
 
@@ -105,6 +105,18 @@ public:
      */
     hailo_status transform(const MemoryView src, MemoryView dst);
 
+    /**
+     * Transforms a multi-planar input frame referred by @a src directly to the buffer referred by @a dst.
+     * The planes don't have to be contiguous in memory.
+     * 
+     * @param[in]  src          A src pix buffer to be transformed, with memory of type ::HAILO_PIX_BUFFER_MEMORY_TYPE_USERPTR.
+     * @param[out] dst          A dst buffer that receives the transformed data.
+     * @return Upon success, returns ::HAILO_SUCCESS. Otherwise, returns a ::hailo_status error.
+     * @note When the transformation only repacks the planes (e.g. ::HAILO_FORMAT_ORDER_NV12 to ::HAILO_FORMAT_ORDER_HAILO_YYUV),
+     *       each plane is read from its own buffer. Otherwise, the planes are copied to a contiguous buffer first.
+     */
+    hailo_status transform(const hailo_pix_buffer_t &src, MemoryView dst);
+
     /**
      * @return The size of the src frame on the host side in bytes.
      */
@@ -152,7 +164,11 @@ public:
      */
     virtual std::string description() const;
 
+    virtual ~InputTransformContext() = default;
+
 private:
+    friend class FrameInputTransformContext;
+
     InputTransformContext(size_t src_frame_size, const hailo_3d_image_shape_t &src_image_shape,
         const hailo_format_t &src_format, size_t dst_frame_size, const hailo_3d_image_shape_t &dst_image_shape,
         const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_infos, Buffer &&quant_buffer,
@@ -172,6 +188,9 @@ private:
 
     hailo_status quantize_stream(const void *src_ptr, void *quant_buffer);
 
+    // Returns a buffer of the given size for gathering the planes of a non-contiguous pix buffer
+    virtual Expected<MemoryView> planes_buffer(size_t size) = 0;
+
     const size_t m_src_frame_size;
     const hailo_3d_image_shape_t m_src_image_shape;
     const hailo_format_t m_src_format;
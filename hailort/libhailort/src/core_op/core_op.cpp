@@ -65,19 +65,31 @@ CoreOp::CoreOp(
     status = HAILO_SUCCESS;
 }
 
-Expected<std::chrono::nanoseconds> get_latency(LatencyMeterPtr &latency_meter, bool clear)
+Expected<LatencyHistogram::Snapshot> get_latency_histogram(LatencyMeterPtr &latency_meter, bool clear)
 {
     TRY_WITH_ACCEPTABLE_STATUS(HAILO_NOT_AVAILABLE, auto hw_latency,
-        latency_meter->get_latency(clear), "Failed getting latency");
+        latency_meter->get_latency_histogram(clear), "Failed getting latency");
 
     return hw_latency;
 }
 
+static LatencyMeasurementResultExt to_latency_measurement_result(const LatencyHistogram::Snapshot &histogram,
+    std::chrono::nanoseconds avg_hw_latency)
+{
+    LatencyMeasurementResultExt result = {};
+    result.avg_hw_latency = avg_hw_latency;
+    result.p50_hw_latency = histogram.percentile(50);
+    result.p95_hw_latency = histogram.percentile(95);
+    result.p99_hw_latency = histogram.percentile(99);
+    result.max_hw_latency = histogram.max;
+    result.measured_frames_count = histogram.count;
+    return result;
+}
+
 /* Network group base functions */
-Expected<LatencyMeasurementResult> CoreOp::get_latency_measurement(const std::string &network_name)
+Expected<LatencyMeasurementResultExt> CoreOp::get_latency_measurement_ext(const std::string &network_name)
 {
     bool clear = ((m_config_params.latency & HAILO_LATENCY_CLEAR_AFTER_GET) == HAILO_LATENCY_CLEAR_AFTER_GET);
-    LatencyMeasurementResult result = {};
 
     TRY(auto latency_meters, get_latency_meters());
 
@@ -85,33 +97,35 @@ Expected<LatencyMeasurementResult> CoreOp::get_latency_measurement(const std::st
         if (1 != m_input_streams.size()) {
             return make_unexpected(HAILO_NOT_AVAILABLE);
         }
+        // The average is the average of the networks latencies, the distribution is of all of the networks frames.
+        LatencyHistogram::Snapshot merged_histogram{};
         std::chrono::nanoseconds latency_sum(0);
         uint32_t measurements_count = 0;
         for (auto &latency_meter_pair : *latency_meters.get()) {
-            auto hw_latency = get_latency(latency_meter_pair.second, clear);
+            auto hw_latency = get_latency_histogram(latency_meter_pair.second, clear);
             if (HAILO_NOT_AVAILABLE == hw_latency.status()) {
                 continue;
             }
             CHECK_EXPECTED(hw_latency); // TODO (HRT-13278): Figure out how to remove CHECK_EXPECTED here
-            latency_sum += hw_latency.value();
+            latency_sum += hw_latency->mean();
+            merged_histogram.merge(hw_latency.value());
             measurements_count++;
         }
         if (0 == measurements_count) {
             LOGGER__DEBUG("No latency measurements was found");
             return make_unexpected(HAILO_NOT_AVAILABLE);
         }
-        result.avg_hw_latency = latency_sum / measurements_count;
+        return to_latency_measurement_result(merged_histogram, latency_sum / measurements_count);
     } else {
         if(!contains(*latency_meters, network_name)) {
             LOGGER__DEBUG("No latency measurements was found for network {}", network_name);
             return make_unexpected(HAILO_NOT_FOUND);
         }
         TRY_WITH_ACCEPTABLE_STATUS(HAILO_NOT_AVAILABLE, const auto hw_latency,
-            get_latency(latency_meters->at(network_name), clear));
+            get_latency_histogram(latency_meters->at(network_name), clear));
 
-        result.avg_hw_latency = hw_latency;
+        return to_latency_measurement_result(hw_latency, hw_latency.mean());
     }
-    return result;
 }
 
 hailo_status CoreOp::activate(uint16_t dynamic_batch_size)
@@ -75,7 +75,7 @@ public:
     virtual std::vector<std::reference_wrapper<OutputStream>> get_output_streams_by_interface(hailo_stream_interface_t stream_interface);
     virtual ExpectedRef<InputStreamBase> get_input_stream_by_name(const std::string& name);
     virtual ExpectedRef<OutputStreamBase> get_output_stream_by_name(const std::string& name);
-    virtual Expected<LatencyMeasurementResult> get_latency_measurement(const std::string &network_name="");
+    virtual Expected<LatencyMeasurementResultExt> get_latency_measurement_ext(const std::string &network_name="");
 
     hailo_status activate(uint16_t dynamic_batch_size = CONTROL_PROTOCOL__IGNORE_DYNAMIC_BATCH_SIZE);
     hailo_status deactivate();
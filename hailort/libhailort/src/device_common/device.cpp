@@ -105,6 +105,10 @@ Expected<std::unique_ptr<Device>> Device::create(const std::string &device_id)
     if (IntegratedDevice::DEVICE_ID == device_id) {
         return create_core();
     }
+    else if (HailoRTDriver::EMULATED_DEVICE_ID == device_id) {
+        TRY(auto emulated_device, PcieDevice::create_emulated());
+        return std::unique_ptr<Device>(std::move(emulated_device));
+    }
     else if (auto pcie_info = PcieDevice::parse_pcie_device_info(device_id, DONT_LOG_ON_FAILURE)) {
         return create_pcie(pcie_info.release());
     }
@@ -191,6 +195,10 @@ Expected<Device::Type> Device::get_device_type(const std::string &device_id)
     if (IntegratedDevice::DEVICE_ID == device_id) {
         return Type::INTEGRATED;
     }
+    else if (HailoRTDriver::EMULATED_DEVICE_ID == device_id) {
+        // The emulated device is a pcie device
+        return Type::PCIE;
+    }
     else if (auto pcie_info = PcieDevice::parse_pcie_device_info(device_id, DONT_LOG_ON_FAILURE)) {
         return Type::PCIE;
     }
@@ -206,8 +214,8 @@ Expected<Device::Type> Device::get_device_type(const std::string &device_id)
 bool Device::device_ids_equal(const std::string &first, const std::string &second)
 {
     const bool DONT_LOG_ON_FAILURE = false;
-    if (IntegratedDevice::DEVICE_ID == first) {
-        // On integrated devices device all ids should be the same
+    if ((IntegratedDevice::DEVICE_ID == first) || (HailoRTDriver::EMULATED_DEVICE_ID == first)) {
+        // On integrated/emulated devices device all ids should be the same
         return first == second;
     } else if (auto first_pcie_info = PcieDevice::parse_pcie_device_info(first, DONT_LOG_ON_FAILURE)) {
         auto second_pcie_info = PcieDevice::parse_pcie_device_info(second, DONT_LOG_ON_FAILURE);
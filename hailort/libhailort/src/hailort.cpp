@@ -25,6 +25,7 @@
 
 #include "common/compiler_extensions_compat.hpp"
 #include "common/os_utils.hpp"
+#include "common/thread_policy.hpp"
 
 #include "device_common/control.hpp"
 #include "eth/eth_device.hpp"
@@ -73,6 +74,14 @@ hailo_status hailo_get_library_version(hailo_version_t *version)
     return HAILO_SUCCESS;
 }
 
+hailo_status hailo_set_thread_policy(const char *thread_policy)
+{
+    const std::string thread_policy_str = (nullptr == thread_policy) ? "" : thread_policy;
+    auto status = ThreadPolicyConfig::get_instance().set(thread_policy_str);
+    CHECK_SUCCESS(status, "Invalid thread policy '{}'", thread_policy_str);
+    return HAILO_SUCCESS;
+}
+
 // TODO(oro): wrap with try/catch over C++
 // TODO: Fill eth_device_infos_length items into pcie_device_infos,
 //       even if 'scan_results->size() > eth_device_infos_length' (HRT-3163)
@@ -1060,6 +1069,29 @@ HAILORTAPI hailo_status hailo_get_latency_measurement(hailo_configured_network_g
     return HAILO_SUCCESS;
 }
 
+HAILORTAPI hailo_status hailo_get_latency_measurement_ext(hailo_configured_network_group configured_network_group,
+    const char *network_name, hailo_latency_measurement_result_ext_t *result)
+{
+    CHECK_ARG_NOT_NULL(configured_network_group);
+    CHECK_ARG_NOT_NULL(result);
+
+    std::string network_name_str = (nullptr == network_name) ? "" : network_name;
+
+    auto latency_result = ((ConfiguredNetworkGroup*)configured_network_group)->get_latency_measurement_ext(network_name_str);
+    CHECK_EXPECTED_AS_STATUS(latency_result);
+
+    hailo_latency_measurement_result_ext_t local_result {};
+    local_result.avg_hw_latency_ms = std::chrono::duration<double, std::milli>(latency_result->avg_hw_latency).count();
+    local_result.p50_hw_latency_ms = std::chrono::duration<double, std::milli>(latency_result->p50_hw_latency).count();
+    local_result.p95_hw_latency_ms = std::chrono::duration<double, std::milli>(latency_result->p95_hw_latency).count();
+    local_result.p99_hw_latency_ms = std::chrono::duration<double, std::milli>(latency_result->p99_hw_latency).count();
+    local_result.max_hw_latency_ms = std::chrono::duration<double, std::milli>(latency_result->max_hw_latency).count();
+    local_result.measured_frames_count = latency_result->measured_frames_count;
+
+    *result = local_result;
+    return HAILO_SUCCESS;
+}
+
 hailo_status hailo_set_scheduler_timeout(hailo_configured_network_group configured_network_group,
     uint32_t timeout_ms, const char *network_name)
 {
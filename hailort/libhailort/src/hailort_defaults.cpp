@@ -182,6 +182,17 @@ hailo_vstream_params_t HailoRTDefaults::get_vstreams_params(bool /*unused*/, hai
     return params;
 }
 
+hailo_preprocess_params_t HailoRTDefaults::get_preprocess_params()
+{
+    hailo_preprocess_params_t params{};
+    params.resize_mode = HAILO_RESIZE_MODE_NONE;
+    params.src_order = HAILO_FORMAT_ORDER_NHWC;
+    for (size_t i = 0; i < HAILO_PREPROCESS_MAX_CHANNELS; i++) {
+        params.std[i] = 1.0f;
+    }
+    return params;
+}
+
 hailo_transform_params_t HailoRTDefaults::get_transform_params(const hailo_stream_info_t &stream_info)
 {
     hailo_transform_params_t params{};
@@ -106,6 +106,7 @@ static std::string get_shape_str(const hailo_vstream_info_t &vstream_info)
     {
     case HAILO_FORMAT_ORDER_HAILO_NMS:
     case HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK:
+    case HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE:
         return HailoRTCommon::get_format_type_str(vstream_info.format.type) + ", " + HailoRTCommon::get_format_order_str(vstream_info.format.order) +
             "(number of classes: " + std::to_string(vstream_info.nms_shape.number_of_classes) +
             ", maximum bounding boxes per class: " + std::to_string(vstream_info.nms_shape.max_bboxes_per_class) +
@@ -22,6 +22,9 @@ namespace net_flow
 
 // Source https://stackoverflow.com/questions/3793838/which-is-the-first-integer-that-an-ieee-754-float-is-incapable-of-representing-e
 #define FLOAT_LAST_CONSECUTIVE_REPRESENTABLE_INT (1 << std::numeric_limits<float32_t>::digits)
+// Half precision has an 11 bit significand, bfloat16 has an 8 bit significand
+#define FLOAT16_LAST_CONSECUTIVE_REPRESENTABLE_INT (1 << 11)
+#define BFLOAT16_LAST_CONSECUTIVE_REPRESENTABLE_INT (1 << 8)
 
 hailo_status ArgmaxPostProcessOp::execute_not_supported(const BufferMetaData &input_metadata, const BufferMetaData &output_metadata,
     const std::map<std::string, MemoryView> &inputs, std::map<std::string, MemoryView> &outputs)
@@ -35,7 +38,7 @@ hailo_status ArgmaxPostProcessOp::execute_not_supported(const BufferMetaData &in
         return HAILO_INVALID_ARGUMENT;
     }
 
-ArgmaxFunction ArgmaxPostProcessOp::m_argmax_function_array[ARGMAX_NUM_OF_POSSIBLE_FORMAT_ORDERS][ARGMAX_NUM_OF_POSSIBLE_FORMAT_TYPES][ARGMAX_NUM_OF_POSSIBLE_FORMAT_TYPES]
+ArgmaxFunction ArgmaxPostProcessOp::m_argmax_function_array[ARGMAX_NUM_OF_POSSIBLE_FORMAT_ORDERS][ARGMAX_NUM_OF_POSSIBLE_FORMAT_TYPES][ARGMAX_NUM_OF_POSSIBLE_OUTPUT_FORMAT_TYPES]
 {
     {
         {
@@ -44,6 +47,8 @@ ArgmaxFunction ArgmaxPostProcessOp::m_argmax_function_array[ARGMAX_NUM_OF_POSSIB
             ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported,
+            ArgmaxPostProcessOp::execute_not_supported,
+            ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported
         },
         {
@@ -51,14 +56,18 @@ ArgmaxFunction ArgmaxPostProcessOp::m_argmax_function_array[ARGMAX_NUM_OF_POSSIB
             ArgmaxPostProcessOp::execute_not_supported, // We don't support output_format_type to be auto
             ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<uint8_t, uint8_t>,
             ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<uint8_t, uint16_t>,
-            ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<uint8_t, float32_t>
+            ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<uint8_t, float32_t>,
+            ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<uint8_t, fp16_t>,
+            ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<uint8_t, bf16_t>
         },
         {
             // NHCW x UINT16
             ArgmaxPostProcessOp::execute_not_supported, // We don't support output_format_type to be auto
             ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<uint16_t, uint8_t>,
             ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<uint16_t, uint16_t>,
-            ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<uint16_t, float32_t>
+            ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<uint16_t, float32_t>,
+            ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<uint16_t, fp16_t>,
+            ArgmaxPostProcessOp::NHCW_to_NHW_feature_axis<uint16_t, bf16_t>
         },
         {
             // NHCW x FLOAT32
@@ -66,6 +75,8 @@ ArgmaxFunction ArgmaxPostProcessOp::m_argmax_function_array[ARGMAX_NUM_OF_POSSIB
             ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported,
+            ArgmaxPostProcessOp::execute_not_supported,
+            ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported
         }
     },
@@ -76,6 +87,8 @@ ArgmaxFunction ArgmaxPostProcessOp::m_argmax_function_array[ARGMAX_NUM_OF_POSSIB
             ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported,
+            ArgmaxPostProcessOp::execute_not_supported,
+            ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported
         },
         {
@@ -83,7 +96,9 @@ ArgmaxFunction ArgmaxPostProcessOp::m_argmax_function_array[ARGMAX_NUM_OF_POSSIB
             ArgmaxPostProcessOp::execute_not_supported, // We don't support output_format_type to be auto
             ArgmaxPostProcessOp::NHWC_to_NHW_feature_axis<uint8_t, uint8_t>,
             ArgmaxPostProcessOp::NHWC_to_NHW_feature_axis<uint8_t, uint16_t>,
-            ArgmaxPostProcessOp::NHWC_to_NHW_feature_axis<uint8_t, float32_t>
+            ArgmaxPostProcessOp::NHWC_to_NHW_feature_axis<uint8_t, float32_t>,
+            ArgmaxPostProcessOp::NHWC_to_NHW_feature_axis<uint8_t, fp16_t>,
+            ArgmaxPostProcessOp::NHWC_to_NHW_feature_axis<uint8_t, bf16_t>
         },
         {
             // NHWC x UINT16
@@ -91,12 +106,16 @@ ArgmaxFunction ArgmaxPostProcessOp::m_argmax_function_array[ARGMAX_NUM_OF_POSSIB
             ArgmaxPostProcessOp::NHWC_to_NHW_feature_axis<uint16_t, uint8_t>,
             ArgmaxPostProcessOp::NHWC_to_NHW_feature_axis<uint16_t, uint16_t>,
             ArgmaxPostProcessOp::NHWC_to_NHW_feature_axis<uint16_t, float32_t>,
+            ArgmaxPostProcessOp::NHWC_to_NHW_feature_axis<uint16_t, fp16_t>,
+            ArgmaxPostProcessOp::NHWC_to_NHW_feature_axis<uint16_t, bf16_t>
         },
         {
             // NHWC x FLOAT32
             ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported,
+            ArgmaxPostProcessOp::execute_not_supported,
+            ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported
         }
     },
@@ -107,6 +126,8 @@ ArgmaxFunction ArgmaxPostProcessOp::m_argmax_function_array[ARGMAX_NUM_OF_POSSIB
             ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported,
+            ArgmaxPostProcessOp::execute_not_supported,
+            ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported
         },
         {
@@ -115,6 +136,8 @@ ArgmaxFunction ArgmaxPostProcessOp::m_argmax_function_array[ARGMAX_NUM_OF_POSSIB
             ArgmaxPostProcessOp::NC_to_N<uint8_t, uint8_t>,
             ArgmaxPostProcessOp::NC_to_N<uint8_t, uint16_t>,
             ArgmaxPostProcessOp::NC_to_N<uint8_t, float32_t>,
+            ArgmaxPostProcessOp::NC_to_N<uint8_t, fp16_t>,
+            ArgmaxPostProcessOp::NC_to_N<uint8_t, bf16_t>
         },
         {
             // NC x UINT16
@@ -122,6 +145,8 @@ ArgmaxFunction ArgmaxPostProcessOp::m_argmax_function_array[ARGMAX_NUM_OF_POSSIB
             ArgmaxPostProcessOp::NC_to_N<uint16_t, uint8_t>,
             ArgmaxPostProcessOp::NC_to_N<uint16_t, uint16_t>,
             ArgmaxPostProcessOp::NC_to_N<uint16_t, float32_t>,
+            ArgmaxPostProcessOp::NC_to_N<uint16_t, fp16_t>,
+            ArgmaxPostProcessOp::NC_to_N<uint16_t, bf16_t>
         },
         {
             // NC x FLOAT32
@@ -129,6 +154,8 @@ ArgmaxFunction ArgmaxPostProcessOp::m_argmax_function_array[ARGMAX_NUM_OF_POSSIB
             ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported,
+            ArgmaxPostProcessOp::execute_not_supported,
+            ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported
         }
     },
@@ -139,6 +166,8 @@ ArgmaxFunction ArgmaxPostProcessOp::m_argmax_function_array[ARGMAX_NUM_OF_POSSIB
             ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported,
+            ArgmaxPostProcessOp::execute_not_supported,
+            ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported
         },
         {
@@ -147,6 +176,8 @@ ArgmaxFunction ArgmaxPostProcessOp::m_argmax_function_array[ARGMAX_NUM_OF_POSSIB
             ArgmaxPostProcessOp::F8CR_to_NHW_feature_axis<uint8_t, uint8_t>,
             ArgmaxPostProcessOp::F8CR_to_NHW_feature_axis<uint8_t, uint16_t>,
             ArgmaxPostProcessOp::F8CR_to_NHW_feature_axis<uint8_t, float32_t>,
+            ArgmaxPostProcessOp::F8CR_to_NHW_feature_axis<uint8_t, fp16_t>,
+            ArgmaxPostProcessOp::F8CR_to_NHW_feature_axis<uint8_t, bf16_t>
         },
         {
             // F8CR x UINT16
@@ -154,6 +185,8 @@ ArgmaxFunction ArgmaxPostProcessOp::m_argmax_function_array[ARGMAX_NUM_OF_POSSIB
             ArgmaxPostProcessOp::F8CR_to_NHW_feature_axis<uint16_t, uint8_t>,
             ArgmaxPostProcessOp::F8CR_to_NHW_feature_axis<uint16_t, uint16_t>,
             ArgmaxPostProcessOp::F8CR_to_NHW_feature_axis<uint16_t, float32_t>,
+            ArgmaxPostProcessOp::F8CR_to_NHW_feature_axis<uint16_t, fp16_t>,
+            ArgmaxPostProcessOp::F8CR_to_NHW_feature_axis<uint16_t, bf16_t>
         },
         {
             // F8CR x FLOAT32
@@ -161,6 +194,8 @@ ArgmaxFunction ArgmaxPostProcessOp::m_argmax_function_array[ARGMAX_NUM_OF_POSSIB
             ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported,
+            ArgmaxPostProcessOp::execute_not_supported,
+            ArgmaxPostProcessOp::execute_not_supported,
             ArgmaxPostProcessOp::execute_not_supported
         }
     }
@@ -246,7 +281,9 @@ hailo_status ArgmaxOpMetadata::validate_format_info()
     CHECK((
         ((output_metadata.format.type == HAILO_FORMAT_TYPE_UINT8) && (input_metadata.shape.features <= std::numeric_limits<uint8_t>::max())) ||
         ((output_metadata.format.type == HAILO_FORMAT_TYPE_UINT16) && (input_metadata.shape.features <= std::numeric_limits<uint16_t>::max())) ||
-        ((output_metadata.format.type == HAILO_FORMAT_TYPE_FLOAT32) && (input_metadata.shape.features <= FLOAT_LAST_CONSECUTIVE_REPRESENTABLE_INT))),
+        ((output_metadata.format.type == HAILO_FORMAT_TYPE_FLOAT32) && (input_metadata.shape.features <= FLOAT_LAST_CONSECUTIVE_REPRESENTABLE_INT)) ||
+        ((output_metadata.format.type == HAILO_FORMAT_TYPE_FLOAT16) && (input_metadata.shape.features <= FLOAT16_LAST_CONSECUTIVE_REPRESENTABLE_INT)) ||
+        ((output_metadata.format.type == HAILO_FORMAT_TYPE_BFLOAT16) && (input_metadata.shape.features <= BFLOAT16_LAST_CONSECUTIVE_REPRESENTABLE_INT))),
         HAILO_INVALID_OPERATION, "Output format type {} can't represent possible range {} for Argmax op",
         HailoRTCommon::get_format_type_str(output_metadata.format.type), input_metadata.shape.features);
     CHECK(
@@ -16,6 +16,7 @@
 
 
 #include "hailo/hailort.h"
+#include "hailo/quantization.hpp"
 #include "net_flow/ops/op.hpp"
 #include "net_flow/ops_metadata/argmax_op_metadata.hpp"
 #include "common/utils.hpp"
@@ -29,6 +30,7 @@ namespace net_flow
 
 #define ARGMAX_NUM_OF_POSSIBLE_FORMAT_ORDERS (4)
 #define ARGMAX_NUM_OF_POSSIBLE_FORMAT_TYPES (4)
+#define ARGMAX_NUM_OF_POSSIBLE_OUTPUT_FORMAT_TYPES (6)
 #define F8CR_FEATURES_IN_CHUNK (8)
 
 typedef hailo_status (*ArgmaxFunction)(const BufferMetaData &input_metadata, const BufferMetaData &output_metadata,
@@ -168,9 +170,9 @@ public:
     // A 3D array of argmax functions to call:
     // 1st dim represent the data format order
     // 2nd dim represent the input data type (only uint8 or uint16 are valid)
-    // 3rd dim represent the output data type
+    // 3rd dim represent the output data type (including the host-only FLOAT16 and BFLOAT16 types)
     // Note: Assumption here the ordering of the enum hailo_format_type_t doesn't change
-    static ArgmaxFunction m_argmax_function_array[ARGMAX_NUM_OF_POSSIBLE_FORMAT_ORDERS][ARGMAX_NUM_OF_POSSIBLE_FORMAT_TYPES][ARGMAX_NUM_OF_POSSIBLE_FORMAT_TYPES];
+    static ArgmaxFunction m_argmax_function_array[ARGMAX_NUM_OF_POSSIBLE_FORMAT_ORDERS][ARGMAX_NUM_OF_POSSIBLE_FORMAT_TYPES][ARGMAX_NUM_OF_POSSIBLE_OUTPUT_FORMAT_TYPES];
 
 };
 
@@ -38,8 +38,22 @@ std::string NmsOpMetadata::get_op_description()
 hailo_status NmsOpMetadata::validate_format_info()
 {
     for (const auto& output_metadata : m_outputs_metadata) {
-        CHECK(HAILO_FORMAT_ORDER_HAILO_NMS == output_metadata.second.format.order, HAILO_INVALID_ARGUMENT, "The given output format order {} is not supported, "
-            "should be HAILO_FORMAT_ORDER_HAILO_NMS", HailoRTCommon::get_format_order_str(output_metadata.second.format.order));
+        if (m_type == OperationType::IOU) {
+            // The IoU flow converts the device's NMS buffer in several elements, all of which work on the by-class layout
+            CHECK(HAILO_FORMAT_ORDER_HAILO_NMS == output_metadata.second.format.order, HAILO_INVALID_ARGUMENT, "The given output format order {} is not supported, "
+                "should be HAILO_FORMAT_ORDER_HAILO_NMS", HailoRTCommon::get_format_order_str(output_metadata.second.format.order));
+        } else {
+            CHECK((HAILO_FORMAT_ORDER_HAILO_NMS == output_metadata.second.format.order) ||
+                (HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE == output_metadata.second.format.order), HAILO_INVALID_ARGUMENT,
+                "The given output format order {} is not supported, should be HAILO_FORMAT_ORDER_HAILO_NMS or HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE",
+                HailoRTCommon::get_format_order_str(output_metadata.second.format.order));
+            if (HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE == output_metadata.second.format.order) {
+                const auto max_detections = static_cast<uint64_t>(m_nms_config.number_of_classes) * m_nms_config.max_proposals_per_class;
+                CHECK(max_detections <= HailoRTCommon::MAX_NMS_BY_SCORE_DETECTIONS, HAILO_INVALID_ARGUMENT,
+                    "HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE supports up to {} detections, got {} classes * {} proposals per class",
+                    HailoRTCommon::MAX_NMS_BY_SCORE_DETECTIONS, m_nms_config.number_of_classes, m_nms_config.max_proposals_per_class);
+            }
+        }
 
         CHECK(HAILO_FORMAT_TYPE_FLOAT32 == output_metadata.second.format.type, HAILO_INVALID_ARGUMENT, "The given output format type {} is not supported, "
             "should be HAILO_FORMAT_TYPE_FLOAT32", HailoRTCommon::get_format_type_str(output_metadata.second.format.type));
@@ -185,10 +199,59 @@ void NmsPostProcessOp::fill_nms_format_buffer(MemoryView &buffer, const std::vec
     }
 }
 
+void NmsPostProcessOp::fill_nms_by_score_format_buffer(MemoryView &buffer, const std::vector<DetectionBbox> &detections,
+    std::vector<uint32_t> &classes_detections_count, const NmsPostProcessConfig &nms_config)
+{
+    // The detections are already sorted by score (in remove_overlapping_boxes()), so they are written as is,
+    // while applying the per class limit and the buffer's capacity (top-K) on the way.
+    // The counter is uint16_t, so the capacity is limited as well (validated on creation, the limit here is in case
+    // max_proposals_per_class was changed since)
+    const size_t max_detections = std::min<size_t>((buffer.size() - sizeof(uint16_t)) / sizeof(hailo_detection_t),
+        HailoRTCommon::MAX_NMS_BY_SCORE_DETECTIONS);
+    for (auto &class_detections_count : classes_detections_count) {
+        class_detections_count = std::min(class_detections_count, nms_config.max_proposals_per_class);
+    }
+
+    uint32_t ignored_detections_count = 0;
+    size_t detections_count = 0;
+    auto dst_detections = reinterpret_cast<hailo_detection_t*>(buffer.data() + sizeof(uint16_t));
+    for (auto &detection : detections) {
+        if (REMOVED_CLASS_SCORE == detection.m_bbox.score) {
+            // Detection overlapped with a higher score detection and removed in remove_overlapping_boxes()
+            continue;
+        }
+        if ((0 == classes_detections_count[detection.m_class_id]) || (max_detections == detections_count)) {
+            ignored_detections_count++;
+            continue;
+        }
+
+        hailo_detection_t dst_detection{};
+        dst_detection.box = { detection.m_bbox.y_min, detection.m_bbox.x_min, detection.m_bbox.y_max, detection.m_bbox.x_max };
+        dst_detection.score = detection.m_bbox.score;
+        dst_detection.class_id = static_cast<uint16_t>(detection.m_class_id);
+        // The buffer is packed, so the detections might be unaligned
+        memcpy(&dst_detections[detections_count], &dst_detection, sizeof(dst_detection));
+        detections_count++;
+        classes_detections_count[detection.m_class_id]--;
+    }
+
+    const auto detections_count_casted = static_cast<uint16_t>(detections_count);
+    memcpy(buffer.data(), &detections_count_casted, sizeof(detections_count_casted));
+
+    if (0 != ignored_detections_count) {
+        LOGGER__INFO("{} Detections were ignored, due to `max_bboxes_per_class` defined as {}.",
+            ignored_detections_count, nms_config.max_proposals_per_class);
+    }
+}
+
 hailo_status NmsPostProcessOp::hailo_nms_format(MemoryView dst_view)
 {
     remove_overlapping_boxes(m_detections, m_classes_detections_count, m_nms_metadata->nms_config().nms_iou_th);
-    fill_nms_format_buffer(dst_view, m_detections, m_classes_detections_count, m_nms_metadata->nms_config());
+    if (HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE == m_nms_metadata->outputs_metadata().begin()->second.format.order) {
+        fill_nms_by_score_format_buffer(dst_view, m_detections, m_classes_detections_count, m_nms_metadata->nms_config());
+    } else {
+        fill_nms_format_buffer(dst_view, m_detections, m_classes_detections_count, m_nms_metadata->nms_config());
+    }
     return HAILO_SUCCESS;
 }
 
@@ -196,6 +196,18 @@ public:
     static void fill_nms_format_buffer(MemoryView &buffer, const std::vector<DetectionBbox> &detections,
         std::vector<uint32_t> &classes_detections_count, const NmsPostProcessConfig &nms_config);
 
+    /*
+    * The detections of all classes, sorted by score:
+    *       \code
+    *       struct (packed) {
+    *           uint16_t detections_count;
+    *           hailo_detection_t detections[detections_count];
+    *       };
+    *       \endcode
+    */
+    static void fill_nms_by_score_format_buffer(MemoryView &buffer, const std::vector<DetectionBbox> &detections,
+        std::vector<uint32_t> &classes_detections_count, const NmsPostProcessConfig &nms_config);
+
 protected:
     NmsPostProcessOp(std::shared_ptr<NmsOpMetadata> metadata)
         : Op(static_cast<PostProcessOpMetadataPtr>(metadata))
@@ -27,6 +27,7 @@ namespace net_flow
 
 #define SOFTMAX_NUM_OF_POSSIBLE_FORMAT_ORDERS (2) // NHWC, NC
 #define SOFTMAX_NUM_OF_POSSIBLE_FORMAT_TYPES (4) // Auto, UINT8, UINT16, FLOAT32
+#define SOFTMAX_NUM_OF_POSSIBLE_OUTPUT_FORMAT_TYPES (6) // Auto, UINT8, UINT16, FLOAT32, FLOAT16, BFLOAT16
 
 typedef hailo_status (*SoftmaxFunction)(const BufferMetaData &input_metadata, const BufferMetaData &output_metadata,
     const std::map<std::string, MemoryView> &inputs, std::map<std::string, MemoryView> &outputs);
@@ -43,19 +44,19 @@ private:
     static hailo_status NHWC_to_NHWC_feature_axis(const BufferMetaData &input_metadata, const BufferMetaData &output_metadata,
         const std::map<std::string, MemoryView> &inputs, std::map<std::string, MemoryView> &outputs)
     {
-        auto src_ptr = (dst_type*)inputs.begin()->second.data();
-        auto dst_ptr = (src_type*)outputs.begin()->second.data();
+        auto src_ptr = (src_type*)inputs.begin()->second.data();
+        auto dst_ptr = (dst_type*)outputs.begin()->second.data();
         const auto src_row_size = input_metadata.shape.width * input_metadata.shape.features;
         const auto dst_row_size = output_metadata.shape.width * output_metadata.shape.features;
         const auto src_width_size = input_metadata.shape.features;
         const auto dst_width_size = output_metadata.shape.features;
 
         for (uint32_t r = 0; r < input_metadata.shape.height; r++) { // H axis - rows
-            dst_type *src_row = src_ptr + (r * src_row_size);
-            src_type *dst_row = dst_ptr + (r * dst_row_size);
+            src_type *src_row = src_ptr + (r * src_row_size);
+            dst_type *dst_row = dst_ptr + (r * dst_row_size);
             for (uint32_t w = 0; w < input_metadata.shape.width; w++) { // W axis - coloums
-                dst_type *src_col = src_row + (w * src_width_size);
-                src_type *dst_col = dst_row + (w * dst_width_size);
+                src_type *src_col = src_row + (w * src_width_size);
+                dst_type *dst_col = dst_row + (w * dst_width_size);
                 softmax(src_col, dst_col, input_metadata.shape.features);
             }
         }
@@ -84,11 +85,21 @@ private:
         // A 3D array of softmax functions to call:
         // 1st dim represent the data format order (NHWC and NC are supported)
         // 2nd dim represent the input data type (only float_32 is supported)
-        // 3rd dim represent the output data type (only float_32 is supported)
-        static SoftmaxFunction m_softmax_function_array[SOFTMAX_NUM_OF_POSSIBLE_FORMAT_ORDERS][SOFTMAX_NUM_OF_POSSIBLE_FORMAT_TYPES][SOFTMAX_NUM_OF_POSSIBLE_FORMAT_TYPES];
+        // 3rd dim represent the output data type (float_32, float_16 and bfloat_16 are supported)
+        static SoftmaxFunction m_softmax_function_array[SOFTMAX_NUM_OF_POSSIBLE_FORMAT_ORDERS][SOFTMAX_NUM_OF_POSSIBLE_FORMAT_TYPES][SOFTMAX_NUM_OF_POSSIBLE_OUTPUT_FORMAT_TYPES];
 
         static hailo_status softmax(float32_t *src, float32_t *dst, size_t num_of_elements);
 
+        // Softmax is calculated in float32 (in place on the src) and converted to the half precision dst
+        template<typename dst_type>
+        static hailo_status softmax(float32_t *src, dst_type *dst, size_t num_of_elements)
+        {
+            auto status = softmax(src, src, num_of_elements);
+            CHECK_SUCCESS(status);
+            Quantization::convert_float32_buffer(src, dst, static_cast<uint32_t>(num_of_elements));
+            return HAILO_SUCCESS;
+        }
+
 };
 
 } /* namespace net_flow */
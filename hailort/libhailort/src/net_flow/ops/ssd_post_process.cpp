@@ -11,6 +11,12 @@
 
 #include "net_flow/ops/ssd_post_process.hpp"
 
+#include <cmath>
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 namespace hailort
 {
 namespace net_flow
@@ -178,9 +184,32 @@ hailo_status SSDPostProcessOp::extract_detections(const std::string &reg_input_n
 
     auto reg_row_size = reg_padded_shape.width * reg_padded_shape.features;
     auto cls_row_size = cls_padded_shape.width * cls_padded_shape.features;
+
+    // Most anchors have no class passing the score threshold. Finding them over the quantized class scores saves
+    // decoding (and de-quantizing) them.
+    const auto &cls_metadata = inputs_metadata.at(cls_input_name);
+    uint32_t quantized_threshold = 0;
+    const bool should_filter_anchors = get_quantized_score_threshold(cls_metadata, quantized_threshold);
+    if (should_filter_anchors) {
+        m_candidate_anchors.resize(reg_shape.width * num_of_anchors);
+    }
+
     for (uint32_t row = 0; row < reg_shape.height; row++) {
+        if (should_filter_anchors) {
+            if (HAILO_FORMAT_TYPE_UINT8 == cls_metadata.format.type) {
+                mark_candidate_anchors<uint8_t>(cls_buffer.data() + (cls_row_size * row), cls_metadata, reg_shape.width,
+                    num_of_anchors, quantized_threshold, m_candidate_anchors);
+            } else {
+                mark_candidate_anchors<uint16_t>(reinterpret_cast<const uint16_t*>(cls_buffer.data()) + (cls_row_size * row),
+                    cls_metadata, reg_shape.width, num_of_anchors, quantized_threshold, m_candidate_anchors);
+            }
+        }
+
         for (uint32_t col = 0; col < reg_shape.width; col++) {
             for (uint32_t anchor = 0; anchor < num_of_anchors; anchor++) {
+                if (should_filter_anchors && !m_candidate_anchors[(col * num_of_anchors) + anchor]) {
+                    continue;
+                }
                 auto reg_idx = (reg_row_size * row) + col + ((anchor * reg_entry_size) * reg_padded_shape.width);
                 auto cls_idx = (cls_row_size * row) + col + ((anchor * cls_entry_size) * cls_padded_shape.width);
                 const auto &wa = layer_anchors[anchor * 2];
@@ -234,5 +263,95 @@ hailo_status SSDPostProcessOp::extract_detections(const std::string &reg_input_n
     return HAILO_SUCCESS;
 }
 
+bool SSDPostProcessOp::get_quantized_score_threshold(const BufferMetaData &cls_metadata, uint32_t &quantized_threshold)
+{
+    if ((HAILO_FORMAT_TYPE_UINT8 != cls_metadata.format.type) && (HAILO_FORMAT_TYPE_UINT16 != cls_metadata.format.type)) {
+        return false;
+    }
+
+    const auto &nms_config = m_metadata->nms_config();
+    auto score_threshold = nms_config.nms_score_th;
+    if (nms_config.cross_classes && should_sigmoid()) {
+        // The sigmoid is monotonic, so the threshold is moved to the scores before it
+        if ((score_threshold <= 0.0f) || (score_threshold >= 1.0f)) {
+            return false;
+        }
+        score_threshold = std::log(score_threshold / (1.0f - score_threshold));
+    }
+
+    const auto &quant_info = cls_metadata.quant_info;
+    if (quant_info.qp_scale <= 0.0f) {
+        return false;
+    }
+
+    // One quantization step lower than the exact threshold, so float rounding never filters out a passing score
+    // (the exact threshold is checked on the remaining anchors anyway)
+    const auto threshold = static_cast<float32_t>(std::floor((score_threshold / quant_info.qp_scale) + quant_info.qp_zp)) - 1.0f;
+    const auto max_threshold = static_cast<float32_t>(std::numeric_limits<uint16_t>::max()) + 1.0f;
+    quantized_threshold = (threshold <= 0.0f) ? 0 : static_cast<uint32_t>(std::min(threshold, max_threshold));
+    return true;
+}
+
+template<typename SrcType>
+static inline void update_columns_max(const SrcType *scores, SrcType *columns_max, uint32_t width)
+{
+    for (uint32_t col = 0; col < width; col++) {
+        columns_max[col] = std::max(columns_max[col], scores[col]);
+    }
+}
+
+#if defined(__aarch64__)
+template<>
+inline void update_columns_max<uint8_t>(const uint8_t *scores, uint8_t *columns_max, uint32_t width)
+{
+    uint32_t col = 0;
+    for (; (col + 16) <= width; col += 16) {
+        vst1q_u8(columns_max + col, vmaxq_u8(vld1q_u8(columns_max + col), vld1q_u8(scores + col)));
+    }
+    for (; col < width; col++) {
+        columns_max[col] = std::max(columns_max[col], scores[col]);
+    }
+}
+
+template<>
+inline void update_columns_max<uint16_t>(const uint16_t *scores, uint16_t *columns_max, uint32_t width)
+{
+    uint32_t col = 0;
+    for (; (col + 8) <= width; col += 8) {
+        vst1q_u16(columns_max + col, vmaxq_u16(vld1q_u16(columns_max + col), vld1q_u16(scores + col)));
+    }
+    for (; col < width; col++) {
+        columns_max[col] = std::max(columns_max[col], scores[col]);
+    }
+}
+#endif /* defined(__aarch64__) */
+
+template<typename SrcType>
+void SSDPostProcessOp::mark_candidate_anchors(const SrcType *cls_row, const BufferMetaData &cls_metadata, uint32_t width,
+    size_t num_of_anchors, uint32_t quantized_threshold, std::vector<uint8_t> &candidates)
+{
+    const auto &nms_config = m_metadata->nms_config();
+    const auto padded_width = cls_metadata.padded_shape.width;
+
+    m_columns_max_score.resize(width * sizeof(SrcType));
+    auto columns_max = reinterpret_cast<SrcType*>(m_columns_max_score.data());
+
+    // Within a row, the scores of each (anchor, class) pair are contiguous over the columns
+    for (uint32_t anchor = 0; anchor < num_of_anchors; anchor++) {
+        std::fill(columns_max, columns_max + width, static_cast<SrcType>(0));
+        const auto anchor_scores = cls_row + ((anchor * nms_config.number_of_classes) * padded_width);
+        for (uint32_t class_index = 0; class_index < nms_config.number_of_classes; class_index++) {
+            if (nms_config.background_removal && (nms_config.background_removal_index == class_index)) {
+                continue;
+            }
+            update_columns_max<SrcType>(anchor_scores + (class_index * padded_width), columns_max, width);
+        }
+
+        for (uint32_t col = 0; col < width; col++) {
+            candidates[(col * num_of_anchors) + anchor] = (columns_max[col] >= quantized_threshold) ? 1 : 0;
+        }
+    }
+}
+
 }
 }
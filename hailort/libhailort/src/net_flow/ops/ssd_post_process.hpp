@@ -153,6 +153,24 @@ private:
     */
     hailo_status extract_detections(const std::string &reg_input_name, const std::string &cls_input_name,
         const MemoryView &reg_buffer, const MemoryView &cls_buffer);
+
+    /**
+     * Calculates the lowest quantized class score that may pass the score threshold, so anchors can be filtered
+     * before being decoded. Returns false if the classes can't be filtered in their quantized form.
+     */
+    bool get_quantized_score_threshold(const BufferMetaData &cls_metadata, uint32_t &quantized_threshold);
+
+    /**
+     * Marks in @a candidates (indexed by column and anchor, of a single row) the anchors having at least one
+     * class score not lower than @a quantized_threshold. The class scores are compared in their quantized form.
+     */
+    template<typename SrcType>
+    void mark_candidate_anchors(const SrcType *cls_row, const BufferMetaData &cls_metadata, uint32_t width,
+        size_t num_of_anchors, uint32_t quantized_threshold, std::vector<uint8_t> &candidates);
+
+    std::vector<uint8_t> m_candidate_anchors;
+    // Scratch row of the maximal class score per column (of the cls input's data type)
+    std::vector<uint8_t> m_columns_max_score;
 };
 
 }
@@ -113,6 +113,25 @@ const std::vector<std::shared_ptr<PipelineElement>>& AsyncPipeline::get_pipeline
     return m_pipeline_elements;
 }
 
+std::string AsyncPipeline::get_graph_description() const
+{
+    std::stringstream graph_str;
+    graph_str << "digraph async_pipeline {\n";
+    graph_str << "    node [shape=box];\n";
+    for (const auto &element : m_pipeline_elements) {
+        graph_str << "    \"" << element->name() << "\" [label=\"" << element->description() << "\"];\n";
+    }
+    for (const auto &element : m_pipeline_elements) {
+        for (const auto &source : element->sources()) {
+            if (nullptr != source.next()) {
+                graph_str << "    \"" << element->name() << "\" -> \"" << source.next()->element().name() << "\";\n";
+            }
+        }
+    }
+    graph_str << "}\n";
+    return graph_str.str();
+}
+
 const std::unordered_map<std::string, std::shared_ptr<PipelineElement>>& AsyncPipeline::get_entry_elements() const
 {
     return m_entry_elements;
@@ -148,15 +167,26 @@ bool AsyncPipeline::is_multi_planar()
     return m_is_multi_planar;
 }
 
+void AsyncPipeline::add_planes_transform_input(const std::string &input_name)
+{
+    m_planes_transform_inputs.insert(input_name);
+}
+
+bool AsyncPipeline::is_planes_transform_input(const std::string &input_name) const
+{
+    return contains(m_planes_transform_inputs, input_name);
+}
+
 Expected<std::shared_ptr<AsyncInferRunnerImpl>> AsyncInferRunnerImpl::create(std::shared_ptr<ConfiguredNetworkGroup> net_group,
     const std::unordered_map<std::string, hailo_format_t> &inputs_formats, const std::unordered_map<std::string, hailo_format_t> &outputs_formats,
-    const uint32_t timeout)
+    const std::unordered_map<std::string, hailo_preprocess_params_t> &inputs_preprocess_params, const uint32_t timeout)
 {
     auto pipeline_status = make_shared_nothrow<std::atomic<hailo_status>>(HAILO_SUCCESS);
     CHECK_AS_EXPECTED(nullptr != pipeline_status, HAILO_OUT_OF_HOST_MEMORY);
 
     TRY(auto async_pipeline,
-        AsyncPipelineBuilder::create_pipeline(net_group, inputs_formats, outputs_formats, timeout, pipeline_status));
+        AsyncPipelineBuilder::create_pipeline(net_group, inputs_formats, outputs_formats, inputs_preprocess_params, timeout,
+            pipeline_status));
 
     auto async_infer_runner_ptr = make_shared_nothrow<AsyncInferRunnerImpl>(std::move(async_pipeline), pipeline_status);
     CHECK_NOT_NULL_AS_EXPECTED(async_infer_runner_ptr, HAILO_OUT_OF_HOST_MEMORY);
@@ -272,6 +302,10 @@ void AsyncInferRunnerImpl::set_pix_buffer_inputs(std::unordered_map<std::string,
     } else if (m_async_pipeline->is_multi_planar()) {
         // If model is multi-planar
         inputs[input_name] = PipelineBuffer(pix_buffer, input_done);
+    } else if (m_async_pipeline->is_planes_transform_input(input_name) &&
+        (HAILO_PIX_BUFFER_MEMORY_TYPE_USERPTR == pix_buffer.memory_type)) {
+        // The input transformation repacks the planes into the hw frame, reading each one from its own buffer
+        inputs[input_name] = PipelineBuffer(pix_buffer, input_done);
     } else {
         // Other cases - return error, as on async flow we do not support copy to new buffer
         LOGGER__ERROR("HEF was compiled for single input layer, while trying to pass non-contiguous planes buffers.");
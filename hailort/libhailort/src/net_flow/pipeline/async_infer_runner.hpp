@@ -17,6 +17,8 @@
 #include "net_flow/pipeline/vstream_internal.hpp"
 #include "net_flow/ops/op.hpp"
 
+#include <unordered_set>
+
 namespace hailort
 {
 
@@ -36,6 +38,8 @@ public:
     void shutdown(hailo_status error_status);
 
     const std::vector<std::shared_ptr<PipelineElement>>& get_pipeline() const;
+    // The elements and the links between them, in DOT format
+    std::string get_graph_description() const;
     const std::unordered_map<std::string, std::shared_ptr<PipelineElement>>& get_entry_elements() const;
     const std::unordered_map<std::string, std::shared_ptr<PipelineElement>>& get_last_elements() const;
     const std::shared_ptr<AsyncHwElement> get_async_hw_element();
@@ -44,6 +48,9 @@ public:
 
     void set_as_multi_planar();
     bool is_multi_planar();
+    // Inputs whose transformation reads the planes of a pix buffer as they are (without concatenating them)
+    void add_planes_transform_input(const std::string &input_name);
+    bool is_planes_transform_input(const std::string &input_name) const;
 
 private:
     std::shared_ptr<AsyncHwElement> m_async_hw_element;
@@ -52,6 +59,7 @@ private:
     std::unordered_map<std::string, std::shared_ptr<PipelineElement>> m_last_elements;
     ElementBuildParams m_build_params;
     bool m_is_multi_planar;
+    std::unordered_set<std::string> m_planes_transform_inputs;
 };
 
 class AsyncInferRunnerImpl
@@ -59,7 +67,7 @@ class AsyncInferRunnerImpl
 public:
     static Expected<std::shared_ptr<AsyncInferRunnerImpl>> create(std::shared_ptr<ConfiguredNetworkGroup> net_group,
         const std::unordered_map<std::string, hailo_format_t> &inputs_formats, const std::unordered_map<std::string, hailo_format_t> &outputs_formats,
-        const uint32_t timeout = HAILO_DEFAULT_ASYNC_INFER_TIMEOUT_MS);
+        const std::unordered_map<std::string, hailo_preprocess_params_t> &inputs_preprocess_params, const uint32_t timeout = HAILO_DEFAULT_ASYNC_INFER_TIMEOUT_MS);
     AsyncInferRunnerImpl(AsyncInferRunnerImpl &&) = delete;
     AsyncInferRunnerImpl(const AsyncInferRunnerImpl &) = delete;
     AsyncInferRunnerImpl &operator=(AsyncInferRunnerImpl &&) = delete;
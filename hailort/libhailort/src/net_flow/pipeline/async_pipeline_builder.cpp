@@ -18,7 +18,9 @@
 #include "net_flow/ops/yolox_post_process.hpp"
 #include "net_flow/ops/ssd_post_process.hpp"
 #include "net_flow/pipeline/vstream_builder.hpp"
+#include "common/utils.hpp"
 #include <algorithm>
+#include <fstream>
 
 namespace hailort
 {
@@ -71,11 +73,14 @@ Expected<std::unordered_map<std::string, hailo_format_t>> AsyncPipelineBuilder::
 
 hailo_status AsyncPipelineBuilder::create_pre_async_hw_elements_per_input(std::shared_ptr<ConfiguredNetworkGroup> net_group,
     const std::vector<std::string> &stream_names, const std::unordered_map<std::string, hailo_format_t> &inputs_formats,
+    const std::unordered_map<std::string, hailo_preprocess_params_t> &inputs_preprocess_params,
     const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos, std::shared_ptr<AsyncPipeline> async_pipeline)
 {
     TRY(const auto vstream_names, net_group->get_vstream_names_from_stream_name(*stream_names.begin()));
     CHECK(vstream_names.size() == 1, HAILO_NOT_SUPPORTED, "low level stream must have exactly 1 user input");
     const auto &vstream_name = vstream_names[0];
+    const auto is_preprocess = contains(inputs_preprocess_params, vstream_name) &&
+        PreProcessContext::is_enabled(inputs_preprocess_params.at(vstream_name));
     std::shared_ptr<PixBufferElement> multi_plane_splitter = nullptr;
     std::shared_ptr<PipelineElement> last_element_connected_to_pipeline = nullptr;
 
@@ -90,6 +95,7 @@ hailo_status AsyncPipelineBuilder::create_pre_async_hw_elements_per_input(std::s
 
     bool is_multi_planar = (stream_names.size() > 1);
     if (is_multi_planar) {
+        CHECK(!is_preprocess, HAILO_NOT_SUPPORTED, "Host pre-processing is not supported for multi-planar input {}", vstream_name);
         async_pipeline->set_as_multi_planar();
         const auto &vstream_order = inputs_formats.at(vstream_name).order;
 
@@ -105,7 +111,9 @@ hailo_status AsyncPipelineBuilder::create_pre_async_hw_elements_per_input(std::s
         CHECK(contains(named_stream_infos, stream_name), HAILO_INTERNAL_FAILURE);
         const auto &input_stream_info = named_stream_infos.at(stream_name);
 
-        auto src_format = inputs_formats.at(vstream_name);
+        // When pre-processing, the input transformation is applied on the pre-processed frame rather than on the user's frame
+        auto src_format = is_preprocess ? PreProcessContext::get_dst_format(inputs_preprocess_params.at(vstream_name)) :
+            inputs_formats.at(vstream_name);
         TRY(const auto sink_index, async_pipeline->get_async_hw_element()->get_sink_index_from_input_stream_name(stream_name));
 
         if(is_multi_planar) {
@@ -127,7 +135,43 @@ hailo_status AsyncPipelineBuilder::create_pre_async_hw_elements_per_input(std::s
             src_format, input_stream_info.hw_shape, input_stream_info.format,
             std::vector<hailo_quant_info_t>(1, input_stream_info.quant_info))); // Inputs always have single quant_info
 
+        if (is_preprocess && should_transform && is_fusion_enabled()) {
+            // The input transformation is fused into the pre-process element, which writes the hw frame directly
+            TRY(auto pre_process_elem, PreProcessElement::create(inputs_preprocess_params.at(vstream_name), input_stream_info,
+                PipelineObject::create_element_name("PreProcessTransformEl", stream_name, input_stream_info.index),
+                async_pipeline->get_build_params(), PipelineDirection::PUSH, async_pipeline));
+            async_pipeline->add_element_to_pipeline(pre_process_elem);
+            CHECK_SUCCESS(PipelinePad::link_pads(last_element_connected_to_pipeline, pre_process_elem));
+
+            is_empty = false;
+            interacts_with_hw = true;
+            TRY(auto queue_elem, add_push_queue_element(PipelineObject::create_element_name("PushQEl", stream_name, input_stream_info.index),
+                async_pipeline, input_stream_info.hw_frame_size, is_empty, interacts_with_hw, pre_process_elem));
+            CHECK_SUCCESS(PipelinePad::link_pads(queue_elem, async_pipeline->get_async_hw_element(), 0, sink_index));
+            continue;
+        }
+
+        if (is_preprocess) {
+            TRY(auto pre_process_elem, PreProcessElement::create(inputs_preprocess_params.at(vstream_name), input_stream_info.shape,
+                PipelineObject::create_element_name("PreProcessEl", stream_name, input_stream_info.index),
+                async_pipeline->get_build_params(), PipelineDirection::PUSH, async_pipeline));
+            async_pipeline->add_element_to_pipeline(pre_process_elem);
+            CHECK_SUCCESS(PipelinePad::link_pads(last_element_connected_to_pipeline, pre_process_elem));
+
+            // Without a transformation, the pre-processed frame is written directly to the device
+            is_empty = false;
+            interacts_with_hw = !should_transform;
+            const auto pre_processed_frame_size = should_transform ?
+                HailoRTCommon::get_frame_size(input_stream_info.shape, src_format) : input_stream_info.hw_frame_size;
+            TRY(auto queue_elem, add_push_queue_element(PipelineObject::create_element_name("PushQEl_preprocess", stream_name,
+                input_stream_info.index), async_pipeline, pre_processed_frame_size, is_empty, interacts_with_hw, pre_process_elem));
+            last_element_connected_to_pipeline = queue_elem;
+        }
+
         if (should_transform) {
+            if (!is_preprocess && !is_multi_planar) {
+                async_pipeline->add_planes_transform_input(vstream_name);
+            }
             TRY(auto pre_infer_elem, PreInferElement::create(input_stream_info.shape, src_format,
                 input_stream_info.hw_shape, input_stream_info.format, { input_stream_info.quant_info },
                 PipelineObject::create_element_name("PreInferEl", stream_name, input_stream_info.index),
@@ -150,15 +194,15 @@ hailo_status AsyncPipelineBuilder::create_pre_async_hw_elements_per_input(std::s
 }
 
 hailo_status AsyncPipelineBuilder::create_pre_async_hw_elements(std::shared_ptr<ConfiguredNetworkGroup> net_group,
-    const std::unordered_map<std::string, hailo_format_t> &inputs_formats, const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos,
-    std::shared_ptr<AsyncPipeline> async_pipeline)
+    const std::unordered_map<std::string, hailo_format_t> &inputs_formats, const std::unordered_map<std::string, hailo_preprocess_params_t> &inputs_preprocess_params,
+    const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos, std::shared_ptr<AsyncPipeline> async_pipeline)
 {
     for(const auto &input : inputs_formats) {
         TRY(const auto stream_names_under_vstream,
             net_group->get_stream_names_from_vstream_name(input.first));
 
         auto status = create_pre_async_hw_elements_per_input(net_group, stream_names_under_vstream, inputs_formats,
-            named_stream_infos, async_pipeline);
+            inputs_preprocess_params, named_stream_infos, async_pipeline);
         CHECK_SUCCESS(status);
     }
     return HAILO_SUCCESS;
@@ -255,6 +299,23 @@ Expected<std::shared_ptr<FillNmsFormatElement>> AsyncPipelineBuilder::add_fill_n
     return fill_nms_format_element;
 }
 
+Expected<std::shared_ptr<IouPostProcessElement>> AsyncPipelineBuilder::add_iou_post_process_element(std::shared_ptr<AsyncPipeline> async_pipeline,
+    const std::string &output_stream_name, uint8_t stream_index, const std::string &element_name, const net_flow::PostProcessOpMetadataPtr &op_metadata,
+    std::shared_ptr<PipelineElement> final_elem, const uint32_t final_elem_index)
+{
+    auto metadata = std::dynamic_pointer_cast<net_flow::NmsOpMetadata>(op_metadata);
+    assert(nullptr != metadata);
+
+    TRY(auto iou_post_process_element, IouPostProcessElement::create(metadata->nms_info(), metadata->nms_config(),
+        PipelineObject::create_element_name(element_name, output_stream_name, stream_index),
+        async_pipeline->get_build_params(), PipelineDirection::PUSH, async_pipeline));
+
+    async_pipeline->add_element_to_pipeline(iou_post_process_element);
+
+    CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(final_elem, iou_post_process_element, final_elem_index, 0));
+    return iou_post_process_element;
+}
+
 Expected<std::shared_ptr<LastAsyncElement>> AsyncPipelineBuilder::add_last_async_element(std::shared_ptr<AsyncPipeline> async_pipeline,
     const std::string &output_format_name, size_t frame_size, std::shared_ptr<PipelineElement> final_elem, const uint32_t final_elem_source_index)
 {
@@ -426,19 +487,24 @@ hailo_status AsyncPipelineBuilder::add_softmax_flow(std::shared_ptr<AsyncPipelin
     // TODO (HRT-11078): Fix multi qp for PP
     auto stream_quant_infos = std::vector<hailo_quant_info_t>(1, stream_info.quant_info);
 
-    TRY(auto post_infer_elem, add_post_infer_element(output_format_expanded, {}, async_pipeline, stream_info.hw_shape, stream_info.format,
+    // Softmax is calculated in float32, so half precision user formats are converted by the softmax op itself
+    auto softmax_input_format = output_format_expanded;
+    softmax_input_format.type = HAILO_FORMAT_TYPE_FLOAT32;
+
+    TRY(auto post_infer_elem, add_post_infer_element(softmax_input_format, {}, async_pipeline, stream_info.hw_shape, stream_info.format,
         stream_info.shape, stream_quant_infos, async_pipeline->get_async_hw_element(), hw_async_elem_index));
 
     auto is_empty = false;
     auto interacts_with_hw = false;
+    const auto pre_softmax_frame_size = HailoRTCommon::get_frame_size(stream_info.shape, softmax_input_format);
     const auto post_transform_frame_size = HailoRTCommon::get_frame_size(stream_info.shape, output_format_expanded);
     TRY(auto queue_elem, add_push_queue_element(PipelineObject::create_element_name("PushQEl_softmax", async_pipeline->get_async_hw_element()->name(),
-        static_cast<uint8_t>(hw_async_elem_index)), async_pipeline, post_transform_frame_size, is_empty, interacts_with_hw, post_infer_elem));
+        static_cast<uint8_t>(hw_async_elem_index)), async_pipeline, pre_softmax_frame_size, is_empty, interacts_with_hw, post_infer_elem));
 
     // Updating metadata according to user request
     // Currently softmax only supports inputs to be float32 and order NHWC or NC
     auto updated_inputs_metadata = softmax_op_metadata.get()->inputs_metadata();
-    updated_inputs_metadata.begin()->second.format = output_format_expanded;
+    updated_inputs_metadata.begin()->second.format = softmax_input_format;
     auto updated_outputs_metadata = softmax_op_metadata.get()->outputs_metadata();
     updated_outputs_metadata.begin()->second.format = output_format_expanded;
     auto metadata = std::dynamic_pointer_cast<net_flow::SoftmaxOpMetadata>(softmax_op_metadata);
@@ -520,7 +586,7 @@ hailo_status AsyncPipelineBuilder::add_nms_flow(std::shared_ptr<AsyncPipeline> a
         "NMS output format type must be HAILO_FORMAT_TYPE_FLOAT32");
     if(!nms_op_metadata->nms_config().bbox_only){
         CHECK(HailoRTCommon::is_nms(output_format.second.order), HAILO_INVALID_ARGUMENT,
-            "NMS output format order must be HAILO_FORMAT_ORDER_HAILO_NMS or HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK");
+            "NMS output format order must be HAILO_FORMAT_ORDER_HAILO_NMS, HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK or HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE");
     }
 
     std::unordered_map<std::string, net_flow::BufferMetaData> inputs_metadata;
@@ -621,6 +687,22 @@ hailo_status AsyncPipelineBuilder::add_iou_flow( std::shared_ptr<AsyncPipeline>
         add_push_queue_element(PipelineObject::create_element_name("PushQEl_pre_nms_convert", output_stream_name,
             output_stream_info.index), async_pipeline, post_transform_frame_size, is_empty, interacts_with_hw, post_infer_element));
 
+    TRY(const auto output_vstream_info, iou_op_metadata->get_output_vstream_info());
+    const auto final_frame_size = HailoRTCommon::get_frame_size(output_vstream_info, output_format.second);
+
+    if (is_fusion_enabled()) {
+        // The detections are passed between the IoU stages without any parallelism to gain from queues in between,
+        // so all of them run in a single element
+        TRY(auto iou_post_process_element,
+            add_iou_post_process_element(async_pipeline, output_stream_name, output_stream_info.index,
+                "IouPostProcessEl", iou_op_metadata, pre_nms_convert_queue_element));
+
+        TRY(auto last_async_element,
+            add_last_async_element(async_pipeline, output_format.first, final_frame_size, iou_post_process_element));
+
+        return HAILO_SUCCESS;
+    }
+
     TRY(auto nms_to_detections_element,
         add_nms_to_detections_convert_element(async_pipeline, output_stream_name, output_stream_info.index,
             "NmsFormatToDetectionsEl", iou_op_metadata, pre_nms_convert_queue_element));
@@ -641,9 +723,6 @@ hailo_status AsyncPipelineBuilder::add_iou_flow( std::shared_ptr<AsyncPipeline>
         add_fill_nms_format_element(async_pipeline, output_stream_name, output_stream_info.index,
             "FillNmsFormatEl", iou_op_metadata, pre_fill_nms_format_element_queue_element));
 
-    TRY(const auto output_vstream_info, iou_op_metadata->get_output_vstream_info());
-    const auto final_frame_size = HailoRTCommon::get_frame_size(output_vstream_info, output_format.second);
-
     TRY(auto last_async_element,
         add_last_async_element(async_pipeline, output_format.first, final_frame_size, fill_nms_format_element));
 
@@ -846,7 +925,8 @@ hailo_status AsyncPipelineBuilder::create_post_async_hw_elements(std::shared_ptr
 Expected<std::shared_ptr<AsyncPipeline>> AsyncPipelineBuilder::create_pipeline(std::shared_ptr<ConfiguredNetworkGroup> net_group,
     const std::unordered_map<std::string, hailo_format_t> &inputs_formats,
     const std::unordered_map<std::string, hailo_format_t> &outputs_formats,
-    const uint32_t timeout, std::shared_ptr<std::atomic<hailo_status>> pipeline_status)
+    const std::unordered_map<std::string, hailo_preprocess_params_t> &inputs_preprocess_params, const uint32_t timeout,
+    std::shared_ptr<std::atomic<hailo_status>> pipeline_status)
 {
     std::unordered_map<std::string, std::shared_ptr<PipelineElement>> entry_elements;
     std::unordered_map<std::string, std::shared_ptr<PipelineElement>> last_elements;
@@ -886,8 +966,8 @@ Expected<std::shared_ptr<AsyncPipeline>> AsyncPipelineBuilder::create_pipeline(s
     async_pipeline->add_element_to_pipeline(async_hw_elem);
     async_pipeline->set_async_hw_element(async_hw_elem);
 
-    hailo_status status = create_pre_async_hw_elements(net_group, input_expanded_format, named_stream_infos,
-        async_pipeline);
+    hailo_status status = create_pre_async_hw_elements(net_group, input_expanded_format, inputs_preprocess_params,
+        named_stream_infos, async_pipeline);
     CHECK_SUCCESS_AS_EXPECTED(status);
 
     status = create_post_async_hw_elements(net_group, output_expanded_format, outputs_original_formats, named_stream_infos,
@@ -895,10 +975,33 @@ Expected<std::shared_ptr<AsyncPipeline>> AsyncPipelineBuilder::create_pipeline(s
     CHECK_SUCCESS_AS_EXPECTED(status);
 
     print_pipeline_elements_info(async_pipeline);
+    dump_pipeline_graph(async_pipeline);
 
     return async_pipeline;
 }
 
+bool AsyncPipelineBuilder::is_fusion_enabled()
+{
+    return !is_env_variable_on(DISABLE_PIPELINE_FUSION_ENV_VAR);
+}
+
+void AsyncPipelineBuilder::dump_pipeline_graph(std::shared_ptr<AsyncPipeline> async_pipeline)
+{
+    auto dump_path = get_env_variable(PIPELINE_GRAPH_DUMP_ENV_VAR);
+    if (!dump_path) {
+        return;
+    }
+
+    // Failing to dump the graph is not a reason to fail the pipeline's creation
+    std::ofstream dump_file(dump_path.value());
+    if (!dump_file.is_open()) {
+        LOGGER__WARNING("Failed opening {} for dumping the pipeline graph", dump_path.value());
+        return;
+    }
+    dump_file << async_pipeline->get_graph_description();
+    LOGGER__INFO("Pipeline graph was written to {}", dump_path.value());
+}
+
 void AsyncPipelineBuilder::print_pipeline_elements_info(std::shared_ptr<hailort::AsyncPipeline> async_pipeline)
 {
     auto async_entry_elements = async_pipeline->get_entry_elements();
@@ -19,6 +19,10 @@
 namespace hailort
 {
 
+// Builds the pipelines without fusing adjacent elements (for debugging the fused elements)
+#define DISABLE_PIPELINE_FUSION_ENV_VAR ("HAILO_DISABLE_PIPELINE_FUSION")
+// Path of a file to which the built pipeline graph is written (in DOT format)
+#define PIPELINE_GRAPH_DUMP_ENV_VAR ("HAILO_PIPELINE_GRAPH_DUMP")
 
 class AsyncPipelineBuilder final
 {
@@ -27,7 +31,8 @@ public:
 
     static Expected<std::shared_ptr<AsyncPipeline>> create_pipeline(std::shared_ptr<ConfiguredNetworkGroup> net_group,
         const std::unordered_map<std::string, hailo_format_t> &inputs_formats,
-        const std::unordered_map<std::string, hailo_format_t> &outputs_formats, const uint32_t timeout,
+        const std::unordered_map<std::string, hailo_format_t> &outputs_formats,
+        const std::unordered_map<std::string, hailo_preprocess_params_t> &inputs_preprocess_params, const uint32_t timeout,
         std::shared_ptr<std::atomic<hailo_status>> pipeline_status);
 
     static Expected<std::unordered_map<std::string, hailo_format_t>> expand_auto_input_formats(std::shared_ptr<ConfiguredNetworkGroup> net_group,
@@ -38,10 +43,11 @@ public:
         const std::unordered_map<std::string, hailo_format_t> &outputs_formats);
 
     static hailo_status create_pre_async_hw_elements(std::shared_ptr<ConfiguredNetworkGroup> net_group,
-        const std::unordered_map<std::string, hailo_format_t> &inputs_formats, const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos,
-        std::shared_ptr<AsyncPipeline> async_pipeline);
+        const std::unordered_map<std::string, hailo_format_t> &inputs_formats, const std::unordered_map<std::string, hailo_preprocess_params_t> &inputs_preprocess_params,
+        const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos, std::shared_ptr<AsyncPipeline> async_pipeline);
     static hailo_status create_pre_async_hw_elements_per_input(std::shared_ptr<ConfiguredNetworkGroup> net_group,
         const std::vector<std::string> &stream_names, const std::unordered_map<std::string, hailo_format_t> &inputs_formats,
+        const std::unordered_map<std::string, hailo_preprocess_params_t> &inputs_preprocess_params,
         const std::unordered_map<std::string, hailo_stream_info_t> &named_stream_infos, std::shared_ptr<AsyncPipeline> async_pipeline);
     static hailo_status create_post_async_hw_elements(std::shared_ptr<ConfiguredNetworkGroup> net_group,
         const std::unordered_map<std::string, hailo_format_t> &expanded_outputs_formats, std::unordered_map<std::string, hailo_format_t> &original_outputs_formats,
@@ -90,6 +96,9 @@ public:
     static Expected<std::shared_ptr<FillNmsFormatElement>> add_fill_nms_format_element(std::shared_ptr<AsyncPipeline> async_pipeline,
         const std::string &output_stream_name, uint8_t stream_index, const std::string &element_name, const net_flow::PostProcessOpMetadataPtr &op_metadata,
         std::shared_ptr<PipelineElement> final_elem, const uint32_t final_elem_source_index = 0);
+    static Expected<std::shared_ptr<IouPostProcessElement>> add_iou_post_process_element(std::shared_ptr<AsyncPipeline> async_pipeline,
+        const std::string &output_stream_name, uint8_t stream_index, const std::string &element_name, const net_flow::PostProcessOpMetadataPtr &op_metadata,
+        std::shared_ptr<PipelineElement> final_elem, const uint32_t final_elem_source_index = 0);
     static Expected<std::shared_ptr<PixBufferElement>> create_multi_plane_splitter_element(const std::string &input_name,
         hailo_format_order_t order, std::shared_ptr<std::atomic<hailo_status>> pipeline_status, std::shared_ptr<AsyncPipeline> async_pipeline);
 
@@ -97,6 +106,8 @@ public:
         const hailo_format_t &output_format);
 
     static void print_pipeline_elements_info(std::shared_ptr<hailort::AsyncPipeline> async_pipeline);
+    static bool is_fusion_enabled();
+    static void dump_pipeline_graph(std::shared_ptr<AsyncPipeline> async_pipeline);
 };
 
 } /* namespace hailort */
@@ -9,110 +9,81 @@
 
 #include "configured_infer_model_hrpc_client.hpp"
 #include "hailo/hailort.h"
+#include "common/os_utils.hpp"
 #include <iostream>
 
 namespace hailort
 {
 
-Expected<MemoryView> InferStreamOnStack::get_buffer()
+AsyncInferJobHrpcClient::AsyncInferJobHrpcClient(EventPtr event) : m_event(event)
 {
-    return MemoryView(m_buffer);
 }
 
-Expected<OutputBindingsOnStack> OutputBindingsOnStack::create(ConfiguredInferModel::Bindings bindings,
-    const std::vector<std::string> &outputs_names)
+hailo_status AsyncInferJobHrpcClient::wait(std::chrono::milliseconds timeout)
 {
-    std::unordered_map<std::string, InferStreamOnStack> output_streams;
-    for (const auto &output_name : outputs_names) {
-        TRY(auto output, bindings.output(output_name));
-        TRY(auto buffer, output.get_buffer());
-        output_streams.emplace(output_name, InferStreamOnStack(buffer));
-    }
-    return OutputBindingsOnStack(std::move(output_streams));
+    return m_event->wait(timeout);
 }
 
-Expected<InferStreamOnStack> OutputBindingsOnStack::output()
+Expected<std::unique_ptr<CallbacksQueue>> CallbacksQueue::create(std::shared_ptr<hrpc::ClientConnection> connection,
+    rpc_object_handle_t configured_infer_model_handle, const std::vector<std::string> &outputs_names,
+    uint32_t max_ongoing_transfers)
 {
-    CHECK_AS_EXPECTED(1 == m_output_streams.size(), HAILO_INVALID_OPERATION, "Model has more than one output!");
-    auto copy = m_output_streams.begin()->second;
-    return copy;
-}
+    CHECK_AS_EXPECTED(0 != max_ongoing_transfers, HAILO_INVALID_ARGUMENT, "Invalid max ongoing transfers (must be greater than zero)");
 
-Expected<InferStreamOnStack> OutputBindingsOnStack::output(const std::string &name)
-{
-    CHECK_AS_EXPECTED(contains(m_output_streams, name), HAILO_NOT_FOUND, "Output {}, not found!", name);
-    auto copy = m_output_streams.at(name);
-    return copy;
-}
+    TRY(auto shutdown_event, Event::create_shared(Event::State::not_signalled));
+    // Each callback is completed once, so the queue never holds more than max_ongoing_transfers ids
+    TRY(auto completed_callbacks, SpscQueue<callback_id_t>::create(max_ongoing_transfers, shutdown_event,
+        SpscQueue<callback_id_t>::INIFINITE_TIMEOUT()));
 
-AsyncInferJobHrpcClient::AsyncInferJobHrpcClient(EventPtr event) : m_event(event)
-{
-}
+    auto ptr = make_unique_nothrow<CallbacksQueue>(connection, configured_infer_model_handle, outputs_names, max_ongoing_transfers,
+        std::move(completed_callbacks), shutdown_event);
+    CHECK_NOT_NULL_AS_EXPECTED(ptr, HAILO_OUT_OF_HOST_MEMORY);
 
-hailo_status AsyncInferJobHrpcClient::wait(std::chrono::milliseconds timeout)
-{
-    return m_event->wait(timeout);
+    return ptr;
 }
 
-CallbacksQueue::CallbacksQueue(std::shared_ptr<hrpc::Client> client, const std::vector<std::string> &outputs_names) :
-    m_outputs_names(outputs_names)
+CallbacksQueue::CallbacksQueue(std::shared_ptr<hrpc::ClientConnection> connection, rpc_object_handle_t configured_infer_model_handle,
+    const std::vector<std::string> &outputs_names, uint32_t max_ongoing_transfers, SpscQueue<callback_id_t> &&completed_callbacks,
+    EventPtr shutdown_event) :
+    m_connection(connection),
+    m_configured_infer_model_handle(configured_infer_model_handle),
+    m_custom_reply_id(0),
+    m_outputs_names(outputs_names),
+    m_slots(max_ongoing_transfers),
+    m_completed_callbacks(std::move(completed_callbacks)),
+    m_shutdown_event(shutdown_event)
 {
-    client->register_custom_reply(HailoRpcActionID::CALLBACK_CALLED,
-    [this, &outputs_names] (const MemoryView &serialized_reply, hrpc::RpcConnection connection) -> hailo_status {
-        TRY(auto tuple, CallbackCalledSerializer::deserialize_reply(serialized_reply));
-
-        auto callback_status = std::get<0>(tuple);
-        auto callback_handle_id = std::get<1>(tuple);
-
-        {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            CHECK(contains(m_callbacks, callback_handle_id), HAILO_NOT_FOUND, "Callback handle not found!");
-            m_callbacks_status[callback_handle_id] = callback_status;
-
-            if (HAILO_SUCCESS == callback_status) {
-                CHECK(contains(m_bindings, callback_handle_id), HAILO_NOT_FOUND, "Callback handle not found!");
-                for (const auto &output_name : outputs_names) {
-                    TRY(auto buffer, m_bindings.at(callback_handle_id).output(output_name)->get_buffer());
-                    auto status = connection.read_buffer(buffer);
-                    // TODO: Errors here should be unrecoverable (HRT-14275)
-                    CHECK_SUCCESS(status);
-                }
-            }
-            m_callbacks_queue.push(callback_handle_id);
-        }
+    for (auto &slot : m_slots) {
+        slot.is_taken = false;
+        slot.id = 0;
+        slot.status = HAILO_UNINITIALIZED;
+        slot.output_buffers.reserve(m_outputs_names.size());
+    }
 
-        m_cv.notify_one();
-        return HAILO_SUCCESS;
+    m_custom_reply_id = connection->register_custom_reply(HailoRpcActionID::CALLBACK_CALLED,
+    [this] (const MemoryView &serialized_reply, hrpc::RpcConnection connection) -> hailo_status {
+        return on_callback_called(serialized_reply, connection);
     });
 
-    m_is_running = true;
     m_callback_thread = std::thread([this] {
+        OsUtils::set_current_thread_name("HRPC_CALLBACK");
         while (true) {
-            callback_id_t callback_id;
-            hailo_status info_status = HAILO_UNINITIALIZED;
-            std::function<void(const AsyncInferCompletionInfo&)> cb;
-            {
-                std::unique_lock<std::mutex> lock(m_mutex);
-                m_cv.wait(lock, [this] { return !m_is_running || !m_callbacks_queue.empty(); });
-                if (!m_is_running) {
-                    break;
-                }
-
-                callback_id = m_callbacks_queue.front();
-                m_callbacks_queue.pop();
+            auto callback_id = m_completed_callbacks.dequeue();
+            if (HAILO_SHUTDOWN_EVENT_SIGNALED == callback_id.status()) {
+                break;
+            }
+            if (!callback_id) {
+                LOGGER__ERROR("Failed to dequeue completed callback, status = {}", callback_id.status());
+                break;
+            }
 
-                m_cv.wait(lock, [this, callback_id] { return !m_is_running || (m_callbacks.find(callback_id) != m_callbacks.end()); });
-                if (!m_is_running) {
-                    break;
-                }
+            // The slot is released before calling the callback, so the user can run the next frame from within it
+            auto &slot = get_slot(callback_id.value());
+            auto cb = std::move(slot.callback);
+            slot.callback = nullptr;
+            AsyncInferCompletionInfo info(slot.status);
+            slot.is_taken.store(false, std::memory_order_release);
 
-                info_status = m_callbacks_status[callback_id];
-                cb = m_callbacks[callback_id];
-                m_callbacks.erase(callback_id);
-                m_callbacks_status.erase(callback_id);
-                m_bindings.erase(callback_id);
-            }
-            AsyncInferCompletionInfo info(info_status);
             cb(info);
         }
     });
@@ -120,33 +91,71 @@ CallbacksQueue::CallbacksQueue(std::shared_ptr<hrpc::Client> client, const std::
 
 CallbacksQueue::~CallbacksQueue()
 {
-    {
-        std::unique_lock<std::mutex> lock(m_mutex);
-        m_is_running = false;
+    auto connection = m_connection.lock();
+    if (connection) {
+        connection->unregister_custom_reply(HailoRpcActionID::CALLBACK_CALLED, m_custom_reply_id);
+    }
+
+    auto status = m_shutdown_event->signal();
+    if (HAILO_SUCCESS != status) {
+        LOGGER__CRITICAL("Could not signal shutdown event! status = {}", status);
     }
-    m_cv.notify_one();
     m_callback_thread.join();
 }
+
+hailo_status CallbacksQueue::on_callback_called(const MemoryView &serialized_reply, hrpc::RpcConnection connection)
+{
+    TRY(auto tuple, CallbackCalledSerializer::deserialize_reply(serialized_reply));
+
+    auto callback_status = std::get<0>(tuple);
+    if (m_configured_infer_model_handle != std::get<1>(tuple)) {
+        return HAILO_NOT_FOUND; // The callback of another configured infer model sharing the connection
+    }
+    auto callback_handle_id = std::get<2>(tuple);
+
+    auto &slot = get_slot(callback_handle_id);
+    if (!slot.is_taken.load(std::memory_order_acquire) || (callback_handle_id != slot.id)) {
+        // Not registered (anymore), the connection discards the message and its buffers
+        return HAILO_NOT_FOUND;
+    }
+    slot.status = callback_status;
+
+    if (HAILO_SUCCESS == callback_status) {
+        auto status = connection.read_buffers(slot.output_buffers);
+        // TODO: Errors here should be unrecoverable (HRT-14275)
+        CHECK_SUCCESS(status);
+    }
+
+    return m_completed_callbacks.enqueue(callback_handle_id);
+}
+
 Expected<std::shared_ptr<AsyncInferJobHrpcClient>> CallbacksQueue::register_callback(callback_id_t id,
     ConfiguredInferModel::Bindings bindings,
     std::function<void(const AsyncInferCompletionInfo&)> callback)
 {
+    auto &slot = get_slot(id);
+    CHECK_AS_EXPECTED(!slot.is_taken.load(std::memory_order_acquire), HAILO_QUEUE_IS_FULL,
+        "Too many ongoing transfers (max {})", m_slots.size());
+
     TRY(auto event_ptr, Event::create_shared(Event::State::not_signalled));
 
-    {
-        std::unique_lock<std::mutex> lock(m_mutex);
-        TRY(auto output_bindings, OutputBindingsOnStack::create(bindings, m_outputs_names));
-        m_bindings.emplace(id, output_bindings);
-        m_callbacks_status[id] = HAILO_SUCCESS;
-        m_callbacks[id] = [callback, event_ptr] (const AsyncInferCompletionInfo &info) {
-            auto status = event_ptr->signal();
-            if (HAILO_SUCCESS != status) {
-                LOGGER__CRITICAL("Could not signal event! status = {}", status);
-            }
-            callback(info);
-        };
+    slot.output_buffers.clear();
+    for (const auto &output_name : m_outputs_names) {
+        TRY(auto output, bindings.output(output_name));
+        TRY(auto buffer, output.get_buffer());
+        slot.output_buffers.emplace_back(buffer);
     }
-    m_cv.notify_one();
+    slot.id = id;
+    slot.status = HAILO_SUCCESS;
+    slot.callback = [callback, event_ptr] (const AsyncInferCompletionInfo &info) {
+        auto status = event_ptr->signal();
+        if (HAILO_SUCCESS != status) {
+            LOGGER__CRITICAL("Could not signal event! status = {}", status);
+        }
+        callback(info);
+    };
+    // Published to the connection thread by sending the request that refers to this id
+    slot.is_taken.store(true, std::memory_order_release);
 
     auto ptr = make_shared_nothrow<AsyncInferJobHrpcClient>(event_ptr);
     CHECK_NOT_NULL(ptr, HAILO_OUT_OF_HOST_MEMORY);
@@ -154,15 +163,26 @@ Expected<std::shared_ptr<AsyncInferJobHrpcClient>> CallbacksQueue::register_call
     return ptr;
 }
 
-Expected<std::shared_ptr<ConfiguredInferModelHrpcClient>> ConfiguredInferModelHrpcClient::create(std::shared_ptr<hrpc::Client> client,
+void CallbacksQueue::unregister_callback(callback_id_t id)
+{
+    auto &slot = get_slot(id);
+    if (!slot.is_taken.load(std::memory_order_acquire) || (id != slot.id)) {
+        return;
+    }
+
+    slot.callback = nullptr;
+    slot.output_buffers.clear();
+    slot.is_taken.store(false, std::memory_order_release);
+}
+
+Expected<std::shared_ptr<ConfiguredInferModelHrpcClient>> ConfiguredInferModelHrpcClient::create(std::shared_ptr<hrpc::ClientConnection> connection,
     rpc_object_handle_t handle_id, std::vector<hailo_vstream_info_t> &&input_vstream_infos,
     std::vector<hailo_vstream_info_t> &&output_vstream_infos, uint32_t max_ongoing_transfers,
     std::unique_ptr<CallbacksQueue> &&callbacks_queue, rpc_object_handle_t infer_model_id,
     const std::unordered_map<std::string, size_t> inputs_frame_sizes,
     const std::unordered_map<std::string, size_t> outputs_frame_sizes)
 {
-    // TODO: consider create a separate client object here - HRT-13687
-    auto ptr = make_shared_nothrow<ConfiguredInferModelHrpcClient>(client, handle_id, std::move(input_vstream_infos),
+    auto ptr = make_shared_nothrow<ConfiguredInferModelHrpcClient>(connection, handle_id, std::move(input_vstream_infos),
         std::move(output_vstream_infos), max_ongoing_transfers, std::move(callbacks_queue), infer_model_id, inputs_frame_sizes,
         outputs_frame_sizes);
     CHECK_NOT_NULL(ptr, HAILO_OUT_OF_HOST_MEMORY);
@@ -182,9 +202,9 @@ ConfiguredInferModelHrpcClient::~ConfiguredInferModelHrpcClient()
         return;
     }
 
-    auto client = m_client.lock();
-    if (client) {
-        auto result = client->execute_request(HailoRpcActionID::CONFIGURED_INFER_MODEL__DESTROY, MemoryView(*request));
+    auto connection = m_connection.lock();
+    if (connection) {
+        auto result = connection->execute_request(HailoRpcActionID::CONFIGURED_INFER_MODEL__DESTROY, MemoryView(*request));
         if (!result) {
             LOGGER__CRITICAL("Failed to destroy configured infer model! status = {}", result.status());
         }
@@ -229,6 +249,10 @@ Expected<AsyncInferJob> ConfiguredInferModelHrpcClient::run_async(ConfiguredInfe
     std::function<void(const AsyncInferCompletionInfo &)> callback)
 {
     auto async_job = run_async_impl(bindings, callback);
+    if (HAILO_QUEUE_IS_FULL == async_job.status()) {
+        // Back-pressure, the caller should wait_for_async_ready() before running the next frame
+        return make_unexpected(async_job.status());
+    }
     if (HAILO_SUCCESS != async_job.status()) {
         shutdown();
         return make_unexpected(async_job.status());
@@ -255,46 +279,12 @@ Expected<AsyncInferJob> ConfiguredInferModelHrpcClient::run_async_impl(Configure
 
     TRY(auto job_ptr, m_callbacks_queue->register_callback(m_callbacks_counter, bindings, callback_wrapper));
 
-    TRY(auto request, RunAsyncSerializer::serialize_request(m_handle_id, m_infer_model_handle_id,
-        m_callbacks_counter));
-
-    auto client = m_client.lock();
-    CHECK_AS_EXPECTED(nullptr != client, HAILO_INTERNAL_FAILURE,
-        "Lost comunication with the server. This may happen if VDevice is released while the ConfiguredInferModel is in use.");
-    TRY(auto serialized_result, client->execute_request(HailoRpcActionID::CONFIGURED_INFER_MODEL__RUN_ASYNC,
-        MemoryView(request), [this, &bindings] (hrpc::RpcConnection connection) -> hailo_status {
-        for (const auto &input_vstream : m_input_vstream_infos) {
-            TRY(auto input, bindings.input(input_vstream.name));
-            auto buffer_type = ConfiguredInferModelBase::get_infer_stream_buffer_type(input);
-            switch(buffer_type) {
-            case BufferType::VIEW:
-            {
-                TRY(auto buffer, input.get_buffer());
-                auto status = connection.write_buffer(MemoryView(buffer));
-                CHECK_SUCCESS(status);
-                break;
-            }
-            case BufferType::PIX_BUFFER:
-            {
-                TRY(auto pix_buffer, input.get_pix_buffer());
-                for (uint32_t i = 0; i < pix_buffer.number_of_planes; i++) {
-                    auto status = connection.write_buffer(MemoryView(pix_buffer.planes[i].user_ptr, pix_buffer.planes[i].bytes_used));
-                    CHECK_SUCCESS(status);
-                }
-                break;
-            }
-            case BufferType::DMA_BUFFER:
-                LOGGER__CRITICAL("DMA_BUFFER is not supported in HRPC");
-                return HAILO_NOT_IMPLEMENTED;
-            default:
-                LOGGER__CRITICAL("Unknown buffer type");
-                return HAILO_INTERNAL_FAILURE;
-            }
-        }
-        return HAILO_SUCCESS;
-    }));
-    auto status = RunAsyncSerializer::deserialize_reply(MemoryView(serialized_result));
-    CHECK_SUCCESS_AS_EXPECTED(status);
+    auto status = send_run_async_request(bindings, m_callbacks_counter);
+    if (HAILO_SUCCESS != status) {
+        // The server doesn't know this callback, so it will never be called
+        m_callbacks_queue->unregister_callback(m_callbacks_counter);
+        return make_unexpected(status);
+    }
 
     {
         std::unique_lock<std::mutex> transfers_lock(m_ongoing_transfers_mutex);
@@ -304,13 +294,61 @@ Expected<AsyncInferJob> ConfiguredInferModelHrpcClient::run_async_impl(Configure
     return AsyncInferJobBase::create(job_ptr);
 }
 
+hailo_status ConfiguredInferModelHrpcClient::send_run_async_request(ConfiguredInferModel::Bindings &bindings,
+    callback_id_t callback_id)
+{
+    // The input buffers are sent together with the request
+    m_input_buffers.clear();
+    for (const auto &input_vstream : m_input_vstream_infos) {
+        TRY(auto input, bindings.input(input_vstream.name));
+        auto buffer_type = ConfiguredInferModelBase::get_infer_stream_buffer_type(input);
+        switch(buffer_type) {
+        case BufferType::VIEW:
+        {
+            TRY(auto buffer, input.get_buffer());
+            m_input_buffers.emplace_back(buffer);
+            break;
+        }
+        case BufferType::PIX_BUFFER:
+        {
+            TRY(auto pix_buffer, input.get_pix_buffer());
+            for (uint32_t i = 0; i < pix_buffer.number_of_planes; i++) {
+                m_input_buffers.emplace_back(pix_buffer.planes[i].user_ptr, pix_buffer.planes[i].bytes_used);
+            }
+            break;
+        }
+        case BufferType::DMA_BUFFER:
+            LOGGER__CRITICAL("DMA_BUFFER is not supported in HRPC");
+            return HAILO_NOT_IMPLEMENTED;
+        default:
+            LOGGER__CRITICAL("Unknown buffer type");
+            return HAILO_INTERNAL_FAILURE;
+        }
+    }
+
+    uint8_t request_buffer[RunAsyncSerializer::REQUEST_SIZE];
+    TRY(auto request, RunAsyncSerializer::serialize_request(m_handle_id, m_infer_model_handle_id,
+        callback_id, MemoryView(request_buffer, sizeof(request_buffer))));
+
+    auto connection = m_connection.lock();
+    CHECK(nullptr != connection, HAILO_INTERNAL_FAILURE,
+        "Lost comunication with the server. This may happen if VDevice is released while the ConfiguredInferModel is in use.");
+    uint8_t reply_buffer[RunAsyncSerializer::REPLY_SIZE];
+    TRY(auto serialized_result, connection->execute_request(HailoRpcActionID::CONFIGURED_INFER_MODEL__RUN_ASYNC,
+        request, m_input_buffers, MemoryView(reply_buffer, sizeof(reply_buffer))));
+    auto status = RunAsyncSerializer::deserialize_reply(serialized_result);
+    CHECK_SUCCESS(status);
+
+    return HAILO_SUCCESS;
+}
+
 hailo_status ConfiguredInferModelHrpcClient::set_scheduler_timeout(const std::chrono::milliseconds &timeout)
 {
     TRY(auto serialized_request, SetSchedulerTimeoutSerializer::serialize_request(m_handle_id, timeout));
-    auto client = m_client.lock();
-    CHECK_AS_EXPECTED(nullptr != client, HAILO_INTERNAL_FAILURE,
+    auto connection = m_connection.lock();
+    CHECK_AS_EXPECTED(nullptr != connection, HAILO_INTERNAL_FAILURE,
         "Lost comunication with the server. This may happen if VDevice is released while the ConfiguredInferModel is in use.");
-    TRY(auto result, client->execute_request(HailoRpcActionID::CONFIGURED_INFER_MODEL__SET_SCHEDULER_TIMEOUT, MemoryView(serialized_request)));
+    TRY(auto result, connection->execute_request(HailoRpcActionID::CONFIGURED_INFER_MODEL__SET_SCHEDULER_TIMEOUT, MemoryView(serialized_request)));
     CHECK_SUCCESS(SetSchedulerTimeoutSerializer::deserialize_reply(MemoryView(result)));
 
     return HAILO_SUCCESS;
@@ -319,10 +357,10 @@ hailo_status ConfiguredInferModelHrpcClient::set_scheduler_timeout(const std::ch
 hailo_status ConfiguredInferModelHrpcClient::set_scheduler_threshold(uint32_t threshold)
 {
     TRY(auto serialized_request, SetSchedulerThresholdSerializer::serialize_request(m_handle_id, threshold));
-    auto client = m_client.lock();
-    CHECK_AS_EXPECTED(nullptr != client, HAILO_INTERNAL_FAILURE,
+    auto connection = m_connection.lock();
+    CHECK_AS_EXPECTED(nullptr != connection, HAILO_INTERNAL_FAILURE,
         "Lost comunication with the server. This may happen if VDevice is released while the ConfiguredInferModel is in use.");
-    TRY(auto result, client->execute_request(HailoRpcActionID::CONFIGURED_INFER_MODEL__SET_SCHEDULER_THRESHOLD, MemoryView(serialized_request)));
+    TRY(auto result, connection->execute_request(HailoRpcActionID::CONFIGURED_INFER_MODEL__SET_SCHEDULER_THRESHOLD, MemoryView(serialized_request)));
     CHECK_SUCCESS(SetSchedulerThresholdSerializer::deserialize_reply(MemoryView(result)));
 
     return HAILO_SUCCESS;
@@ -331,22 +369,22 @@ hailo_status ConfiguredInferModelHrpcClient::set_scheduler_threshold(uint32_t th
 hailo_status ConfiguredInferModelHrpcClient::set_scheduler_priority(uint8_t priority)
 {
     TRY(auto serialized_request, SetSchedulerPrioritySerializer::serialize_request(m_handle_id, priority));
-    auto client = m_client.lock();
-    CHECK_AS_EXPECTED(nullptr != client, HAILO_INTERNAL_FAILURE,
+    auto connection = m_connection.lock();
+    CHECK_AS_EXPECTED(nullptr != connection, HAILO_INTERNAL_FAILURE,
         "Lost comunication with the server. This may happen if VDevice is released while the ConfiguredInferModel is in use.");
-    TRY(auto result, client->execute_request(HailoRpcActionID::CONFIGURED_INFER_MODEL__SET_SCHEDULER_PRIORITY, MemoryView(serialized_request)));
+    TRY(auto result, connection->execute_request(HailoRpcActionID::CONFIGURED_INFER_MODEL__SET_SCHEDULER_PRIORITY, MemoryView(serialized_request)));
     CHECK_SUCCESS(SetSchedulerPrioritySerializer::deserialize_reply(MemoryView(result)));
 
     return HAILO_SUCCESS;
 }
 
-Expected<LatencyMeasurementResult> ConfiguredInferModelHrpcClient::get_hw_latency_measurement()
+Expected<LatencyMeasurementResultExt> ConfiguredInferModelHrpcClient::get_hw_latency_measurement_ext()
 {
     TRY(auto serialized_request, GetHwLatencyMeasurementSerializer::serialize_request(m_handle_id));
-    auto client = m_client.lock();
-    CHECK_AS_EXPECTED(nullptr != client, HAILO_INTERNAL_FAILURE,
+    auto connection = m_connection.lock();
+    CHECK_AS_EXPECTED(nullptr != connection, HAILO_INTERNAL_FAILURE,
         "Lost comunication with the server. This may happen if VDevice is released while the ConfiguredInferModel is in use.");
-    TRY(auto result, client->execute_request(HailoRpcActionID::CONFIGURED_INFER_MODEL__GET_HW_LATENCY_MEASUREMENT, MemoryView(serialized_request)));
+    TRY(auto result, connection->execute_request(HailoRpcActionID::CONFIGURED_INFER_MODEL__GET_HW_LATENCY_MEASUREMENT, MemoryView(serialized_request)));
 
     TRY(auto tuple, GetHwLatencyMeasurementSerializer::deserialize_reply(MemoryView(result)));
 
@@ -356,8 +394,7 @@ Expected<LatencyMeasurementResult> ConfiguredInferModelHrpcClient::get_hw_latenc
     }
     CHECK_SUCCESS(status);
 
-    auto avg_hw_latency = std::get<1>(tuple);
-    LatencyMeasurementResult latency_measurement_result {avg_hw_latency};
+    LatencyMeasurementResultExt latency_measurement_result = std::get<1>(tuple);
 
     return latency_measurement_result;
 };
@@ -365,10 +402,10 @@ Expected<LatencyMeasurementResult> ConfiguredInferModelHrpcClient::get_hw_latenc
 hailo_status ConfiguredInferModelHrpcClient::activate()
 {
     TRY(auto serialized_request, ActivateSerializer::serialize_request(m_handle_id));
-    auto client = m_client.lock();
-    CHECK_AS_EXPECTED(nullptr != client, HAILO_INTERNAL_FAILURE,
+    auto connection = m_connection.lock();
+    CHECK_AS_EXPECTED(nullptr != connection, HAILO_INTERNAL_FAILURE,
         "Lost comunication with the server. This may happen if VDevice is released while the ConfiguredInferModel is in use.");
-    TRY(auto result, client->execute_request(HailoRpcActionID::CONFIGURED_INFER_MODEL__ACTIVATE, MemoryView(serialized_request)));
+    TRY(auto result, connection->execute_request(HailoRpcActionID::CONFIGURED_INFER_MODEL__ACTIVATE, MemoryView(serialized_request)));
 
     CHECK_SUCCESS(ActivateSerializer::deserialize_reply(MemoryView(result)));
 
@@ -378,10 +415,10 @@ hailo_status ConfiguredInferModelHrpcClient::activate()
 hailo_status ConfiguredInferModelHrpcClient::deactivate()
 {
     TRY(auto serialized_request, DeactivateSerializer::serialize_request(m_handle_id));
-    auto client = m_client.lock();
-    CHECK_AS_EXPECTED(nullptr != client, HAILO_INTERNAL_FAILURE,
+    auto connection = m_connection.lock();
+    CHECK_AS_EXPECTED(nullptr != connection, HAILO_INTERNAL_FAILURE,
         "Lost comunication with the server. This may happen if VDevice is released while the ConfiguredInferModel is in use.");
-    TRY(auto result, client->execute_request(HailoRpcActionID::CONFIGURED_INFER_MODEL__DEACTIVATE, MemoryView(serialized_request)));
+    TRY(auto result, connection->execute_request(HailoRpcActionID::CONFIGURED_INFER_MODEL__DEACTIVATE, MemoryView(serialized_request)));
 
     CHECK_SUCCESS(DeactivateSerializer::deserialize_reply(MemoryView(result)));
 
@@ -394,6 +431,16 @@ Expected<size_t> ConfiguredInferModelHrpcClient::get_async_queue_size()
     return queue_size;
 }
 
+Expected<std::vector<hailo_vstream_info_t>> ConfiguredInferModelHrpcClient::get_input_vstream_infos()
+{
+    return std::vector<hailo_vstream_info_t>(m_input_vstream_infos);
+}
+
+Expected<std::vector<hailo_vstream_info_t>> ConfiguredInferModelHrpcClient::get_output_vstream_infos()
+{
+    return std::vector<hailo_vstream_info_t>(m_output_vstream_infos);
+}
+
 hailo_status ConfiguredInferModelHrpcClient::validate_bindings(ConfiguredInferModel::Bindings bindings)
 {
     for (const auto &input_vstream : m_input_vstream_infos) {
@@ -470,10 +517,10 @@ hailo_status ConfiguredInferModelHrpcClient::validate_bindings(ConfiguredInferMo
 hailo_status ConfiguredInferModelHrpcClient::shutdown()
 {
     TRY(auto serialized_request, ShutdownSerializer::serialize_request(m_handle_id));
-    auto client = m_client.lock();
-    CHECK_AS_EXPECTED(nullptr != client, HAILO_INTERNAL_FAILURE,
+    auto connection = m_connection.lock();
+    CHECK_AS_EXPECTED(nullptr != connection, HAILO_INTERNAL_FAILURE,
         "Lost comunication with the server. This may happen if VDevice is released while the ConfiguredInferModel is in use.");
-    TRY(auto result, client->execute_request(HailoRpcActionID::CONFIGURED_INFER_MODEL__SHUTDOWN, MemoryView(serialized_request)));
+    TRY(auto result, connection->execute_request(HailoRpcActionID::CONFIGURED_INFER_MODEL__SHUTDOWN, MemoryView(serialized_request)));
 
     CHECK_SUCCESS(ShutdownSerializer::deserialize_reply(MemoryView(result)));
 
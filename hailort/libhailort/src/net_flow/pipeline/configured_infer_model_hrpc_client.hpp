@@ -13,37 +13,13 @@
 #include "hailo/infer_model.hpp"
 #include "infer_model_internal.hpp"
 #include "hrpc/client.hpp"
+#include "utils/thread_safe_queue.hpp"
 
 namespace hailort
 {
 
 using callback_id_t = uint32_t;
 
-class InferStreamOnStack final
-{
-public:
-    InferStreamOnStack(MemoryView buffer) : m_buffer(buffer) {}
-    Expected<MemoryView> get_buffer();
-
-private:
-    MemoryView m_buffer;
-};
-
-class OutputBindingsOnStack final
-{
-public:
-    static Expected<OutputBindingsOnStack> create(ConfiguredInferModel::Bindings bindings,
-        const std::vector<std::string> &outputs_names);
-    Expected<InferStreamOnStack> output();
-    Expected<InferStreamOnStack> output(const std::string &name);
-
-private:
-    OutputBindingsOnStack(std::unordered_map<std::string, InferStreamOnStack> &&output_streams) :
-        m_output_streams(std::move(output_streams)) {}
-
-    std::unordered_map<std::string, InferStreamOnStack> m_output_streams;
-};
-
 class AsyncInferJobHrpcClient : public AsyncInferJobBase
 {
 public:
@@ -55,10 +31,20 @@ private:
     EventPtr m_event;
 };
 
+// Holds the callbacks of the ongoing remote inferences, and calls them (on a dedicated thread) once the server replies.
+// Each callback id owns a slot in a fixed ring (sized to the max ongoing transfers) instead of entries in maps, and the
+// completed ids are passed to the callbacks thread through a lock-free queue, so the queue itself takes no locks.
+// Registering a frame still allocates its job's event, the job and the callback's wrapper.
 class CallbacksQueue
 {
 public:
-    CallbacksQueue(std::shared_ptr<hrpc::Client> client, const std::vector<std::string> &outputs_names);
+    static Expected<std::unique_ptr<CallbacksQueue>> create(std::shared_ptr<hrpc::ClientConnection> connection,
+        rpc_object_handle_t configured_infer_model_handle, const std::vector<std::string> &outputs_names,
+        uint32_t max_ongoing_transfers);
+
+    CallbacksQueue(std::shared_ptr<hrpc::ClientConnection> connection, rpc_object_handle_t configured_infer_model_handle,
+        const std::vector<std::string> &outputs_names, uint32_t max_ongoing_transfers,
+        SpscQueue<callback_id_t> &&completed_callbacks, EventPtr shutdown_event);
     ~CallbacksQueue();
 
     CallbacksQueue(const CallbacksQueue &other) = delete;
@@ -66,38 +52,52 @@ public:
     CallbacksQueue(CallbacksQueue &&other) = delete;
     CallbacksQueue& operator=(CallbacksQueue &&other) = delete;
 
+    // Fails with HAILO_QUEUE_IS_FULL if the slot of @a id is still taken by an ongoing transfer
     Expected<std::shared_ptr<AsyncInferJobHrpcClient>> register_callback(callback_id_t id,
         ConfiguredInferModel::Bindings bindings,
         std::function<void(const AsyncInferCompletionInfo&)> callback);
+    // Releases the slot of @a id, for a callback whose request was not sent to the server
+    void unregister_callback(callback_id_t id);
 
 private:
+    struct CallbackSlot {
+        std::atomic_bool is_taken;
+        callback_id_t id;
+        hailo_status status;
+        std::function<void(const AsyncInferCompletionInfo&)> callback;
+        // The user's output buffers (by the order of m_outputs_names), the server's reply is read straight into them
+        std::vector<MemoryView> output_buffers;
+    };
+
+    CallbackSlot &get_slot(callback_id_t id) { return m_slots[id % m_slots.size()]; }
+    hailo_status on_callback_called(const MemoryView &serialized_reply, hrpc::RpcConnection connection);
+
+    std::weak_ptr<hrpc::ClientConnection> m_connection;
+    const rpc_object_handle_t m_configured_infer_model_handle;
+    uint32_t m_custom_reply_id;
     const std::vector<std::string> m_outputs_names;
-    std::mutex m_mutex;
-    std::condition_variable m_cv;
-    std::queue<callback_id_t> m_callbacks_queue;
-    std::unordered_map<callback_id_t, std::function<void(const AsyncInferCompletionInfo&)>> m_callbacks;
-    std::atomic_bool m_is_running;
+    std::vector<CallbackSlot> m_slots;
+    SpscQueue<callback_id_t> m_completed_callbacks;
+    EventPtr m_shutdown_event;
     std::thread m_callback_thread;
-    std::unordered_map<callback_id_t, OutputBindingsOnStack> m_bindings;
-    std::unordered_map<callback_id_t, hailo_status> m_callbacks_status;
 };
 
 class ConfiguredInferModelHrpcClient : public ConfiguredInferModelBase
 {
 public:
-    static Expected<std::shared_ptr<ConfiguredInferModelHrpcClient>> create(std::shared_ptr<hrpc::Client> client,
+    static Expected<std::shared_ptr<ConfiguredInferModelHrpcClient>> create(std::shared_ptr<hrpc::ClientConnection> connection,
         rpc_object_handle_t handle_id, std::vector<hailo_vstream_info_t> &&input_vstream_infos,
         std::vector<hailo_vstream_info_t> &&output_vstream_infos, uint32_t max_ongoing_transfers,
         std::unique_ptr<CallbacksQueue> &&callbacks_queue, rpc_object_handle_t infer_model_handle_id,
         const std::unordered_map<std::string, size_t> inputs_frame_sizes,
         const std::unordered_map<std::string, size_t> outputs_frame_sizes);
-    ConfiguredInferModelHrpcClient(std::shared_ptr<hrpc::Client> client, rpc_object_handle_t handle_id,
+    ConfiguredInferModelHrpcClient(std::shared_ptr<hrpc::ClientConnection> connection, rpc_object_handle_t handle_id,
         std::vector<hailo_vstream_info_t> &&input_vstream_infos, std::vector<hailo_vstream_info_t> &&output_vstream_infos,
         uint32_t max_ongoing_transfers, std::unique_ptr<CallbacksQueue> &&callbacks_queue, rpc_object_handle_t infer_model_handle_id,
         const std::unordered_map<std::string, size_t> inputs_frame_sizes,
         const std::unordered_map<std::string, size_t> outputs_frame_sizes) :
             ConfiguredInferModelBase(inputs_frame_sizes, outputs_frame_sizes),
-            m_client(client), m_handle_id(handle_id), m_input_vstream_infos(std::move(input_vstream_infos)),
+            m_connection(connection), m_handle_id(handle_id), m_input_vstream_infos(std::move(input_vstream_infos)),
             m_output_vstream_infos(std::move(output_vstream_infos)), m_max_ongoing_transfers(max_ongoing_transfers),
             m_ongoing_transfers(0), m_callbacks_queue(std::move(callbacks_queue)), m_infer_model_handle_id(infer_model_handle_id),
             m_callbacks_counter(0) {}
@@ -117,13 +117,15 @@ public:
     virtual Expected<AsyncInferJob> run_async(ConfiguredInferModel::Bindings bindings,
         std::function<void(const AsyncInferCompletionInfo &)> callback) override;
 
-    virtual Expected<LatencyMeasurementResult> get_hw_latency_measurement() override;
+    virtual Expected<LatencyMeasurementResultExt> get_hw_latency_measurement_ext() override;
 
     virtual hailo_status set_scheduler_timeout(const std::chrono::milliseconds &timeout) override;
     virtual hailo_status set_scheduler_threshold(uint32_t threshold) override;
     virtual hailo_status set_scheduler_priority(uint8_t priority) override;
 
     virtual Expected<size_t> get_async_queue_size() override;
+    virtual Expected<std::vector<hailo_vstream_info_t>> get_input_vstream_infos() override;
+    virtual Expected<std::vector<hailo_vstream_info_t>> get_output_vstream_infos() override;
 
     virtual hailo_status shutdown() override;
 
@@ -131,8 +133,10 @@ private:
     virtual hailo_status validate_bindings(ConfiguredInferModel::Bindings bindings);
     Expected<AsyncInferJob> run_async_impl(ConfiguredInferModel::Bindings bindings,
         std::function<void(const AsyncInferCompletionInfo &)> callback);
+    hailo_status send_run_async_request(ConfiguredInferModel::Bindings &bindings, callback_id_t callback_id);
 
-    std::weak_ptr<hrpc::Client> m_client;
+    // The connection of the model, which may be shared with other models (see hrpc::Client::get_model_connection())
+    std::weak_ptr<hrpc::ClientConnection> m_connection;
     rpc_object_handle_t m_handle_id;
     std::vector<hailo_vstream_info_t> m_input_vstream_infos;
     std::vector<hailo_vstream_info_t> m_output_vstream_infos;
@@ -144,6 +148,8 @@ private:
     rpc_object_handle_t m_infer_model_handle_id;
     std::atomic_uint32_t m_callbacks_counter;
     std::mutex m_infer_mutex;
+    // Views of the input buffers sent by run_async(), reused between inferences. Guarded by m_infer_mutex.
+    std::vector<MemoryView> m_input_buffers;
 };
 
 } /* namespace hailort */
@@ -10,6 +10,8 @@
 #include "net_flow/pipeline/vstream_internal.hpp"
 #include "net_flow/pipeline/edge_elements.hpp"
 
+#include <future>
+
 namespace hailort
 {
 
@@ -36,17 +38,19 @@ hailo_status SinkElement::execute_dequeue_user_buffers(hailo_status /*error_stat
 
 Expected<std::shared_ptr<HwWriteElement>> HwWriteElement::create(std::shared_ptr<InputStreamBase> stream, const std::string &name,
     hailo_pipeline_elem_stats_flags_t elem_flags, std::shared_ptr<std::atomic<hailo_status>> pipeline_status,
-    PipelineDirection pipeline_direction)
+    PipelineDirection pipeline_direction, bool is_zero_copy)
 {
     TRY(auto duration_collector, DurationCollector::create(elem_flags));
     TRY(auto got_flush_event, Event::create_shared(Event::State::not_signalled));
 
-    // On HwWriteElement the stream always owns the buffer, hence, we set the mode explicitly.
-    auto status = stream->set_buffer_mode(StreamBufferMode::OWNING);
+    // The stream owns the buffer, unless the user's buffers are transferred as is (zero-copy), hence, we set the mode explicitly.
+    CHECK_AS_EXPECTED(!is_zero_copy || is_zero_copy_supported(*stream), HAILO_NOT_SUPPORTED,
+        "Zero-copy write is not supported on {}", stream->to_string());
+    auto status = stream->set_buffer_mode(is_zero_copy ? StreamBufferMode::NOT_OWNING : StreamBufferMode::OWNING);
     CHECK_SUCCESS_AS_EXPECTED(status);
 
     auto hw_write_elem_ptr = make_shared_nothrow<HwWriteElement>(stream, name,
-        std::move(duration_collector), std::move(pipeline_status), std::move(got_flush_event), pipeline_direction);
+        std::move(duration_collector), std::move(pipeline_status), std::move(got_flush_event), pipeline_direction, is_zero_copy);
     CHECK_AS_EXPECTED(nullptr != hw_write_elem_ptr, HAILO_OUT_OF_HOST_MEMORY);
 
     LOGGER__INFO("Created {}", hw_write_elem_ptr->description());
@@ -55,11 +59,18 @@ Expected<std::shared_ptr<HwWriteElement>> HwWriteElement::create(std::shared_ptr
 }
 
 HwWriteElement::HwWriteElement(std::shared_ptr<InputStreamBase> stream, const std::string &name, DurationCollector &&duration_collector,
-                               std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, EventPtr got_flush_event, PipelineDirection pipeline_direction) :
+                               std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, EventPtr got_flush_event, PipelineDirection pipeline_direction,
+                               bool is_zero_copy) :
     SinkElement(name, std::move(duration_collector), std::move(pipeline_status), pipeline_direction, nullptr),
-    m_stream(stream), m_got_flush_event(got_flush_event)
+    m_stream(stream), m_got_flush_event(got_flush_event), m_is_zero_copy(is_zero_copy), m_is_zero_copy_failed(false)
 {}
 
+bool HwWriteElement::is_zero_copy_supported(InputStreamBase &stream)
+{
+    // Only streams supporting the async API can transfer buffers they don't own
+    return stream.get_async_max_queue_size().has_value();
+}
+
 Expected<PipelineBuffer> HwWriteElement::run_pull(PipelineBuffer &&/*optional*/, const PipelinePad &/*source*/)
 {
     return make_unexpected(HAILO_INVALID_OPERATION);
@@ -80,7 +91,7 @@ hailo_status HwWriteElement::run_push(PipelineBuffer &&buffer, const PipelinePad
     }
 
     m_duration_collector.start_measurement();
-    const auto status = m_stream->write(MemoryView(buffer.data(), buffer.size()));
+    const auto status = m_is_zero_copy ? write_zero_copy(buffer) : m_stream->write(MemoryView(buffer.data(), buffer.size()));
     m_duration_collector.complete_measurement();
 
     if (HAILO_STREAM_ABORT == status) {
@@ -92,6 +103,53 @@ hailo_status HwWriteElement::run_push(PipelineBuffer &&buffer, const PipelinePad
     return HAILO_SUCCESS;
 }
 
+hailo_status HwWriteElement::write_zero_copy(PipelineBuffer &buffer)
+{
+    CHECK(!m_is_zero_copy_failed, HAILO_INTERNAL_FAILURE,
+        "{} (H2D) can't write, a previous transfer could not be cancelled", name());
+    CHECK(buffer.size() == m_stream->get_frame_size(), HAILO_INVALID_ARGUMENT,
+        "write size {} must be {}", buffer.size(), m_stream->get_frame_size());
+
+    // The buffer is mapped to the device for the transfer only (unless the user has already mapped it), and the
+    // ownership returns to the user when the transfer is done. Unaligned buffers are handled by the stream.
+    auto transfer_done = make_shared_nothrow<std::promise<hailo_status>>();
+    CHECK_NOT_NULL(transfer_done, HAILO_OUT_OF_HOST_MEMORY);
+    auto transfer_status = transfer_done->get_future();
+
+    auto status = m_stream->write_async(TransferRequest(MemoryView(buffer.data(), buffer.size()),
+        [transfer_done](hailo_status transfer_done_status) {
+            transfer_done->set_value(transfer_done_status);
+        }));
+    if (HAILO_SUCCESS != status) {
+        return status;
+    }
+
+    if (std::future_status::ready != transfer_status.wait_for(m_stream->get_timeout())) {
+        LOGGER__ERROR("{} (H2D) transfer has failed with timeout ({}ms)", name(), m_stream->get_timeout().count());
+
+        // The device may still be reading the user's buffer, so the transfer is cancelled and waited for before the
+        // buffer is returned to the user.
+        status = m_stream->abort_impl();
+        if (HAILO_SUCCESS != status) {
+            LOGGER__ERROR("Failed aborting {} after timeout, status = {}", name(), status);
+        }
+        if (std::future_status::ready != transfer_status.wait_for(m_stream->get_timeout())) {
+            // The transfer can't be waited for any longer, so the stream is left aborted and the element failed
+            LOGGER__CRITICAL("{} (H2D) transfer was not cancelled after abort, the device may still access the buffer",
+                name());
+            m_is_zero_copy_failed = true;
+            m_pipeline_status->store(HAILO_INTERNAL_FAILURE);
+            return HAILO_INTERNAL_FAILURE;
+        }
+        status = m_stream->clear_abort_impl();
+        if (HAILO_SUCCESS != status) {
+            LOGGER__ERROR("Failed clearing abort of {} after timeout, status = {}", name(), status);
+        }
+        return HAILO_TIMEOUT;
+    }
+    return transfer_status.get();
+}
+
 void HwWriteElement::run_push_async(PipelineBuffer &&/*buffer*/, const PipelinePad &/*sink*/)
 {
     LOGGER__ERROR("run_push_async is not supported for {}", name());
@@ -163,7 +221,11 @@ hailo_status HwWriteElement::execute_clear_abort()
 std::string HwWriteElement::description() const
 {
     std::stringstream element_description;
-    element_description << "(" << this->name() << " | hw_frame_size: " << m_stream->get_info().hw_frame_size << ")";   
+    element_description << "(" << this->name() << " | hw_frame_size: " << m_stream->get_info().hw_frame_size;
+    if (m_is_zero_copy) {
+        element_description << " | zero-copy";
+    }
+    element_description << ")";
 
     return element_description.str();
 }
@@ -32,9 +32,10 @@ class HwWriteElement : public SinkElement
 public:
     static Expected<std::shared_ptr<HwWriteElement>> create(std::shared_ptr<InputStreamBase> stream, const std::string &name,
         hailo_pipeline_elem_stats_flags_t elem_flags, std::shared_ptr<std::atomic<hailo_status>> pipeline_status,
-        PipelineDirection pipeline_direction = PipelineDirection::PUSH);
+        PipelineDirection pipeline_direction = PipelineDirection::PUSH, bool is_zero_copy = false);
     HwWriteElement(std::shared_ptr<InputStreamBase> stream, const std::string &name, DurationCollector &&duration_collector,
-        std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, EventPtr got_flush_event, PipelineDirection pipeline_direction);
+        std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, EventPtr got_flush_event, PipelineDirection pipeline_direction,
+        bool is_zero_copy);
     virtual ~HwWriteElement() = default;
 
     virtual hailo_status run_push(PipelineBuffer &&buffer, const PipelinePad &sink) override;
@@ -49,9 +50,18 @@ public:
     virtual hailo_status execute_clear_abort() override;
     virtual std::string description() const override;
 
+    // Whether the stream can transfer frames straight from the user's buffer
+    static bool is_zero_copy_supported(InputStreamBase &stream);
+
 private:
+    // Transfers the buffer itself to the device, returning once the transfer is done (so the buffer can be reused)
+    hailo_status write_zero_copy(PipelineBuffer &buffer);
+
     std::shared_ptr<InputStreamBase> m_stream;
     EventPtr m_got_flush_event;
+    const bool m_is_zero_copy;
+    // Set if a timed out transfer could not be cancelled - no more frames are written
+    bool m_is_zero_copy_failed;
 };
 
 class LastAsyncElement : public SinkElement
@@ -170,11 +170,21 @@ Expected<PipelineBuffer> PreInferElement::action(PipelineBuffer &&input, Pipelin
     CHECK_EXPECTED(transformed_buffer); // TODO (HRT-13278): Figure out how to remove CHECK_EXPECTED here
 
     TRY(auto dst, transformed_buffer->as_view(BufferProtection::WRITE));
-    TRY(auto src, input.as_view(BufferProtection::READ));
 
-    m_duration_collector.start_measurement();
-    const auto status = m_transform_context->transform(src, dst);
-    m_duration_collector.complete_measurement();
+    hailo_status status = HAILO_UNINITIALIZED;
+    if (BufferType::PIX_BUFFER == input.get_buffer_type()) {
+        // The planes are transformed straight from the user's buffers, without concatenating them first
+        auto pix_buffer = input.get_metadata().get_additional_data<PixBufferPipelineData>();
+        assert(nullptr != pix_buffer);
+        m_duration_collector.start_measurement();
+        status = m_transform_context->transform(pix_buffer->m_pix_buffer, dst);
+        m_duration_collector.complete_measurement();
+    } else {
+        TRY(auto src, input.as_view(BufferProtection::READ));
+        m_duration_collector.start_measurement();
+        status = m_transform_context->transform(src, dst);
+        m_duration_collector.complete_measurement();
+    }
 
     input.set_action_status(status);
     transformed_buffer->set_action_status(status);
@@ -189,6 +199,133 @@ Expected<PipelineBuffer> PreInferElement::action(PipelineBuffer &&input, Pipelin
     return transformed_buffer.release();
 }
 
+Expected<std::shared_ptr<PreProcessElement>> PreProcessElement::create(const hailo_preprocess_params_t &preprocess_params,
+    const hailo_3d_image_shape_t &dst_image_shape, const std::string &name, const ElementBuildParams &build_params,
+    PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline)
+{
+    TRY(auto preprocess_context, PreProcessContext::create(preprocess_params, dst_image_shape),
+        "Failed Creating PreProcessContext");
+    TRY(auto duration_collector, DurationCollector::create(build_params.elem_stats_flags));
+
+    auto pre_process_elem_ptr = make_shared_nothrow<PreProcessElement>(std::move(preprocess_context), nullptr, Buffer(),
+        name, build_params.timeout, std::move(duration_collector),
+        std::shared_ptr<std::atomic<hailo_status>>(build_params.pipeline_status), pipeline_direction, async_pipeline);
+    CHECK_AS_EXPECTED(nullptr != pre_process_elem_ptr, HAILO_OUT_OF_HOST_MEMORY);
+
+    LOGGER__INFO("Created {}", pre_process_elem_ptr->description());
+
+    return pre_process_elem_ptr;
+}
+
+Expected<std::shared_ptr<PreProcessElement>> PreProcessElement::create(const hailo_preprocess_params_t &preprocess_params,
+    const hailo_stream_info_t &stream_info, const std::string &name, const ElementBuildParams &build_params,
+    PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline)
+{
+    TRY(auto preprocess_context, PreProcessContext::create(preprocess_params, stream_info.shape),
+        "Failed Creating PreProcessContext");
+    TRY(auto transform_context, InputTransformContext::create(stream_info.shape, PreProcessContext::get_dst_format(preprocess_params),
+        stream_info.hw_shape, stream_info.format, std::vector<hailo_quant_info_t>(1, stream_info.quant_info)),
+        "Failed Creating InputTransformContext");
+    TRY(auto preprocessed_frame, Buffer::create(preprocess_context->dst_frame_size()));
+    TRY(auto duration_collector, DurationCollector::create(build_params.elem_stats_flags));
+
+    auto pre_process_elem_ptr = make_shared_nothrow<PreProcessElement>(std::move(preprocess_context), std::move(transform_context),
+        std::move(preprocessed_frame), name, build_params.timeout, std::move(duration_collector),
+        std::shared_ptr<std::atomic<hailo_status>>(build_params.pipeline_status), pipeline_direction, async_pipeline);
+    CHECK_AS_EXPECTED(nullptr != pre_process_elem_ptr, HAILO_OUT_OF_HOST_MEMORY);
+
+    LOGGER__INFO("Created {}", pre_process_elem_ptr->description());
+
+    return pre_process_elem_ptr;
+}
+
+PreProcessElement::PreProcessElement(std::unique_ptr<PreProcessContext> &&preprocess_context,
+    std::unique_ptr<InputTransformContext> &&transform_context, Buffer &&preprocessed_frame, const std::string &name,
+    std::chrono::milliseconds timeout, DurationCollector &&duration_collector, std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status,
+    PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline) :
+    FilterElement(name, std::move(duration_collector), std::move(pipeline_status), pipeline_direction, timeout, async_pipeline),
+    m_preprocess_context(std::move(preprocess_context)),
+    m_transform_context(std::move(transform_context)),
+    m_preprocessed_frame(std::move(preprocessed_frame))
+{}
+
+Expected<PipelineBuffer> PreProcessElement::run_pull(PipelineBuffer &&/*optional*/, const PipelinePad &/*source*/)
+{
+    LOGGER__ERROR("PreProcessElement does not support run_pull operation");
+    return make_unexpected(HAILO_INVALID_OPERATION);
+}
+
+PipelinePad &PreProcessElement::next_pad()
+{
+    // Note: The next elem to be run is downstream from this elem (i.e. buffers are pushed)
+    return *m_sources[0].next();
+}
+
+std::string PreProcessElement::description() const
+{
+    std::stringstream element_description;
+    element_description << "(" << this->name() << " | " << m_preprocess_context->description();
+    if (m_transform_context) {
+        element_description << " | " << m_transform_context->description();
+    }
+    element_description << ")";
+    return element_description.str();
+}
+
+hailo_status PreProcessElement::run(const MemoryView src, MemoryView dst)
+{
+    if (!m_transform_context) {
+        return m_preprocess_context->run(src, dst);
+    }
+
+    // The element runs on a single thread (the one of the queue before it), so the scratch buffer is never shared
+    auto status = m_preprocess_context->run(src, MemoryView(m_preprocessed_frame));
+    CHECK_SUCCESS(status);
+    return m_transform_context->transform(MemoryView(m_preprocessed_frame), dst);
+}
+
+Expected<PipelineBuffer> PreProcessElement::action(PipelineBuffer &&input, PipelineBuffer &&optional)
+{
+    if (PipelineBuffer::Type::FLUSH == input.get_type()) {
+        return std::move(input);
+    }
+
+    // Buffers are always taken from the next-pad-downstream
+    auto pool = next_pad_downstream().element().get_buffer_pool();
+    assert(pool);
+
+    auto processed_buffer = pool->get_available_buffer(std::move(optional), m_timeout);
+    if (HAILO_SHUTDOWN_EVENT_SIGNALED == processed_buffer.status()) {
+        return make_unexpected(processed_buffer.status());
+    }
+
+    if (!processed_buffer) {
+        input.set_action_status(processed_buffer.status());
+    }
+    CHECK_AS_EXPECTED(HAILO_TIMEOUT != processed_buffer.status(), HAILO_TIMEOUT,
+        "{} (H2D) failed with status={} (timeout={}ms)", name(), HAILO_TIMEOUT, m_timeout.count());
+    CHECK_EXPECTED(processed_buffer);
+
+    TRY(auto dst, processed_buffer->as_view(BufferProtection::WRITE));
+    TRY(auto src, input.as_view(BufferProtection::READ));
+
+    m_duration_collector.start_measurement();
+    const auto status = run(src, dst);
+    m_duration_collector.complete_measurement();
+
+    input.set_action_status(status);
+    processed_buffer->set_action_status(status);
+
+    auto metadata = input.get_metadata();
+
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
+    // Note: The latency to be measured starts as the input buffer is sent to the InputVStream (via write())
+    processed_buffer->set_metadata_start_time(metadata.get_start_time());
+
+    return processed_buffer.release();
+}
+
 Expected<std::shared_ptr<ConvertNmsToDetectionsElement>> ConvertNmsToDetectionsElement::create(
     const hailo_nms_info_t &nms_info, const std::string &name, hailo_pipeline_elem_stats_flags_t elem_flags,
     std::shared_ptr<std::atomic<hailo_status>> pipeline_status, std::chrono::milliseconds timeout,
@@ -266,6 +403,87 @@ Expected<PipelineBuffer> ConvertNmsToDetectionsElement::action(PipelineBuffer &&
     return buffer.release();
 }
 
+Expected<std::shared_ptr<IouPostProcessElement>> IouPostProcessElement::create(const hailo_nms_info_t &nms_info,
+    const net_flow::NmsPostProcessConfig &nms_config, const std::string &name, const ElementBuildParams &build_params,
+    PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline)
+{
+    TRY(auto duration_collector, DurationCollector::create(build_params.elem_stats_flags));
+
+    auto iou_post_process_elem_ptr = make_shared_nothrow<IouPostProcessElement>(nms_info, nms_config, name,
+        std::move(duration_collector), std::shared_ptr<std::atomic<hailo_status>>(build_params.pipeline_status),
+        build_params.timeout, pipeline_direction, async_pipeline);
+    CHECK_AS_EXPECTED(nullptr != iou_post_process_elem_ptr, HAILO_OUT_OF_HOST_MEMORY);
+
+    LOGGER__INFO("Created {}", iou_post_process_elem_ptr->description());
+
+    return iou_post_process_elem_ptr;
+}
+
+IouPostProcessElement::IouPostProcessElement(const hailo_nms_info_t &nms_info, const net_flow::NmsPostProcessConfig &nms_config,
+    const std::string &name, DurationCollector &&duration_collector, std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status,
+    std::chrono::milliseconds timeout, PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline) :
+    FilterElement(name, std::move(duration_collector), std::move(pipeline_status), pipeline_direction, timeout, async_pipeline),
+    m_nms_info(nms_info),
+    m_nms_config(nms_config)
+{}
+
+hailo_status IouPostProcessElement::run_push(PipelineBuffer &&buffer, const PipelinePad &sink)
+{
+    CHECK(PipelineDirection::PUSH == m_pipeline_direction, HAILO_INVALID_OPERATION,
+        "IouPostProcessElement {} does not support run_push operation", name());
+    return FilterElement::run_push(std::move(buffer), sink);
+}
+
+PipelinePad &IouPostProcessElement::next_pad()
+{
+    if (PipelineDirection::PUSH == m_pipeline_direction){
+        return *m_sources[0].next();
+    }
+    return *m_sinks[0].prev();
+}
+
+std::string IouPostProcessElement::description() const
+{
+    std::stringstream element_description;
+    element_description << "(" << this->name();
+    element_description << " | " << "IoU Threshold: " << this->m_nms_config.nms_iou_th;
+    element_description << " | " << "Max proposals per class: " << this->m_nms_config.max_proposals_per_class << ")";
+    return element_description.str();
+}
+
+Expected<PipelineBuffer> IouPostProcessElement::action(PipelineBuffer &&input, PipelineBuffer &&optional)
+{
+    // Buffers are always taken from the next-pad-downstream
+    auto pool = next_pad_downstream().element().get_buffer_pool();
+    assert(pool);
+
+    auto buffer_expected = pool->get_available_buffer(std::move(optional), m_timeout);
+    if (HAILO_SHUTDOWN_EVENT_SIGNALED == buffer_expected.status()) {
+        return make_unexpected(buffer_expected.status());
+    }
+    if (!buffer_expected) {
+        input.set_action_status(buffer_expected.status());
+    }
+    CHECK_EXPECTED(buffer_expected,
+        "{} (D2H) failed with status={}", name(), buffer_expected.status()); // TODO (HRT-13278): Figure out how to remove CHECK_EXPECTED here
+    auto buffer = buffer_expected.release();
+
+    buffer.set_metadata_start_time(input.get_metadata().get_start_time());
+
+    TRY(auto dst, buffer.as_view(BufferProtection::WRITE));
+
+    m_duration_collector.start_measurement();
+
+    // The detections stay local to the element, instead of being passed on as IouPipelineData
+    auto detections_pair = net_flow::NmsPostProcessOp::transform__d2h_NMS_DETECTIONS(input.data(), m_nms_info);
+    net_flow::NmsPostProcessOp::remove_overlapping_boxes(detections_pair.first, detections_pair.second, m_nms_config.nms_iou_th);
+    net_flow::NmsPostProcessOp::fill_nms_format_buffer(dst, detections_pair.first, detections_pair.second, m_nms_config);
+
+    m_duration_collector.complete_measurement();
+
+    return buffer;
+}
+
 Expected<std::shared_ptr<FillNmsFormatElement>> FillNmsFormatElement::create(const net_flow::NmsPostProcessConfig nms_config,
     const std::string &name, hailo_pipeline_elem_stats_flags_t elem_flags, std::shared_ptr<std::atomic<hailo_status>> pipeline_status,
     std::chrono::milliseconds timeout, PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline)
@@ -11,6 +11,7 @@
 #define _HAILO_FILTER_ELEMENTS_HPP_
 
 #include "net_flow/pipeline/pipeline_internal.hpp"
+#include "transform/preprocess.hpp"
 
 namespace hailort
 {
@@ -70,6 +71,39 @@ private:
     std::unique_ptr<InputTransformContext> m_transform_context;
 };
 
+class PreProcessElement : public FilterElement
+{
+public:
+    static Expected<std::shared_ptr<PreProcessElement>> create(const hailo_preprocess_params_t &preprocess_params,
+        const hailo_3d_image_shape_t &dst_image_shape, const std::string &name, const ElementBuildParams &build_params,
+        PipelineDirection pipeline_direction = PipelineDirection::PUSH, std::shared_ptr<AsyncPipeline> async_pipeline = nullptr);
+    // Pre-process and input transformation in one element - the element's output is in the stream's hw format.
+    // Still two passes (through a scratch frame), but it saves a queue element and its buffer pool.
+    static Expected<std::shared_ptr<PreProcessElement>> create(const hailo_preprocess_params_t &preprocess_params,
+        const hailo_stream_info_t &stream_info, const std::string &name, const ElementBuildParams &build_params,
+        PipelineDirection pipeline_direction = PipelineDirection::PUSH, std::shared_ptr<AsyncPipeline> async_pipeline = nullptr);
+    PreProcessElement(std::unique_ptr<PreProcessContext> &&preprocess_context, std::unique_ptr<InputTransformContext> &&transform_context,
+        Buffer &&preprocessed_frame, const std::string &name, std::chrono::milliseconds timeout, DurationCollector &&duration_collector,
+        std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, PipelineDirection pipeline_direction,
+        std::shared_ptr<AsyncPipeline> async_pipeline);
+    virtual ~PreProcessElement() = default;
+
+    virtual Expected<PipelineBuffer> run_pull(PipelineBuffer &&optional, const PipelinePad &source) override;
+    virtual PipelinePad &next_pad() override;
+    virtual std::string description() const override;
+
+protected:
+    virtual Expected<PipelineBuffer> action(PipelineBuffer &&input, PipelineBuffer &&optional) override;
+
+private:
+    hailo_status run(const MemoryView src, MemoryView dst);
+
+    std::unique_ptr<PreProcessContext> m_preprocess_context;
+    // Set only when fused with the input transformation, along with a scratch buffer for the pre-processed frame
+    std::unique_ptr<InputTransformContext> m_transform_context;
+    Buffer m_preprocessed_frame;
+};
+
 class RemoveOverlappingBboxesElement : public FilterElement
 {
 public:
@@ -162,6 +196,43 @@ private:
     hailo_nms_info_t m_nms_info;
 };
 
+// Fused IoU post-process - converts the device's NMS buffer to detections, removes the overlapping boxes and fills
+// the NMS format, in a single element (instead of ConvertNmsToDetectionsElement -> RemoveOverlappingBboxesElement ->
+// FillNmsFormatElement with queues in between)
+class IouPostProcessElement : public FilterElement
+{
+public:
+    static Expected<std::shared_ptr<IouPostProcessElement>> create(const hailo_nms_info_t &nms_info,
+        const net_flow::NmsPostProcessConfig &nms_config, const std::string &name, const ElementBuildParams &build_params,
+        PipelineDirection pipeline_direction = PipelineDirection::PUSH, std::shared_ptr<AsyncPipeline> async_pipeline = nullptr);
+    IouPostProcessElement(const hailo_nms_info_t &nms_info, const net_flow::NmsPostProcessConfig &nms_config, const std::string &name,
+        DurationCollector &&duration_collector, std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status,
+        std::chrono::milliseconds timeout, PipelineDirection pipeline_direction, std::shared_ptr<AsyncPipeline> async_pipeline);
+    virtual ~IouPostProcessElement() = default;
+    virtual hailo_status run_push(PipelineBuffer &&buffer, const PipelinePad &sink) override;
+    virtual PipelinePad &next_pad() override;
+    virtual std::string description() const override;
+
+    virtual hailo_status set_nms_iou_threshold(float32_t threshold) override
+    {
+        m_nms_config.nms_iou_th = threshold;
+        return HAILO_SUCCESS;
+    }
+
+    virtual hailo_status set_nms_max_proposals_per_class(uint32_t max_proposals_per_class) override
+    {
+        m_nms_config.max_proposals_per_class = max_proposals_per_class;
+        return HAILO_SUCCESS;
+    }
+
+protected:
+    virtual Expected<PipelineBuffer> action(PipelineBuffer &&input, PipelineBuffer &&optional) override;
+
+private:
+    const hailo_nms_info_t m_nms_info;
+    net_flow::NmsPostProcessConfig m_nms_config;
+};
+
 class FillNmsFormatElement : public FilterElement
 {
 public:
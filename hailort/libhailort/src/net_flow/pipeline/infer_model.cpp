@@ -38,6 +38,9 @@ hailo_format_t InferModelBase::InferStream::Impl::format() const
 
 size_t InferModelBase::InferStream::Impl::get_frame_size() const
 {
+    if (PreProcessContext::is_enabled(m_preprocess_params)) {
+        return PreProcessContext::get_src_frame_size(m_preprocess_params, m_vstream_info.shape);
+    }
     return HailoRTCommon::get_frame_size(m_vstream_info, m_user_buffer_format);
 }
 
@@ -112,6 +115,23 @@ uint32_t InferModelBase::InferStream::Impl::nms_max_accumulated_mask_size() cons
     return m_nms_max_accumulated_mask_size;
 }
 
+void InferModelBase::InferStream::Impl::set_preprocess_params(const hailo_preprocess_params_t &params)
+{
+    m_preprocess_params = params;
+}
+
+const hailo_preprocess_params_t &InferModelBase::InferStream::Impl::preprocess_params() const
+{
+    return m_preprocess_params;
+}
+
+Expected<hailo_preprocess_transform_info_t> InferModelBase::InferStream::Impl::get_preprocess_transform_info() const
+{
+    CHECK_AS_EXPECTED(PreProcessContext::is_enabled(m_preprocess_params), HAILO_INVALID_OPERATION,
+        "Pre-processing is disabled for stream {}", name());
+    return PreProcessContext::get_transform_info(m_preprocess_params, m_vstream_info.shape);
+}
+
 InferModelBase::InferStream::InferStream(std::shared_ptr<InferModelBase::InferStream::Impl> pimpl) : m_pimpl(pimpl)
 {
 }
@@ -201,6 +221,16 @@ uint32_t InferModelBase::InferStream::nms_max_accumulated_mask_size() const
     return m_pimpl->nms_max_accumulated_mask_size();
 }
 
+void InferModelBase::InferStream::set_preprocess_params(const hailo_preprocess_params_t &params)
+{
+    m_pimpl->set_preprocess_params(params);
+}
+
+Expected<hailo_preprocess_transform_info_t> InferModelBase::InferStream::get_preprocess_transform_info() const
+{
+    return m_pimpl->get_preprocess_transform_info();
+}
+
 Expected<std::shared_ptr<InferModelBase>> InferModelBase::create(VDevice &vdevice, const std::string &hef_path)
 {
     TRY(auto hef, Hef::create(hef_path));
@@ -312,6 +342,7 @@ Expected<ConfiguredInferModel> InferModelBase::configure()
     std::unordered_map<std::string, hailo_format_t> outputs_formats;
     std::unordered_map<std::string, size_t> inputs_frame_sizes;
     std::unordered_map<std::string, size_t> outputs_frame_sizes;
+    std::unordered_map<std::string, hailo_preprocess_params_t> inputs_preprocess_params;
 
     auto input_vstream_infos = network_groups.value()[0]->get_input_vstream_infos();
     CHECK_EXPECTED(input_vstream_infos);
@@ -320,6 +351,12 @@ Expected<ConfiguredInferModel> InferModelBase::configure()
         assert(contains(m_inputs, std::string(vstream_info.name)));
         inputs_formats[vstream_info.name] = m_inputs.at(vstream_info.name).format();
         inputs_frame_sizes[vstream_info.name] = m_inputs.at(vstream_info.name).get_frame_size();
+
+        const auto &preprocess_params = m_inputs.at(vstream_info.name).m_pimpl->preprocess_params();
+        if (PreProcessContext::is_enabled(preprocess_params)) {
+            CHECK_SUCCESS_AS_EXPECTED(PreProcessContext::validate(preprocess_params, vstream_info.shape));
+            inputs_preprocess_params[vstream_info.name] = preprocess_params;
+        }
     }
 
     auto output_vstream_infos = network_groups.value()[0]->get_output_vstream_infos();
@@ -338,6 +375,10 @@ Expected<ConfiguredInferModel> InferModelBase::configure()
                 (input_pair.second.m_pimpl->m_nms_max_proposals_per_class == static_cast<uint32_t>(INVALID_NMS_CONFIG)));
     }), HAILO_INVALID_OPERATION, "NMS config was changed for input");
 
+    CHECK_AS_EXPECTED(std::none_of(m_outputs.begin(), m_outputs.end(), [](const auto &output_pair) {
+        return PreProcessContext::is_enabled(output_pair.second.m_pimpl->preprocess_params());
+    }), HAILO_INVALID_OPERATION, "Pre-processing was set for output");
+
     for (const auto &output_pair : m_outputs) {
         auto &edge_name = output_pair.first;
         if ((output_pair.second.m_pimpl->m_nms_score_threshold == INVALID_NMS_CONFIG) &&
@@ -365,7 +406,7 @@ Expected<ConfiguredInferModel> InferModelBase::configure()
     }
 
     auto configured_infer_model_pimpl = ConfiguredInferModelImpl::create(network_groups.value()[0], inputs_formats, outputs_formats,
-        get_input_names(), get_output_names(), m_vdevice, inputs_frame_sizes, outputs_frame_sizes);
+        inputs_preprocess_params, get_input_names(), get_output_names(), m_vdevice, inputs_frame_sizes, outputs_frame_sizes);
     CHECK_EXPECTED(configured_infer_model_pimpl);
 
     // The hef buffer is being used only when working with the service.
@@ -546,7 +587,13 @@ Expected<AsyncInferJob> ConfiguredInferModel::run_async(ConfiguredInferModel::Bi
 
 Expected<LatencyMeasurementResult> ConfiguredInferModel::get_hw_latency_measurement()
 {
-    return m_pimpl->get_hw_latency_measurement();
+    TRY(const auto latency_result, m_pimpl->get_hw_latency_measurement_ext());
+    return LatencyMeasurementResult{latency_result.avg_hw_latency};
+}
+
+Expected<LatencyMeasurementResultExt> ConfiguredInferModel::get_hw_latency_measurement_ext()
+{
+    return m_pimpl->get_hw_latency_measurement_ext();
 }
 
 hailo_status ConfiguredInferModel::set_scheduler_timeout(const std::chrono::milliseconds &timeout)
@@ -600,6 +647,133 @@ Expected<AsyncInferJob> ConfiguredInferModel::run_async(const std::vector<Config
     return AsyncInferJobImpl::create(job_pimpl);
 }
 
+Expected<AsyncInferJob> ConfiguredInferModel::run_async_rois(const MemoryView src_frame,
+    const hailo_preprocess_params_t &preprocess_params, const std::vector<hailo_rectangle_t> &rois,
+    const std::vector<ConfiguredInferModel::Bindings> &bindings, std::function<void(const AsyncInferCompletionInfo &)> callback)
+{
+    return m_pimpl->run_async_rois(src_frame, preprocess_params, rois, bindings, callback);
+}
+
+Expected<AsyncInferJob> ConfiguredInferModel::run_async_tiles(const MemoryView src_frame,
+    const hailo_preprocess_params_t &preprocess_params, const hailo_tiling_params_t &tiling_params, MemoryView nms_output,
+    std::function<void(const AsyncInferCompletionInfo &)> callback)
+{
+    TRY(auto tiled_context, m_pimpl->create_tiled_infer_context(preprocess_params, tiling_params));
+    CHECK_AS_EXPECTED(nms_output.size() == tiled_context->output_frame_size(), HAILO_INVALID_ARGUMENT,
+        "Tiled inference output buffer size {} is different than the expected {}", nms_output.size(),
+        tiled_context->output_frame_size());
+
+    std::vector<ConfiguredInferModel::Bindings> tiles_bindings;
+    tiles_bindings.reserve(tiled_context->tiles().size());
+    for (size_t i = 0; i < tiled_context->tiles().size(); i++) {
+        TRY(auto bindings, create_bindings());
+        TRY(auto output, bindings.output());
+        CHECK_SUCCESS_AS_EXPECTED(output.set_buffer(tiled_context->tile_output(i)));
+        tiles_bindings.emplace_back(std::move(bindings));
+    }
+
+    auto tiles_done = [tiled_context, nms_output, callback](const AsyncInferCompletionInfo &completion_info) {
+        auto status = completion_info.status;
+        if (HAILO_SUCCESS == status) {
+            status = tiled_context->merge_detections(nms_output);
+        }
+        callback(AsyncInferCompletionInfo(status));
+    };
+    return m_pimpl->run_async_rois(src_frame, preprocess_params, tiled_context->tiles(), tiles_bindings, tiles_done);
+}
+
+Expected<AsyncInferJob> ConfiguredInferModelBase::run_async_rois(const MemoryView src_frame,
+    const hailo_preprocess_params_t &preprocess_params, const std::vector<hailo_rectangle_t> &rois,
+    const std::vector<ConfiguredInferModel::Bindings> &bindings, std::function<void(const AsyncInferCompletionInfo &)> callback)
+{
+    CHECK_AS_EXPECTED(!rois.empty(), HAILO_INVALID_ARGUMENT, "Multi-ROI inference requires at least one ROI");
+    CHECK_AS_EXPECTED(rois.size() == bindings.size(), HAILO_INVALID_ARGUMENT,
+        "Multi-ROI inference got {} ROIs, but {} bindings", rois.size(), bindings.size());
+
+    // All ROIs are launched at once, so a partial launch (and a job that never completes) is ruled out up front
+    TRY(const auto queue_size, get_async_queue_size());
+    CHECK_AS_EXPECTED(rois.size() <= queue_size, HAILO_INVALID_ARGUMENT,
+        "Multi-ROI inference got {} ROIs, but the async queue holds only {} frames", rois.size(), queue_size);
+
+    TRY(const auto input_vstream_infos, get_input_vstream_infos());
+    CHECK_AS_EXPECTED(1 == input_vstream_infos.size(), HAILO_INVALID_OPERATION,
+        "Multi-ROI inference is supported only for models with a single input");
+    const std::string input_name = input_vstream_infos[0].name;
+    TRY(auto preprocess, PreProcessContext::create(preprocess_params, input_vstream_infos[0].shape));
+    CHECK_AS_EXPECTED(src_frame.size() == preprocess->src_frame_size(), HAILO_INVALID_ARGUMENT,
+        "Multi-ROI source frame size {} is different than the expected {}", src_frame.size(), preprocess->src_frame_size());
+
+    const auto frame_size = preprocess->dst_frame_size();
+    CHECK_AS_EXPECTED(contains(m_inputs_frame_sizes, input_name) && (frame_size == m_inputs_frame_sizes.at(input_name)),
+        HAILO_INVALID_OPERATION, "Input {} frame size does not match the pre-processed ROI size {} ({})", input_name, frame_size,
+        preprocess->description());
+
+    // A single allocation holds the inputs of all ROIs, and is held by the job until all of them are done
+    TRY(auto rois_inputs, Buffer::create_shared(frame_size * rois.size()));
+    for (size_t i = 0; i < rois.size(); i++) {
+        CHECK_SUCCESS_AS_EXPECTED(preprocess->set_roi(rois[i]));
+        CHECK_SUCCESS_AS_EXPECTED(preprocess->run(src_frame, MemoryView(rois_inputs->data() + (i * frame_size), frame_size)));
+    }
+
+    auto job_pimpl = make_shared_nothrow<AsyncInferJobImpl>(static_cast<uint32_t>(rois.size()));
+    CHECK_NOT_NULL_AS_EXPECTED(job_pimpl, HAILO_OUT_OF_HOST_MEMORY);
+
+    auto rois_done = [rois_inputs, job_pimpl, callback](const AsyncInferCompletionInfo &completion_info) {
+        bool should_call_callback = ConfiguredInferModelBase::get_stream_done(completion_info.status, job_pimpl);
+        if (should_call_callback) {
+            AsyncInferCompletionInfo final_completion_info(ConfiguredInferModelBase::get_completion_status(job_pimpl));
+            callback(final_completion_info);
+            ConfiguredInferModelBase::mark_callback_done(job_pimpl);
+        }
+    };
+
+    // The buffers of the ROIs' bindings are taken by run_async(), so the bindings are free once the ROIs are launched
+    std::unique_lock<std::mutex> lock(m_rois_mutex);
+    while (m_rois_bindings.size() < rois.size()) {
+        TRY(auto roi_input_stream, create_infer_stream(input_vstream_infos[0]));
+        std::unordered_map<std::string, ConfiguredInferModel::Bindings::InferStream> inputs;
+        inputs.emplace(input_name, std::move(roi_input_stream));
+        TRY(auto roi_bindings, create_bindings(std::move(inputs), {}));
+        m_rois_bindings.emplace_back(std::move(roi_bindings));
+    }
+
+    for (size_t i = 0; i < rois.size(); i++) {
+        auto &roi_bindings = m_rois_bindings[i];
+        roi_bindings.m_outputs = bindings[i].m_outputs;
+        TRY(auto roi_input_stream, roi_bindings.input());
+        CHECK_SUCCESS_AS_EXPECTED(roi_input_stream.set_buffer(MemoryView(rois_inputs->data() + (i * frame_size), frame_size)));
+
+        auto partial_job = run_async(roi_bindings, rois_done);
+        if (HAILO_SUCCESS != partial_job.status()) {
+            shutdown();
+            return make_unexpected(partial_job.status());
+        }
+        partial_job->detach();
+    }
+
+    return AsyncInferJobImpl::create(job_pimpl);
+}
+
+Expected<std::shared_ptr<TiledInferContext>> ConfiguredInferModelBase::create_tiled_infer_context(
+    const hailo_preprocess_params_t &preprocess_params, const hailo_tiling_params_t &tiling_params)
+{
+    TRY(const auto input_vstream_infos, get_input_vstream_infos());
+    TRY(const auto output_vstream_infos, get_output_vstream_infos());
+    CHECK_AS_EXPECTED((1 == input_vstream_infos.size()) && (1 == output_vstream_infos.size()), HAILO_INVALID_OPERATION,
+        "Tiled inference is supported only for models with a single input and a single output");
+
+    TRY(auto tiled_context, TiledInferContext::create(preprocess_params, tiling_params, input_vstream_infos[0],
+        output_vstream_infos[0]));
+
+    // The tiles' outputs are parsed as float32 by-class NMS frames
+    const std::string output_name = output_vstream_infos[0].name;
+    CHECK_AS_EXPECTED(contains(m_outputs_frame_sizes, output_name) &&
+        (tiled_context->output_frame_size() == m_outputs_frame_sizes.at(output_name)), HAILO_INVALID_OPERATION,
+        "Tiled inference requires output {} to be configured with HAILO_NMS order and FLOAT32 type", output_name);
+
+    return tiled_context;
+}
+
 Expected<ConfiguredInferModel::Bindings> ConfiguredInferModelBase::create_bindings(
     std::unordered_map<std::string, ConfiguredInferModel::Bindings::InferStream> &&inputs,
     std::unordered_map<std::string, ConfiguredInferModel::Bindings::InferStream> &&outputs)
@@ -651,11 +825,12 @@ hailo_status ConfiguredInferModelBase::run(ConfiguredInferModel::Bindings bindin
 Expected<std::shared_ptr<ConfiguredInferModelImpl>> ConfiguredInferModelImpl::create(std::shared_ptr<ConfiguredNetworkGroup> net_group,
     const std::unordered_map<std::string, hailo_format_t> &inputs_formats,
     const std::unordered_map<std::string, hailo_format_t> &outputs_formats,
+    const std::unordered_map<std::string, hailo_preprocess_params_t> &inputs_preprocess_params,
     const std::vector<std::string> &input_names, const std::vector<std::string> &output_names, VDevice &vdevice,
     const std::unordered_map<std::string, size_t> inputs_frame_sizes, const std::unordered_map<std::string, size_t> outputs_frame_sizes,
     const uint32_t timeout)
 {
-    auto async_infer_runner = AsyncInferRunnerImpl::create(net_group, inputs_formats, outputs_formats, timeout);
+    auto async_infer_runner = AsyncInferRunnerImpl::create(net_group, inputs_formats, outputs_formats, inputs_preprocess_params, timeout);
     CHECK_EXPECTED(async_infer_runner);
 
     auto &hw_elem = async_infer_runner.value()->get_async_pipeline()->get_async_hw_element();
@@ -885,12 +1060,12 @@ Expected<AsyncInferJob> ConfiguredInferModelImpl::run_async(ConfiguredInferModel
     return AsyncInferJobImpl::create(job_pimpl);
 }
 
-Expected<LatencyMeasurementResult> ConfiguredInferModelImpl::get_hw_latency_measurement()
+Expected<LatencyMeasurementResultExt> ConfiguredInferModelImpl::get_hw_latency_measurement_ext()
 {
     auto cng = m_cng.lock();
     CHECK_NOT_NULL_AS_EXPECTED(cng, HAILO_INTERNAL_FAILURE);
 
-    return cng->get_latency_measurement();
+    return cng->get_latency_measurement_ext();
 }
 
 hailo_status ConfiguredInferModelImpl::set_scheduler_timeout(const std::chrono::milliseconds &timeout)
@@ -925,6 +1100,22 @@ Expected<size_t> ConfiguredInferModelImpl::get_async_queue_size()
     return cng->get_min_buffer_pool_size();
 }
 
+Expected<std::vector<hailo_vstream_info_t>> ConfiguredInferModelImpl::get_input_vstream_infos()
+{
+    auto cng = m_cng.lock();
+    CHECK_NOT_NULL_AS_EXPECTED(cng, HAILO_INTERNAL_FAILURE);
+
+    return cng->get_input_vstream_infos();
+}
+
+Expected<std::vector<hailo_vstream_info_t>> ConfiguredInferModelImpl::get_output_vstream_infos()
+{
+    auto cng = m_cng.lock();
+    CHECK_NOT_NULL_AS_EXPECTED(cng, HAILO_INTERNAL_FAILURE);
+
+    return cng->get_output_vstream_infos();
+}
+
 AsyncInferJob::AsyncInferJob(std::shared_ptr<AsyncInferJobBase> pimpl) : m_pimpl(pimpl), m_should_wait_in_dtor(true)
 {
 }
@@ -68,6 +68,8 @@ Expected<ConfiguredInferModel> InferModelHrpcClient::configure()
 {
     rpc_create_configured_infer_model_request_params_t request_params;
     for (const auto &input : m_inputs) {
+        CHECK_AS_EXPECTED(!PreProcessContext::is_enabled(input.second.m_pimpl->preprocess_params()), HAILO_NOT_SUPPORTED,
+            "Host pre-processing is not supported over hrpc (input {})", input.first);
         rpc_stream_params_t current_stream_params;
         current_stream_params.format_order = static_cast<uint32_t>(input.second.format().order);
         current_stream_params.format_type = static_cast<uint32_t>(input.second.format().type);
@@ -117,12 +119,14 @@ Expected<ConfiguredInferModel> InferModelHrpcClient::configure()
         outputs_frame_sizes.emplace(output.second.name(), output.second.get_frame_size());
     }
 
-    auto callbacks_queue = make_unique_nothrow<CallbacksQueue>(client, m_output_names);
-    CHECK_NOT_NULL_AS_EXPECTED(callbacks_queue, HAILO_OUT_OF_HOST_MEMORY);
+    // The model's frames and callbacks go through a connection of its own (when the transport allows it), so they aren't
+    // held back by the transfers of other models
+    TRY(auto connection, client->get_model_connection());
+    TRY(auto callbacks_queue, CallbacksQueue::create(connection, configured_infer_handle, m_output_names, async_queue_size));
 
     TRY(auto input_vstream_infos, m_hef.get_input_vstream_infos());
     TRY(auto output_vstream_infos, m_hef.get_output_vstream_infos());
-    TRY(auto cim_client_ptr, ConfiguredInferModelHrpcClient::create(client,
+    TRY(auto cim_client_ptr, ConfiguredInferModelHrpcClient::create(connection,
         configured_infer_handle,
         std::move(input_vstream_infos), std::move(output_vstream_infos),
         async_queue_size, std::move(callbacks_queue), m_handle,
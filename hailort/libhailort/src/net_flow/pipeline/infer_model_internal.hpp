@@ -15,8 +15,11 @@
 #define _HAILO_INFER_MODEL_INTERNAL_HPP_
 
 #include "hailo/infer_model.hpp"
+#include "hailo/hailort_defaults.hpp"
 #include "net_flow/pipeline/async_infer_runner.hpp"
+#include "net_flow/pipeline/tiled_infer.hpp"
 #include "net_flow/ops/nms_post_process.hpp"
+#include "transform/preprocess.hpp"
 #include "hrpc/client.hpp"
 
 namespace hailort
@@ -98,7 +101,8 @@ class InferModel::InferStream::Impl
 public:
     Impl(const hailo_vstream_info_t &vstream_info) : m_vstream_info(vstream_info), m_user_buffer_format(vstream_info.format),
         m_nms_score_threshold(static_cast<float32_t>(INVALID_NMS_CONFIG)), m_nms_iou_threshold(static_cast<float32_t>(INVALID_NMS_CONFIG)),
-        m_nms_max_proposals_per_class(static_cast<uint32_t>(INVALID_NMS_CONFIG)), m_nms_max_accumulated_mask_size(static_cast<uint32_t>(INVALID_NMS_CONFIG))
+        m_nms_max_proposals_per_class(static_cast<uint32_t>(INVALID_NMS_CONFIG)), m_nms_max_accumulated_mask_size(static_cast<uint32_t>(INVALID_NMS_CONFIG)),
+        m_preprocess_params(HailoRTDefaults::get_preprocess_params())
     {
         m_user_buffer_format.flags = HAILO_FORMAT_FLAGS_NONE; // Init user's format flags to NONE for transposed models
     }
@@ -123,6 +127,10 @@ public:
     uint32_t nms_max_proposals_per_class() const;
     uint32_t nms_max_accumulated_mask_size() const;
 
+    void set_preprocess_params(const hailo_preprocess_params_t &params);
+    const hailo_preprocess_params_t &preprocess_params() const;
+    Expected<hailo_preprocess_transform_info_t> get_preprocess_transform_info() const;
+
 private:
     friend class InferModel;
     friend class InferModelBase;
@@ -135,6 +143,8 @@ private:
     float32_t m_nms_iou_threshold;
     uint32_t m_nms_max_proposals_per_class;
     uint32_t m_nms_max_accumulated_mask_size;
+
+    hailo_preprocess_params_t m_preprocess_params;
 };
 
 class AsyncInferJobBase
@@ -187,12 +197,22 @@ public:
     virtual hailo_status run(ConfiguredInferModel::Bindings bindings, std::chrono::milliseconds timeout);
     virtual Expected<AsyncInferJob> run_async(ConfiguredInferModel::Bindings bindings,
         std::function<void(const AsyncInferCompletionInfo &)> callback = ASYNC_INFER_EMPTY_CALLBACK) = 0;
-    virtual Expected<LatencyMeasurementResult> get_hw_latency_measurement() = 0;
+    virtual Expected<LatencyMeasurementResultExt> get_hw_latency_measurement_ext() = 0;
     virtual hailo_status set_scheduler_timeout(const std::chrono::milliseconds &timeout) = 0;
     virtual hailo_status set_scheduler_threshold(uint32_t threshold) = 0;
     virtual hailo_status set_scheduler_priority(uint8_t priority) = 0;
     virtual Expected<size_t> get_async_queue_size() = 0;
     virtual hailo_status shutdown() = 0;
+    virtual Expected<std::vector<hailo_vstream_info_t>> get_input_vstream_infos() = 0;
+    virtual Expected<std::vector<hailo_vstream_info_t>> get_output_vstream_infos() = 0;
+
+    // Pre-processes every ROI into an input buffer owned by the job, and launches all ROIs as a single job.
+    // The user's bindings are not modified - each ROI is launched with bindings of its own, reused between calls.
+    Expected<AsyncInferJob> run_async_rois(const MemoryView src_frame, const hailo_preprocess_params_t &preprocess_params,
+        const std::vector<hailo_rectangle_t> &rois, const std::vector<ConfiguredInferModel::Bindings> &bindings,
+        std::function<void(const AsyncInferCompletionInfo &)> callback);
+    Expected<std::shared_ptr<TiledInferContext>> create_tiled_infer_context(const hailo_preprocess_params_t &preprocess_params,
+        const hailo_tiling_params_t &tiling_params);
 
     static Expected<ConfiguredInferModel::Bindings> create_bindings(
         std::unordered_map<std::string, ConfiguredInferModel::Bindings::InferStream> &&inputs,
@@ -210,6 +230,9 @@ protected:
     std::unordered_map<std::string, size_t> m_inputs_frame_sizes;
     std::unordered_map<std::string, size_t> m_outputs_frame_sizes;
 
+    // Bindings of the ROIs launched by run_async_rois() (input of their own, outputs of the user's bindings)
+    std::mutex m_rois_mutex;
+    std::vector<ConfiguredInferModel::Bindings> m_rois_bindings;
 };
 
 class ConfiguredInferModelImpl : public ConfiguredInferModelBase
@@ -217,6 +240,7 @@ class ConfiguredInferModelImpl : public ConfiguredInferModelBase
 public:
     static Expected<std::shared_ptr<ConfiguredInferModelImpl>> create(std::shared_ptr<ConfiguredNetworkGroup> net_group,
         const std::unordered_map<std::string, hailo_format_t> &inputs_formats, const std::unordered_map<std::string, hailo_format_t> &outputs_formats,
+        const std::unordered_map<std::string, hailo_preprocess_params_t> &inputs_preprocess_params,
         const std::vector<std::string> &input_names, const std::vector<std::string> &output_names, VDevice &vdevice,
         const std::unordered_map<std::string, size_t> inputs_frame_sizes, const std::unordered_map<std::string, size_t> outputs_frame_sizes,
         const uint32_t timeout = HAILO_DEFAULT_VSTREAM_TIMEOUT_MS);
@@ -231,12 +255,14 @@ public:
     virtual hailo_status deactivate() override;
     virtual Expected<AsyncInferJob> run_async(ConfiguredInferModel::Bindings bindings,
         std::function<void(const AsyncInferCompletionInfo &)> callback) override;
-    virtual Expected<LatencyMeasurementResult> get_hw_latency_measurement() override;
+    virtual Expected<LatencyMeasurementResultExt> get_hw_latency_measurement_ext() override;
     virtual hailo_status set_scheduler_timeout(const std::chrono::milliseconds &timeout) override;
     virtual hailo_status set_scheduler_threshold(uint32_t threshold) override;
     virtual hailo_status set_scheduler_priority(uint8_t priority) override;
     virtual Expected<size_t> get_async_queue_size() override;
     virtual hailo_status shutdown() override;
+    virtual Expected<std::vector<hailo_vstream_info_t>> get_input_vstream_infos() override;
+    virtual Expected<std::vector<hailo_vstream_info_t>> get_output_vstream_infos() override;
 
     static Expected<std::shared_ptr<ConfiguredInferModelImpl>> create_for_ut(std::shared_ptr<ConfiguredNetworkGroup> net_group,
         std::shared_ptr<AsyncInferRunnerImpl> async_infer_runner, const std::vector<std::string> &input_names, const std::vector<std::string> &output_names,
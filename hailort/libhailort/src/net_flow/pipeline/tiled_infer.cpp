@@ -0,0 +1,177 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file tiled_infer.cpp
+ * @brief Tiled inference of high resolution frames
+ **/
+
+#include "net_flow/pipeline/tiled_infer.hpp"
+#include "transform/preprocess.hpp"
+#include "hailo/hailort_common.hpp"
+#include "common/utils.hpp"
+
+#include <algorithm>
+
+
+namespace hailort
+{
+
+static const hailo_rectangle_t FULL_FRAME_TILE = { 0.0f, 0.0f, 1.0f, 1.0f };
+
+hailo_status TiledInferContext::validate(const hailo_tiling_params_t &tiling_params)
+{
+    CHECK((tiling_params.columns > 0) && (tiling_params.rows > 0), HAILO_INVALID_ARGUMENT,
+        "Invalid tiling grid {}x{}", tiling_params.columns, tiling_params.rows);
+    CHECK((tiling_params.overlap >= 0.0f) && (tiling_params.overlap < 1.0f), HAILO_INVALID_ARGUMENT,
+        "Tiles overlap must be in the range [0, 1), got {}", tiling_params.overlap);
+    CHECK((tiling_params.nms_iou_threshold > 0.0f) && (tiling_params.nms_iou_threshold <= 1.0f), HAILO_INVALID_ARGUMENT,
+        "Tiles NMS IoU threshold must be in the range (0, 1], got {}", tiling_params.nms_iou_threshold);
+    return HAILO_SUCCESS;
+}
+
+// Splits [0, 1] into @a count segments of equal size, where adjacent segments overlap by @a overlap of their size
+static std::vector<std::pair<float32_t, float32_t>> split_axis(uint32_t count, float32_t overlap)
+{
+    const auto count_f = static_cast<float32_t>(count);
+    const auto size = 1.0f / (count_f - ((count_f - 1.0f) * overlap));
+    const auto step = size * (1.0f - overlap);
+
+    std::vector<std::pair<float32_t, float32_t>> segments;
+    segments.reserve(count);
+    for (uint32_t i = 0; i < count; i++) {
+        const auto start = static_cast<float32_t>(i) * step;
+        // The last segment always ends at the frame's edge, regardless of float rounding
+        const auto end = ((count - 1) == i) ? 1.0f : std::min(start + size, 1.0f);
+        segments.emplace_back(start, end);
+    }
+    return segments;
+}
+
+std::vector<hailo_rectangle_t> TiledInferContext::calc_tiles(const hailo_tiling_params_t &tiling_params)
+{
+    const auto columns = split_axis(tiling_params.columns, tiling_params.overlap);
+    const auto rows = split_axis(tiling_params.rows, tiling_params.overlap);
+
+    std::vector<hailo_rectangle_t> tiles;
+    tiles.reserve((columns.size() * rows.size()) + (tiling_params.add_full_frame_tile ? 1 : 0));
+    for (const auto &row : rows) {
+        for (const auto &column : columns) {
+            tiles.push_back(hailo_rectangle_t{row.first, column.first, row.second, column.second});
+        }
+    }
+    if (tiling_params.add_full_frame_tile) {
+        tiles.push_back(FULL_FRAME_TILE);
+    }
+    return tiles;
+}
+
+Expected<std::shared_ptr<TiledInferContext>> TiledInferContext::create(const hailo_preprocess_params_t &preprocess_params,
+    const hailo_tiling_params_t &tiling_params, const hailo_vstream_info_t &input_vstream_info,
+    const hailo_vstream_info_t &output_vstream_info)
+{
+    CHECK_SUCCESS_AS_EXPECTED(validate(tiling_params));
+    CHECK_AS_EXPECTED(HAILO_FORMAT_ORDER_HAILO_NMS == output_vstream_info.format.order, HAILO_INVALID_OPERATION,
+        "Tiled inference requires an NMS output, got {} order for output {}",
+        HailoRTCommon::get_format_order_str(output_vstream_info.format.order), output_vstream_info.name);
+
+    auto tiles = calc_tiles(tiling_params);
+    std::vector<hailo_preprocess_transform_info_t> tiles_transform_info;
+    tiles_transform_info.reserve(tiles.size());
+    for (const auto &tile : tiles) {
+        TRY(auto transform_info, PreProcessContext::get_transform_info(preprocess_params, input_vstream_info.shape, tile));
+        tiles_transform_info.push_back(transform_info);
+    }
+
+    hailo_format_t nms_format{};
+    nms_format.type = HAILO_FORMAT_TYPE_FLOAT32;
+    nms_format.order = HAILO_FORMAT_ORDER_HAILO_NMS;
+    nms_format.flags = HAILO_FORMAT_FLAGS_NONE;
+    const size_t output_frame_size = HailoRTCommon::get_nms_host_frame_size(output_vstream_info.nms_shape, nms_format);
+    TRY(auto tiles_outputs, Buffer::create(output_frame_size * tiles.size()));
+
+    auto context = make_shared_nothrow<TiledInferContext>(std::move(tiles), std::move(tiles_transform_info),
+        std::move(tiles_outputs), preprocess_params, input_vstream_info.shape, output_vstream_info.nms_shape,
+        tiling_params.nms_iou_threshold);
+    CHECK_NOT_NULL_AS_EXPECTED(context, HAILO_OUT_OF_HOST_MEMORY);
+
+    return context;
+}
+
+TiledInferContext::TiledInferContext(std::vector<hailo_rectangle_t> &&tiles,
+    std::vector<hailo_preprocess_transform_info_t> &&tiles_transform_info, Buffer &&tiles_outputs,
+    const hailo_preprocess_params_t &preprocess_params, const hailo_3d_image_shape_t &input_shape,
+    const hailo_nms_shape_t &nms_shape, float32_t nms_iou_threshold) :
+    m_tiles(std::move(tiles)),
+    m_tiles_transform_info(std::move(tiles_transform_info)),
+    m_tiles_outputs(std::move(tiles_outputs)),
+    m_output_frame_size(m_tiles_outputs.size() / m_tiles.size()),
+    m_src_width(static_cast<float32_t>(preprocess_params.src_width)),
+    m_src_height(static_cast<float32_t>(preprocess_params.src_height)),
+    m_dst_width(static_cast<float32_t>(input_shape.width)),
+    m_dst_height(static_cast<float32_t>(input_shape.height)),
+    m_nms_info(),
+    m_nms_config()
+{
+    m_nms_info.number_of_classes = nms_shape.number_of_classes;
+    m_nms_info.max_bboxes_per_class = nms_shape.max_bboxes_per_class;
+
+    m_nms_config.nms_iou_th = nms_iou_threshold;
+    m_nms_config.number_of_classes = nms_shape.number_of_classes;
+    m_nms_config.max_proposals_per_class = nms_shape.max_bboxes_per_class;
+}
+
+MemoryView TiledInferContext::tile_output(size_t tile_index)
+{
+    assert(tile_index < m_tiles.size());
+    return MemoryView(m_tiles_outputs.data() + (tile_index * m_output_frame_size), m_output_frame_size);
+}
+
+void TiledInferContext::remap_to_frame(hailo_bbox_float32_t &bbox, const hailo_preprocess_transform_info_t &transform_info) const
+{
+    // Boxes are normalized to the model's input - back to source pixels through the tile's pre-process transform,
+    // and then normalized to the whole frame. Boxes leaking into letterbox padding are clipped to the tile.
+    const auto to_frame_x = [&](float32_t x) {
+        const auto src_x = ((x * m_dst_width) - transform_info.offset_x) / transform_info.scale_x;
+        return std::min(std::max(src_x / m_src_width, 0.0f), 1.0f);
+    };
+    const auto to_frame_y = [&](float32_t y) {
+        const auto src_y = ((y * m_dst_height) - transform_info.offset_y) / transform_info.scale_y;
+        return std::min(std::max(src_y / m_src_height, 0.0f), 1.0f);
+    };
+
+    bbox.x_min = to_frame_x(bbox.x_min);
+    bbox.x_max = to_frame_x(bbox.x_max);
+    bbox.y_min = to_frame_y(bbox.y_min);
+    bbox.y_max = to_frame_y(bbox.y_max);
+}
+
+hailo_status TiledInferContext::merge_detections(MemoryView nms_output)
+{
+    CHECK(nms_output.size() == m_output_frame_size, HAILO_INVALID_ARGUMENT,
+        "Tiled inference output buffer size {} is different than the expected {}", nms_output.size(), m_output_frame_size);
+
+    std::vector<net_flow::DetectionBbox> detections;
+    detections.reserve(static_cast<size_t>(m_nms_info.number_of_classes) * m_nms_info.max_bboxes_per_class);
+    std::vector<uint32_t> classes_detections_count(m_nms_info.number_of_classes, 0);
+
+    for (size_t tile_index = 0; tile_index < m_tiles.size(); tile_index++) {
+        auto tile_detections = net_flow::NmsPostProcessOp::transform__d2h_NMS_DETECTIONS(tile_output(tile_index).data(), m_nms_info);
+        for (auto &detection : tile_detections.first) {
+            remap_to_frame(detection.m_bbox, m_tiles_transform_info[tile_index]);
+            detections.emplace_back(std::move(detection));
+        }
+        for (size_t class_index = 0; class_index < classes_detections_count.size(); class_index++) {
+            classes_detections_count[class_index] += tile_detections.second[class_index];
+        }
+    }
+
+    // Same suppression and layout as the NMS post-process, over the detections of all tiles
+    net_flow::NmsPostProcessOp::remove_overlapping_boxes(detections, classes_detections_count, m_nms_config.nms_iou_th);
+    net_flow::NmsPostProcessOp::fill_nms_format_buffer(nms_output, detections, classes_detections_count, m_nms_config);
+
+    return HAILO_SUCCESS;
+}
+
+} /* namespace hailort */
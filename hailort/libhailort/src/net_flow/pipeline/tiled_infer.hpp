@@ -0,0 +1,66 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file tiled_infer.hpp
+ * @brief Tiled inference of high resolution frames - splits a frame into overlapping tiles, and merges the
+ *        NMS detections of all tiles back into a single frame
+ **/
+
+#ifndef _HAILO_TILED_INFER_HPP_
+#define _HAILO_TILED_INFER_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+#include "hailo/buffer.hpp"
+
+#include "net_flow/ops/nms_post_process.hpp"
+
+#include <vector>
+#include <memory>
+
+
+namespace hailort
+{
+
+class TiledInferContext final
+{
+public:
+    static Expected<std::shared_ptr<TiledInferContext>> create(const hailo_preprocess_params_t &preprocess_params,
+        const hailo_tiling_params_t &tiling_params, const hailo_vstream_info_t &input_vstream_info,
+        const hailo_vstream_info_t &output_vstream_info);
+
+    static hailo_status validate(const hailo_tiling_params_t &tiling_params);
+    // Tiles in normalized [0, 1] coordinates of the frame, row by row
+    static std::vector<hailo_rectangle_t> calc_tiles(const hailo_tiling_params_t &tiling_params);
+
+    TiledInferContext(std::vector<hailo_rectangle_t> &&tiles, std::vector<hailo_preprocess_transform_info_t> &&tiles_transform_info,
+        Buffer &&tiles_outputs, const hailo_preprocess_params_t &preprocess_params, const hailo_3d_image_shape_t &input_shape,
+        const hailo_nms_shape_t &nms_shape, float32_t nms_iou_threshold);
+
+    const std::vector<hailo_rectangle_t> &tiles() const { return m_tiles; }
+    size_t output_frame_size() const { return m_output_frame_size; }
+    MemoryView tile_output(size_t tile_index);
+
+    // Remaps the detections of all tiles to the whole frame, and merges them with a global NMS into @a nms_output
+    hailo_status merge_detections(MemoryView nms_output);
+
+private:
+    void remap_to_frame(hailo_bbox_float32_t &bbox, const hailo_preprocess_transform_info_t &transform_info) const;
+
+    const std::vector<hailo_rectangle_t> m_tiles;
+    const std::vector<hailo_preprocess_transform_info_t> m_tiles_transform_info;
+    Buffer m_tiles_outputs;
+    const size_t m_output_frame_size;
+    const float32_t m_src_width;
+    const float32_t m_src_height;
+    const float32_t m_dst_width;
+    const float32_t m_dst_height;
+    hailo_nms_info_t m_nms_info;
+    net_flow::NmsPostProcessConfig m_nms_config;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_TILED_INFER_HPP_ */
@@ -289,13 +289,9 @@ hailo_status InputVStream::write(const hailo_pix_buffer_t &buffer)
         return m_vstream->write(buffer);
     }
 
-    // Other cases - allocate a contiguous buffer to hold all plains
+    // Contiguous planes are passed as a single frame
     bool is_contiguous = true;
     uint32_t planes_total_size = 0;
-    /* assuming contiguous memory. If not, this will be overriden by the coming loop */
-    void *data_ptr = buffer.planes[0].user_ptr;
-
-    /* calculate total data size by summing the planes' sizes and check if the planes are contiguous */
     for (uint32_t plane_index = 0; plane_index < buffer.number_of_planes; plane_index++){
         auto &plane = buffer.planes[plane_index];
         planes_total_size += plane.bytes_used;
@@ -308,24 +304,12 @@ hailo_status InputVStream::write(const hailo_pix_buffer_t &buffer)
         }
     }
 
-    BufferPtr contiguous_buffer = nullptr;
-    if (! is_contiguous) {
-        /* copy to a contiguous buffer, and then pass it */
-        auto expected_buffer = Buffer::create_shared(planes_total_size);
-        CHECK_EXPECTED_AS_STATUS(expected_buffer);
-        contiguous_buffer = expected_buffer.release();
-        uint32_t copied_bytes = 0;
-
-        for (uint32_t plane_index = 0; plane_index < buffer.number_of_planes; plane_index++){
-            auto &plane = buffer.planes[plane_index];
-            std::memcpy(contiguous_buffer->data() + copied_bytes, plane.user_ptr, plane.bytes_used);
-            copied_bytes += plane.bytes_used;
-        }
-
-        data_ptr = contiguous_buffer->data();
+    if (is_contiguous) {
+        return write(MemoryView(buffer.planes[0].user_ptr, planes_total_size));
     }
 
-    return m_vstream->write(std::move(MemoryView(data_ptr, planes_total_size)));
+    // Other cases - the vstream either transforms the planes as they are, or concatenates them
+    return m_vstream->write(buffer);
 }
 
 hailo_status InputVStream::flush()
@@ -746,6 +730,7 @@ InputVStreamImpl::InputVStreamImpl(const hailo_vstream_info_t &vstream_info, con
 {
     // TODO: propagate a flag instead of using dynamic_pointer_cast (will be disabled when we'll disable RTTI)
     m_is_multi_planar = (nullptr != std::dynamic_pointer_cast<PixBufferElement>(pipeline_entry));
+    m_is_planes_transform = (nullptr != std::dynamic_pointer_cast<PreInferElement>(pipeline_entry));
 
     if (HAILO_SUCCESS != output_status) {
         return;
@@ -792,6 +777,10 @@ hailo_status InputVStreamImpl::write(const hailo_pix_buffer_t &buffer)
             "Trying to write to vstream {} before its network group is activated", name());
     }
 
+    if (!(m_is_multi_planar || m_is_planes_transform)) {
+        return write_contiguous(buffer);
+    }
+
     assert(1 == m_entry_element->sinks().size());
     auto status = m_entry_element->sinks()[0].run_push(PipelineBuffer(buffer));
     if (HAILO_SHUTDOWN_EVENT_SIGNALED == status) {
@@ -805,6 +794,25 @@ hailo_status InputVStreamImpl::write(const hailo_pix_buffer_t &buffer)
     return status;
 }
 
+hailo_status InputVStreamImpl::write_contiguous(const hailo_pix_buffer_t &buffer)
+{
+    // The pipeline's entry takes whole frames, so the planes are copied to a contiguous buffer
+    uint32_t planes_total_size = 0;
+    for (uint32_t plane_index = 0; plane_index < buffer.number_of_planes; plane_index++) {
+        planes_total_size += buffer.planes[plane_index].bytes_used;
+    }
+
+    TRY(auto contiguous_buffer, Buffer::create(planes_total_size));
+    uint32_t copied_bytes = 0;
+    for (uint32_t plane_index = 0; plane_index < buffer.number_of_planes; plane_index++) {
+        auto &plane = buffer.planes[plane_index];
+        std::memcpy(contiguous_buffer.data() + copied_bytes, plane.user_ptr, plane.bytes_used);
+        copied_bytes += plane.bytes_used;
+    }
+
+    return write(MemoryView(contiguous_buffer));
+}
+
 hailo_status InputVStreamImpl::flush()
 {
     assert(1 == m_entry_element->sinks().size());
@@ -8,6 +8,7 @@
  **/
 
 #include "vstream_builder.hpp"
+#include "common/utils.hpp"
 #include "hailo/vstream.hpp"
 #include "net_flow/ops/nms_post_process.hpp"
 #include "net_flow/ops/ssd_post_process.hpp"
@@ -57,17 +58,22 @@ Expected<std::vector<InputVStream>> VStreamsBuilderUtils::create_inputs(
             std::move(elements), vstreams, vstream_params, pipeline_status, core_op_activated_event,
             pipeline_latency_accumulator.value()));
     } else {
-        auto hw_write_elem = HwWriteElement::create(input_stream,
-            PipelineObject::create_element_name("HwWriteEl", input_stream->name(), input_stream->get_info().index),
-            vstream_params.pipeline_elements_stats_flags, pipeline_status);
-        CHECK_EXPECTED(hw_write_elem);
-        elements.insert(elements.begin(), hw_write_elem.value());
-
         auto should_transform = InputTransformContext::is_transformation_required(input_stream->get_info().shape,
             vstream_params.user_buffer_format, input_stream->get_info().hw_shape, input_stream->get_info().format,
             input_stream->get_quant_infos());
         CHECK_EXPECTED(should_transform);
 
+        // The user's frame is already in the device's layout, so it can be transferred without copying it
+        const auto is_zero_copy = !should_transform.value() && is_input_zero_copy_enabled() &&
+            HwWriteElement::is_zero_copy_supported(*input_stream);
+
+        auto hw_write_elem = HwWriteElement::create(input_stream,
+            PipelineObject::create_element_name("HwWriteEl", input_stream->name(), input_stream->get_info().index),
+            vstream_params.pipeline_elements_stats_flags, pipeline_status, PipelineDirection::PUSH, is_zero_copy);
+        CHECK_EXPECTED(hw_write_elem);
+        elements.insert(elements.begin(), hw_write_elem.value());
+
+        std::shared_ptr<PipelineElement> entry_elem = hw_write_elem.value();
         if (should_transform.value()) {
             auto queue_elem = PushQueueElement::create(
                 PipelineObject::create_element_name("PushQEl", input_stream->get_info().name, input_stream->get_info().index),
@@ -84,18 +90,14 @@ Expected<std::vector<InputVStream>> VStreamsBuilderUtils::create_inputs(
             elements.insert(elements.begin(), pre_infer_elem.value());
             CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(pre_infer_elem.value(), queue_elem.value()));
 
-            input_stream->set_timeout(user_timeout);
-            auto vstream = InputVStream::create(vstream_info, input_stream->get_quant_infos(), vstream_params, pre_infer_elem.release(),
-                hw_write_elem.release(), std::move(elements), std::move(pipeline_status), core_op_activated_event, pipeline_latency_accumulator.release());
-            CHECK_EXPECTED(vstream);
-            vstreams.emplace_back(vstream.release());
-        } else {
-            input_stream->set_timeout(user_timeout);
-            auto vstream = InputVStream::create(vstream_info, input_stream->get_quant_infos(), vstream_params, hw_write_elem.value(), hw_write_elem.value(),
-                std::move(elements), std::move(pipeline_status), core_op_activated_event, pipeline_latency_accumulator.release());
-            CHECK_EXPECTED(vstream);
-            vstreams.emplace_back(vstream.release());
+            entry_elem = pre_infer_elem.release();
         }
+
+        input_stream->set_timeout(user_timeout);
+        auto vstream = InputVStream::create(vstream_info, input_stream->get_quant_infos(), vstream_params, entry_elem,
+            hw_write_elem.release(), std::move(elements), std::move(pipeline_status), core_op_activated_event, pipeline_latency_accumulator.release());
+        CHECK_EXPECTED(vstream);
+        vstreams.emplace_back(vstream.release());
     }
 
     for (const auto &vstream : vstreams) {
@@ -379,15 +381,20 @@ Expected<std::vector<OutputVStream>> VStreamsBuilderUtils::create_output_post_pr
     CHECK_EXPECTED(hw_read_queue_element);
     CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(hw_read_element.value(), hw_read_queue_element.value()));
 
+    // Softmax is calculated in float32, so half precision user formats are converted by the softmax op itself
+    auto softmax_input_params = vstream_params;
+    softmax_input_params.user_buffer_format.type = HAILO_FORMAT_TYPE_FLOAT32;
+
     auto post_infer_element = add_post_infer_element(output_stream, pipeline_status, elements,
-        "PostInferEl", vstream_params);
+        "PostInferEl", softmax_input_params);
     CHECK_EXPECTED(post_infer_element);
     CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(hw_read_queue_element.value(), post_infer_element.value()));
 
+    auto pre_softmax_frame_size = HailoRTCommon::get_frame_size(output_vstream_info, softmax_input_params.user_buffer_format);
     auto post_transform_frame_size = HailoRTCommon::get_frame_size(output_vstream_info, vstream_params.user_buffer_format);
 
     auto pre_softmax_queue_element = add_pull_queue_element(output_stream, pipeline_status, elements, "PullQEl_pre_softmax",
-        vstream_params, post_transform_frame_size);
+        softmax_input_params, pre_softmax_frame_size);
     CHECK_SUCCESS_AS_EXPECTED(PipelinePad::link_pads(post_infer_element.value(), pre_softmax_queue_element.value()));
 
     auto softmax_element = add_softmax_element(output_stream, elements, "SoftmaxPPEl", vstream_params, softmax_op_metadata, build_params);
@@ -686,6 +693,7 @@ Expected<std::shared_ptr<SoftmaxPostProcessElement>> VStreamsBuilderUtils::add_s
     // Currently softmax only supports inputs to be float32 and order NHWC or NC
     auto updated_inputs_metadata = softmax_op_metadata.get()->inputs_metadata();
     updated_inputs_metadata.begin()->second.format = vstream_params.user_buffer_format;
+    updated_inputs_metadata.begin()->second.format.type = HAILO_FORMAT_TYPE_FLOAT32;
     auto updated_outputs_metadata = softmax_op_metadata.get()->outputs_metadata();
     updated_outputs_metadata.begin()->second.format = vstream_params.user_buffer_format;
     auto metadata = std::dynamic_pointer_cast<net_flow::SoftmaxOpMetadata>(softmax_op_metadata);
@@ -1176,7 +1184,7 @@ hailo_status VStreamsBuilderUtils::add_nms_post_process(OutputStreamPtrVector &o
 
     if (!op_metadata->nms_config().bbox_only) {
         CHECK(HailoRTCommon::is_nms(vstreams_params.user_buffer_format.order), HAILO_INVALID_ARGUMENT,
-            "NMS output format order must be HAILO_FORMAT_ORDER_HAILO_NMS or HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK");
+            "NMS output format order must be HAILO_FORMAT_ORDER_HAILO_NMS, HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK or HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE");
     }
 
     std::unordered_map<std::string, net_flow::BufferMetaData> inputs_metadata;
@@ -1294,4 +1302,9 @@ Expected<AccumulatorPtr> VStreamsBuilderUtils::create_pipeline_latency_accumulat
     return pipeline_latency_accumulator;
 }
 
+bool VStreamsBuilderUtils::is_input_zero_copy_enabled()
+{
+    return is_env_variable_on(INPUT_VSTREAM_ZERO_COPY_ENV_VAR);
+}
+
 } /* namespace hailort */
@@ -15,6 +15,11 @@
 namespace hailort
 {
 
+// Writes input frames which require no transformation straight from the user's buffer, rather than copying them into
+// the stream's buffers. Each write then returns only once the frame is transferred to the device, so the user's buffer
+// can be reused - hence, frames of a multi-input network must be written from separate threads.
+#define INPUT_VSTREAM_ZERO_COPY_ENV_VAR ("HAILO_INPUT_VSTREAM_ZERO_COPY")
+
 class VStreamsBuilderUtils
 {
 public:
@@ -120,6 +125,7 @@ private:
         const net_flow::PostProcessOpMetadataPtr &softmax_op_metadata);
     static Expected<std::vector<OutputVStream>> create_output_post_process_iou(std::shared_ptr<OutputStreamBase> output_stream,
         hailo_vstream_params_t vstream_params, const net_flow::PostProcessOpMetadataPtr &iou_op_metadata);
+    static bool is_input_zero_copy_enabled();
 };
 
 } /* namespace hailort */
@@ -188,8 +188,11 @@ private:
         std::shared_ptr<PipelineElement> pipeline_entry, std::vector<std::shared_ptr<PipelineElement>> &&pipeline,
         std::shared_ptr<std::atomic<hailo_status>> &&pipeline_status, AccumulatorPtr pipeline_latency_accumulator,
         EventPtr core_op_activated_event, hailo_status &output_status);
+    hailo_status write_contiguous(const hailo_pix_buffer_t &buffer);
 
     bool m_is_multi_planar;
+    // Whether the pipeline's entry transforms the planes of a frame without concatenating them
+    bool m_is_planes_transform;
 };
 
 class OutputVStreamImpl : public OutputVStreamInternal
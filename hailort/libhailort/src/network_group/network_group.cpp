@@ -212,7 +212,13 @@ Expected<HwInferResults> ConfiguredNetworkGroupBase::run_hw_infer_estimator()
 
 Expected<LatencyMeasurementResult> ConfiguredNetworkGroupBase::get_latency_measurement(const std::string &network_name)
 {
-    return get_core_op()->get_latency_measurement(network_name);
+    TRY(const auto latency_result, get_core_op()->get_latency_measurement_ext(network_name));
+    return LatencyMeasurementResult{latency_result.avg_hw_latency};
+}
+
+Expected<LatencyMeasurementResultExt> ConfiguredNetworkGroupBase::get_latency_measurement_ext(const std::string &network_name)
+{
+    return get_core_op()->get_latency_measurement_ext(network_name);
 }
 
 Expected<OutputStreamWithParamsVector> ConfiguredNetworkGroupBase::get_output_streams_from_vstream_names(
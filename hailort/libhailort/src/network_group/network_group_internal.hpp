@@ -87,6 +87,7 @@ public:
     virtual Expected<OutputStreamWithParamsVector> get_output_streams_from_vstream_names(
         const std::map<std::string, hailo_vstream_params_t> &outputs_params) override;
     virtual Expected<LatencyMeasurementResult> get_latency_measurement(const std::string &network_name="") override;
+    virtual Expected<LatencyMeasurementResultExt> get_latency_measurement_ext(const std::string &network_name="") override;
 
     virtual Expected<std::map<std::string, hailo_vstream_params_t>> make_input_vstream_params(
         bool unused, hailo_format_type_t format_type, uint32_t timeout_ms, uint32_t queue_size,
@@ -264,6 +265,7 @@ public:
         const std::map<std::string, hailo_vstream_params_t> &outputs_params) override;
 
     virtual Expected<LatencyMeasurementResult> get_latency_measurement(const std::string &network_name="") override;
+    virtual Expected<LatencyMeasurementResultExt> get_latency_measurement_ext(const std::string &network_name="") override;
     virtual Expected<std::unique_ptr<ActivatedNetworkGroup>> activate(const hailo_activate_network_group_params_t &network_group_params) override;
     virtual hailo_status wait_for_activation(const std::chrono::milliseconds &timeout) override;
     virtual hailo_status shutdown() override;
@@ -1213,7 +1213,7 @@ hailo_status HailoRtRpcClient::ConfiguredNetworkGroup_set_scheduler_priority(con
     return static_cast<hailo_status>(reply.status());
 }
 
-Expected<LatencyMeasurementResult> HailoRtRpcClient::ConfiguredNetworkGroup_get_latency_measurement(const NetworkGroupIdentifier &identifier,
+Expected<LatencyMeasurementResultExt> HailoRtRpcClient::ConfiguredNetworkGroup_get_latency_measurement(const NetworkGroupIdentifier &identifier,
     const std::string &network_name)
 {
     ConfiguredNetworkGroup_get_latency_measurement_Request request;
@@ -1229,8 +1229,13 @@ Expected<LatencyMeasurementResult> HailoRtRpcClient::ConfiguredNetworkGroup_get_
         return make_unexpected(HAILO_NOT_AVAILABLE);
     }
     CHECK_SUCCESS_AS_EXPECTED(static_cast<hailo_status>(reply.status()));
-    LatencyMeasurementResult result{
-        std::chrono::nanoseconds(reply.avg_hw_latency())
+    LatencyMeasurementResultExt result{
+        std::chrono::nanoseconds(reply.avg_hw_latency()),
+        std::chrono::nanoseconds(reply.p50_hw_latency()),
+        std::chrono::nanoseconds(reply.p95_hw_latency()),
+        std::chrono::nanoseconds(reply.p99_hw_latency()),
+        std::chrono::nanoseconds(reply.max_hw_latency()),
+        reply.measured_frames_count()
     };
     return result;
 }
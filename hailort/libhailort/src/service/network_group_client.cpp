@@ -132,6 +132,12 @@ Expected<std::unique_ptr<ActivatedNetworkGroup>> ConfiguredNetworkGroupClient::a
 
 /* Network group base functions */
 Expected<LatencyMeasurementResult> ConfiguredNetworkGroupClient::get_latency_measurement(const std::string &network_name)
+{
+    TRY(const auto latency_result, m_client->ConfiguredNetworkGroup_get_latency_measurement(m_identifier, network_name));
+    return LatencyMeasurementResult{latency_result.avg_hw_latency};
+}
+
+Expected<LatencyMeasurementResultExt> ConfiguredNetworkGroupClient::get_latency_measurement_ext(const std::string &network_name)
 {
     return m_client->ConfiguredNetworkGroup_get_latency_measurement(m_identifier, network_name);
 }
@@ -0,0 +1,405 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file preprocess.cpp
+ * @brief Host pre-processing - resize, letterbox/crop and normalize of user frames into the model's input shape
+ *
+ * The resize is a separable bilinear interpolation in fixed point. Every source row is resized horizontally at most once
+ * per frame (the two last rows are cached), and the vertical blend writes the final pixels - including the letterbox
+ * padding and the normalization - straight into the pre-infer buffer, so the frame is traversed once.
+ * The inner loops are kept branch free over contiguous int32 data so the compiler can vectorize them.
+ **/
+
+#include "transform/preprocess.hpp"
+#include "hailo/hailort_common.hpp"
+
+#include "common/utils.hpp"
+#include "common/logger_macros.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+
+namespace hailort
+{
+
+static constexpr uint32_t WEIGHT_PRECISION_BITS = 11;
+static constexpr int32_t WEIGHT_ONE = (1 << WEIGHT_PRECISION_BITS);
+// Horizontal and vertical weights are multiplied, so the blended value has twice the precision bits
+static constexpr uint32_t BLEND_PRECISION_BITS = (2 * WEIGHT_PRECISION_BITS);
+static constexpr int32_t BLEND_ROUNDING = (1 << (BLEND_PRECISION_BITS - 1));
+static constexpr float32_t BLEND_TO_FLOAT = 1.0f / static_cast<float32_t>(1 << BLEND_PRECISION_BITS);
+static constexpr uint32_t INVALID_ROW_INDEX = std::numeric_limits<uint32_t>::max();
+static constexpr uint32_t RGB_CHANNELS = 3;
+static const hailo_rectangle_t FULL_FRAME_ROI = { 0.0f, 0.0f, 1.0f, 1.0f };
+
+static inline uint8_t clip_to_uint8(int32_t value)
+{
+    return static_cast<uint8_t>(std::min(std::max(value, 0), 255));
+}
+
+bool PreProcessContext::is_enabled(const hailo_preprocess_params_t &params)
+{
+    return (HAILO_RESIZE_MODE_NONE != params.resize_mode);
+}
+
+hailo_status PreProcessContext::validate(const hailo_preprocess_params_t &params, const hailo_3d_image_shape_t &dst_image_shape)
+{
+    CHECK((HAILO_RESIZE_MODE_STRETCH == params.resize_mode) || (HAILO_RESIZE_MODE_LETTERBOX == params.resize_mode) ||
+        (HAILO_RESIZE_MODE_CROP == params.resize_mode), HAILO_INVALID_ARGUMENT,
+        "Invalid pre-process resize mode {}", static_cast<int>(params.resize_mode));
+    CHECK((params.src_width >= 2) && (params.src_height >= 2), HAILO_INVALID_ARGUMENT,
+        "Pre-process source frame must be at least 2x2, got {}x{}", params.src_width, params.src_height);
+    CHECK((dst_image_shape.width > 0) && (dst_image_shape.height > 0) && (dst_image_shape.features > 0) &&
+        (dst_image_shape.features <= HAILO_PREPROCESS_MAX_CHANNELS), HAILO_INVALID_ARGUMENT,
+        "Pre-process is not supported for input shape {}x{}x{}", dst_image_shape.height, dst_image_shape.width,
+        dst_image_shape.features);
+
+    switch (params.src_order) {
+    case HAILO_FORMAT_ORDER_NHWC:
+        break;
+    case HAILO_FORMAT_ORDER_NV12:
+        CHECK(RGB_CHANNELS == dst_image_shape.features, HAILO_INVALID_ARGUMENT,
+            "NV12 pre-process requires an RGB input, got {} features", dst_image_shape.features);
+        CHECK((0 == (params.src_width % 2)) && (0 == (params.src_height % 2)), HAILO_INVALID_ARGUMENT,
+            "NV12 source frame dimensions must be even, got {}x{}", params.src_width, params.src_height);
+        break;
+    default:
+        LOGGER__ERROR("Pre-process source order {} is not supported", HailoRTCommon::get_format_order_str(params.src_order));
+        return HAILO_INVALID_ARGUMENT;
+    }
+
+    if (params.normalize) {
+        for (uint32_t c = 0; c < dst_image_shape.features; c++) {
+            CHECK(0.0f != params.std[c], HAILO_INVALID_ARGUMENT, "Pre-process normalization std of channel {} is 0", c);
+        }
+    }
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status PreProcessContext::validate_roi(const hailo_preprocess_params_t &params, const hailo_rectangle_t &roi)
+{
+    CHECK((roi.x_min >= 0.0f) && (roi.y_min >= 0.0f) && (roi.x_max <= 1.0f) && (roi.y_max <= 1.0f) &&
+        (roi.x_min < roi.x_max) && (roi.y_min < roi.y_max), HAILO_INVALID_ARGUMENT,
+        "Invalid pre-process ROI (x_min={}, y_min={}, x_max={}, y_max={})", roi.x_min, roi.y_min, roi.x_max, roi.y_max);
+
+    // The ROI has to cover at least a single source pixel in each dimension
+    const auto roi_width = (roi.x_max - roi.x_min) * static_cast<float32_t>(params.src_width);
+    const auto roi_height = (roi.y_max - roi.y_min) * static_cast<float32_t>(params.src_height);
+    CHECK((roi_width >= 1.0f) && (roi_height >= 1.0f), HAILO_INVALID_ARGUMENT,
+        "Pre-process ROI is smaller than a single source pixel ({}x{})", roi_width, roi_height);
+
+    return HAILO_SUCCESS;
+}
+
+PreProcessContext::ResizeGeometry PreProcessContext::calc_geometry(const hailo_preprocess_params_t &params,
+    const hailo_3d_image_shape_t &dst_image_shape, const hailo_rectangle_t &roi)
+{
+    const auto roi_x = roi.x_min * static_cast<float32_t>(params.src_width);
+    const auto roi_y = roi.y_min * static_cast<float32_t>(params.src_height);
+    const auto src_width = (roi.x_max - roi.x_min) * static_cast<float32_t>(params.src_width);
+    const auto src_height = (roi.y_max - roi.y_min) * static_cast<float32_t>(params.src_height);
+    const auto dst_width = static_cast<float32_t>(dst_image_shape.width);
+    const auto dst_height = static_cast<float32_t>(dst_image_shape.height);
+
+    ResizeGeometry geometry = { roi_x, roi_y, src_width, src_height, 0, 0, dst_image_shape.width, dst_image_shape.height };
+    switch (params.resize_mode) {
+    case HAILO_RESIZE_MODE_LETTERBOX:
+    {
+        const auto scale = std::min(dst_width / src_width, dst_height / src_height);
+        geometry.dst_width = std::min(std::max(static_cast<uint32_t>(std::lround(src_width * scale)), 1u), dst_image_shape.width);
+        geometry.dst_height = std::min(std::max(static_cast<uint32_t>(std::lround(src_height * scale)), 1u), dst_image_shape.height);
+        geometry.dst_x = (dst_image_shape.width - geometry.dst_width) / 2;
+        geometry.dst_y = (dst_image_shape.height - geometry.dst_height) / 2;
+        break;
+    }
+    case HAILO_RESIZE_MODE_CROP:
+    {
+        const auto scale = std::max(dst_width / src_width, dst_height / src_height);
+        geometry.src_width = dst_width / scale;
+        geometry.src_height = dst_height / scale;
+        geometry.src_x = roi_x + ((src_width - geometry.src_width) / 2);
+        geometry.src_y = roi_y + ((src_height - geometry.src_height) / 2);
+        break;
+    }
+    default:
+        break;
+    }
+
+    return geometry;
+}
+
+Expected<hailo_preprocess_transform_info_t> PreProcessContext::get_transform_info(const hailo_preprocess_params_t &params,
+    const hailo_3d_image_shape_t &dst_image_shape)
+{
+    return get_transform_info(params, dst_image_shape, FULL_FRAME_ROI);
+}
+
+Expected<hailo_preprocess_transform_info_t> PreProcessContext::get_transform_info(const hailo_preprocess_params_t &params,
+    const hailo_3d_image_shape_t &dst_image_shape, const hailo_rectangle_t &roi)
+{
+    CHECK_SUCCESS_AS_EXPECTED(validate(params, dst_image_shape));
+    CHECK_SUCCESS_AS_EXPECTED(validate_roi(params, roi));
+
+    return calc_transform_info(calc_geometry(params, dst_image_shape, roi));
+}
+
+hailo_preprocess_transform_info_t PreProcessContext::calc_transform_info(const ResizeGeometry &geometry)
+{
+    hailo_preprocess_transform_info_t transform_info{};
+    transform_info.scale_x = static_cast<float32_t>(geometry.dst_width) / geometry.src_width;
+    transform_info.scale_y = static_cast<float32_t>(geometry.dst_height) / geometry.src_height;
+    transform_info.offset_x = static_cast<float32_t>(geometry.dst_x) - (geometry.src_x * transform_info.scale_x);
+    transform_info.offset_y = static_cast<float32_t>(geometry.dst_y) - (geometry.src_y * transform_info.scale_y);
+    return transform_info;
+}
+
+size_t PreProcessContext::get_src_frame_size(const hailo_preprocess_params_t &params, const hailo_3d_image_shape_t &dst_image_shape)
+{
+    const auto pixels_count = static_cast<size_t>(params.src_width) * params.src_height;
+    if (HAILO_FORMAT_ORDER_NV12 == params.src_order) {
+        // Full resolution Y plane followed by an interleaved, 2x2 subsampled UV plane
+        return pixels_count + (pixels_count / 2);
+    }
+    return pixels_count * dst_image_shape.features;
+}
+
+hailo_format_t PreProcessContext::get_dst_format(const hailo_preprocess_params_t &params)
+{
+    hailo_format_t format{};
+    format.type = params.normalize ? HAILO_FORMAT_TYPE_FLOAT32 : HAILO_FORMAT_TYPE_UINT8;
+    format.order = HAILO_FORMAT_ORDER_NHWC;
+    format.flags = HAILO_FORMAT_FLAGS_NONE;
+    return format;
+}
+
+void PreProcessContext::calc_interpolation_table(float32_t src_start, float32_t src_length, uint32_t src_size, uint32_t dst_size,
+    std::vector<uint32_t> &indices, std::vector<int32_t> &weights)
+{
+    indices.resize(dst_size);
+    weights.resize(dst_size);
+
+    // Pixel centers are aligned, and every destination pixel blends source pixels [index] and [index + 1]
+    const auto ratio = src_length / static_cast<float32_t>(dst_size);
+    const auto max_position = static_cast<float32_t>(src_size - 1);
+    for (uint32_t i = 0; i < dst_size; i++) {
+        auto position = src_start + ((static_cast<float32_t>(i) + 0.5f) * ratio) - 0.5f;
+        position = std::min(std::max(position, 0.0f), max_position);
+        auto index = std::min(static_cast<uint32_t>(position), src_size - 2);
+        indices[i] = index;
+        weights[i] = static_cast<int32_t>(std::lround((position - static_cast<float32_t>(index)) * WEIGHT_ONE));
+    }
+}
+
+Expected<std::unique_ptr<PreProcessContext>> PreProcessContext::create(const hailo_preprocess_params_t &params,
+    const hailo_3d_image_shape_t &dst_image_shape)
+{
+    CHECK_SUCCESS_AS_EXPECTED(validate(params, dst_image_shape));
+
+    auto context = make_unique_nothrow<PreProcessContext>(params, dst_image_shape);
+    CHECK_NOT_NULL_AS_EXPECTED(context, HAILO_OUT_OF_HOST_MEMORY);
+
+    return context;
+}
+
+PreProcessContext::PreProcessContext(const hailo_preprocess_params_t &params, const hailo_3d_image_shape_t &dst_image_shape) :
+    m_params(params),
+    m_dst_image_shape(dst_image_shape),
+    m_channels(dst_image_shape.features),
+    m_geometry(),
+    m_transform_info(),
+    m_src_columns_begin(0),
+    m_src_columns_end(0),
+    m_resized_rows_index{INVALID_ROW_INDEX, INVALID_ROW_INDEX}
+{
+    set_geometry(calc_geometry(params, dst_image_shape, FULL_FRAME_ROI));
+
+    // Sized for the whole destination width, so the ROI can be replaced without reallocating
+    for (auto &row : m_resized_rows) {
+        row.resize(static_cast<size_t>(dst_image_shape.width) * m_channels);
+    }
+    if (HAILO_FORMAT_ORDER_NV12 == params.src_order) {
+        m_rgb_row.resize(static_cast<size_t>(params.src_width) * RGB_CHANNELS);
+    }
+
+    for (uint32_t c = 0; c < HAILO_PREPROCESS_MAX_CHANNELS; c++) {
+        m_inv_std[c] = params.normalize ? (1.0f / params.std[c]) : 1.0f;
+        m_padding_value[c] = params.normalize ?
+            ((static_cast<float32_t>(params.padding_value[c]) - params.mean[c]) * m_inv_std[c]) :
+            static_cast<float32_t>(params.padding_value[c]);
+    }
+}
+
+void PreProcessContext::set_geometry(const ResizeGeometry &geometry)
+{
+    m_geometry = geometry;
+    m_transform_info = calc_transform_info(m_geometry);
+
+    calc_interpolation_table(m_geometry.src_x, m_geometry.src_width, m_params.src_width, m_geometry.dst_width, m_x_indices, m_x_weights);
+    calc_interpolation_table(m_geometry.src_y, m_geometry.src_height, m_params.src_height, m_geometry.dst_height, m_y_indices, m_y_weights);
+
+    // Indices are monotonic, and every destination pixel blends source pixels [index] and [index + 1]
+    m_src_columns_begin = m_x_indices.front();
+    m_src_columns_end = m_x_indices.back() + 2;
+}
+
+hailo_status PreProcessContext::set_roi(const hailo_rectangle_t &roi)
+{
+    CHECK_SUCCESS(validate_roi(m_params, roi));
+    set_geometry(calc_geometry(m_params, m_dst_image_shape, roi));
+    return HAILO_SUCCESS;
+}
+
+size_t PreProcessContext::src_frame_size() const
+{
+    return get_src_frame_size(m_params, m_dst_image_shape);
+}
+
+size_t PreProcessContext::dst_frame_size() const
+{
+    return HailoRTCommon::get_frame_size(m_dst_image_shape, get_dst_format(m_params));
+}
+
+std::string PreProcessContext::description() const
+{
+    static const char *RESIZE_MODE_STR[] = { "NONE", "STRETCH", "LETTERBOX", "CROP" };
+
+    std::stringstream description;
+    description << "PreProcess - " << RESIZE_MODE_STR[m_params.resize_mode] << " src " << m_params.src_width << "x" <<
+        m_params.src_height << " " << HailoRTCommon::get_format_order_str(m_params.src_order) << " -> dst " <<
+        m_dst_image_shape.width << "x" << m_dst_image_shape.height << "x" << m_dst_image_shape.features << " " <<
+        HailoRTCommon::get_format_type_str(get_dst_format(m_params).type);
+    return description.str();
+}
+
+const uint8_t *PreProcessContext::get_src_row(const uint8_t *src, uint32_t row)
+{
+    const auto width = m_params.src_width;
+    if (HAILO_FORMAT_ORDER_NV12 != m_params.src_order) {
+        return src + (static_cast<size_t>(row) * width * m_channels);
+    }
+
+    // NV12 -> RGB (BT.601 limited range), UV is shared by each 2x2 block
+    const uint8_t *y_plane = src + (static_cast<size_t>(row) * width);
+    const uint8_t *uv_plane = src + (static_cast<size_t>(width) * m_params.src_height) + (static_cast<size_t>(row / 2) * width);
+    uint8_t *rgb = m_rgb_row.data();
+    // Only the columns sampled by the horizontal resize are converted
+    for (uint32_t x = m_src_columns_begin; x < m_src_columns_end; x++) {
+        const int32_t c = (static_cast<int32_t>(y_plane[x]) - 16) * 298;
+        const int32_t d = static_cast<int32_t>(uv_plane[x & ~1u]) - 128;
+        const int32_t e = static_cast<int32_t>(uv_plane[x | 1u]) - 128;
+        rgb[(x * RGB_CHANNELS) + 0] = clip_to_uint8((c + (409 * e) + 128) >> 8);
+        rgb[(x * RGB_CHANNELS) + 1] = clip_to_uint8((c - (100 * d) - (208 * e) + 128) >> 8);
+        rgb[(x * RGB_CHANNELS) + 2] = clip_to_uint8((c + (516 * d) + 128) >> 8);
+    }
+    return rgb;
+}
+
+const int32_t *PreProcessContext::get_horizontally_resized_row(const uint8_t *src, uint32_t row)
+{
+    for (size_t i = 0; i < ARRAY_ENTRIES(m_resized_rows_index); i++) {
+        if (row == m_resized_rows_index[i]) {
+            return m_resized_rows[i].data();
+        }
+    }
+
+    // Rows are consumed in increasing order, so the row with the lower index won't be needed anymore
+    const size_t slot = ((INVALID_ROW_INDEX == m_resized_rows_index[0]) ||
+        ((INVALID_ROW_INDEX != m_resized_rows_index[1]) && (m_resized_rows_index[0] < m_resized_rows_index[1]))) ? 0 : 1;
+    m_resized_rows_index[slot] = row;
+
+    const uint8_t *src_row = get_src_row(src, row);
+    int32_t *resized_row = m_resized_rows[slot].data();
+    const auto channels = m_channels;
+    for (uint32_t x = 0; x < m_geometry.dst_width; x++) {
+        const uint8_t *left = src_row + (static_cast<size_t>(m_x_indices[x]) * channels);
+        const int32_t right_weight = m_x_weights[x];
+        const int32_t left_weight = WEIGHT_ONE - right_weight;
+        for (uint32_t c = 0; c < channels; c++) {
+            resized_row[(x * channels) + c] = (left[c] * left_weight) + (left[channels + c] * right_weight);
+        }
+    }
+    return resized_row;
+}
+
+template<typename T>
+void PreProcessContext::fill_padding(T *dst_row, uint32_t pixels_count)
+{
+    for (uint32_t x = 0; x < pixels_count; x++) {
+        for (uint32_t c = 0; c < m_channels; c++) {
+            dst_row[(x * m_channels) + c] = static_cast<T>(m_padding_value[c]);
+        }
+    }
+}
+
+void PreProcessContext::write_row(const int32_t *top, const int32_t *bottom, int32_t weight, uint8_t *dst_row)
+{
+    const int32_t top_weight = WEIGHT_ONE - weight;
+    const size_t values_count = static_cast<size_t>(m_geometry.dst_width) * m_channels;
+    for (size_t i = 0; i < values_count; i++) {
+        dst_row[i] = static_cast<uint8_t>(((top[i] * top_weight) + (bottom[i] * weight) + BLEND_ROUNDING) >> BLEND_PRECISION_BITS);
+    }
+}
+
+void PreProcessContext::write_row(const int32_t *top, const int32_t *bottom, int32_t weight, float32_t *dst_row)
+{
+    // Float frames are produced only when normalizing
+    const int32_t top_weight = WEIGHT_ONE - weight;
+    for (uint32_t x = 0; x < m_geometry.dst_width; x++) {
+        for (uint32_t c = 0; c < m_channels; c++) {
+            const auto i = (x * m_channels) + c;
+            const auto value = static_cast<float32_t>((top[i] * top_weight) + (bottom[i] * weight)) * BLEND_TO_FLOAT;
+            dst_row[i] = (value - m_params.mean[c]) * m_inv_std[c];
+        }
+    }
+}
+
+template<typename T>
+hailo_status PreProcessContext::run_impl(const uint8_t *src, T *dst)
+{
+    // Cached rows belong to the previous frame
+    m_resized_rows_index[0] = INVALID_ROW_INDEX;
+    m_resized_rows_index[1] = INVALID_ROW_INDEX;
+
+    const auto &geometry = m_geometry;
+    const size_t dst_row_size = static_cast<size_t>(m_dst_image_shape.width) * m_channels;
+    const auto right_padding = m_dst_image_shape.width - geometry.dst_x - geometry.dst_width;
+    for (uint32_t y = 0; y < m_dst_image_shape.height; y++) {
+        T *dst_row = dst + (y * dst_row_size);
+        if ((y < geometry.dst_y) || (y >= (geometry.dst_y + geometry.dst_height))) {
+            fill_padding(dst_row, m_dst_image_shape.width);
+            continue;
+        }
+
+        const auto resized_y = y - geometry.dst_y;
+        const auto src_y = m_y_indices[resized_y];
+        const int32_t *top = get_horizontally_resized_row(src, src_y);
+        const int32_t *bottom = get_horizontally_resized_row(src, src_y + 1);
+
+        fill_padding(dst_row, geometry.dst_x);
+        write_row(top, bottom, m_y_weights[resized_y], dst_row + (static_cast<size_t>(geometry.dst_x) * m_channels));
+        fill_padding(dst_row + (static_cast<size_t>(geometry.dst_x + geometry.dst_width) * m_channels), right_padding);
+    }
+
+    return HAILO_SUCCESS;
+}
+
+hailo_status PreProcessContext::run(const MemoryView src, MemoryView dst)
+{
+    CHECK(src.size() == src_frame_size(), HAILO_INVALID_ARGUMENT,
+        "Pre-process src buffer size {} is different than the expected {}", src.size(), src_frame_size());
+    CHECK(dst.size() == dst_frame_size(), HAILO_INVALID_ARGUMENT,
+        "Pre-process dst buffer size {} is different than the expected {}", dst.size(), dst_frame_size());
+
+    if (m_params.normalize) {
+        return run_impl(src.data(), reinterpret_cast<float32_t*>(dst.data()));
+    }
+    return run_impl(src.data(), dst.data());
+}
+
+} /* namespace hailort */
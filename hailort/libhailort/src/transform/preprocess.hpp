@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file preprocess.hpp
+ * @brief Host pre-processing - resize, letterbox/crop and normalize of user frames into the model's input shape
+ **/
+
+#ifndef _HAILO_PREPROCESS_HPP_
+#define _HAILO_PREPROCESS_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+#include "hailo/buffer.hpp"
+
+#include <vector>
+#include <memory>
+#include <string>
+
+
+namespace hailort
+{
+
+class PreProcessContext final
+{
+public:
+    static bool is_enabled(const hailo_preprocess_params_t &params);
+
+    static Expected<std::unique_ptr<PreProcessContext>> create(const hailo_preprocess_params_t &params,
+        const hailo_3d_image_shape_t &dst_image_shape);
+
+    static hailo_status validate(const hailo_preprocess_params_t &params, const hailo_3d_image_shape_t &dst_image_shape);
+    static Expected<hailo_preprocess_transform_info_t> get_transform_info(const hailo_preprocess_params_t &params,
+        const hailo_3d_image_shape_t &dst_image_shape);
+    // Transform info of a region of interest, given in normalized [0, 1] coordinates of the source frame
+    static Expected<hailo_preprocess_transform_info_t> get_transform_info(const hailo_preprocess_params_t &params,
+        const hailo_3d_image_shape_t &dst_image_shape, const hailo_rectangle_t &roi);
+    static hailo_status validate_roi(const hailo_preprocess_params_t &params, const hailo_rectangle_t &roi);
+    // Size of the user frame, before pre-processing
+    static size_t get_src_frame_size(const hailo_preprocess_params_t &params, const hailo_3d_image_shape_t &dst_image_shape);
+    // Format of the pre-processed frame, which is the src format of the input transformation
+    static hailo_format_t get_dst_format(const hailo_preprocess_params_t &params);
+
+    PreProcessContext(const hailo_preprocess_params_t &params, const hailo_3d_image_shape_t &dst_image_shape);
+
+    hailo_status run(const MemoryView src, MemoryView dst);
+    // Restricts the following runs to a region of interest of the source frame (the resize mode applies to the ROI)
+    hailo_status set_roi(const hailo_rectangle_t &roi);
+
+    const hailo_preprocess_transform_info_t &transform_info() const { return m_transform_info; }
+    size_t src_frame_size() const;
+    size_t dst_frame_size() const;
+    std::string description() const;
+
+private:
+    struct ResizeGeometry {
+        // Source window being resized (the whole frame, unless cropping)
+        float32_t src_x;
+        float32_t src_y;
+        float32_t src_width;
+        float32_t src_height;
+        // Destination rectangle the window is resized into (the whole frame, unless letterboxing)
+        uint32_t dst_x;
+        uint32_t dst_y;
+        uint32_t dst_width;
+        uint32_t dst_height;
+    };
+
+    static ResizeGeometry calc_geometry(const hailo_preprocess_params_t &params, const hailo_3d_image_shape_t &dst_image_shape,
+        const hailo_rectangle_t &roi);
+    static hailo_preprocess_transform_info_t calc_transform_info(const ResizeGeometry &geometry);
+    void set_geometry(const ResizeGeometry &geometry);
+    static void calc_interpolation_table(float32_t src_start, float32_t src_length, uint32_t src_size, uint32_t dst_size,
+        std::vector<uint32_t> &indices, std::vector<int32_t> &weights);
+
+    const uint8_t *get_src_row(const uint8_t *src, uint32_t row);
+    const int32_t *get_horizontally_resized_row(const uint8_t *src, uint32_t row);
+
+    template<typename T>
+    void fill_padding(T *dst_row, uint32_t pixels_count);
+    void write_row(const int32_t *top, const int32_t *bottom, int32_t weight, uint8_t *dst_row);
+    void write_row(const int32_t *top, const int32_t *bottom, int32_t weight, float32_t *dst_row);
+    template<typename T>
+    hailo_status run_impl(const uint8_t *src, T *dst);
+
+    const hailo_preprocess_params_t m_params;
+    const hailo_3d_image_shape_t m_dst_image_shape;
+    const uint32_t m_channels;
+    ResizeGeometry m_geometry;
+    hailo_preprocess_transform_info_t m_transform_info;
+
+    // Per destination column/row - the first source pixel index and the fixed point weight of the following one
+    std::vector<uint32_t> m_x_indices;
+    std::vector<int32_t> m_x_weights;
+    std::vector<uint32_t> m_y_indices;
+    std::vector<int32_t> m_y_weights;
+    // Range of source columns used by the current geometry
+    uint32_t m_src_columns_begin;
+    uint32_t m_src_columns_end;
+
+    // The two most recent horizontally resized source rows, reused by consecutive destination rows
+    std::vector<int32_t> m_resized_rows[2];
+    uint32_t m_resized_rows_index[2];
+
+    // Scratch row for sources which aren't interleaved RGB (NV12)
+    std::vector<uint8_t> m_rgb_row;
+
+    float32_t m_inv_std[HAILO_PREPROCESS_MAX_CHANNELS];
+    float32_t m_padding_value[HAILO_PREPROCESS_MAX_CHANNELS];
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_PREPROCESS_HPP_ */
@@ -36,8 +36,8 @@ Expected<bool> TransformContextUtils::should_quantize_by_type(const hailo_stream
     const hailo_format_type_t &src_format_type, const hailo_format_type_t &dst_format_type)
 {
     if (HAILO_H2D_STREAM == stream_direction) {
-        CHECK_AS_EXPECTED(HAILO_FORMAT_TYPE_FLOAT32 != dst_format_type, HAILO_INVALID_ARGUMENT,
-            "dst type cant be {} on input quantization", HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_FLOAT32));
+        CHECK_AS_EXPECTED(!HailoRTCommon::is_float_format_type(dst_format_type), HAILO_INVALID_ARGUMENT,
+            "dst type cant be {} on input quantization", HailoRTCommon::get_format_type_str(dst_format_type));
         CHECK_AS_EXPECTED(!((HAILO_FORMAT_TYPE_UINT8 == dst_format_type) && (HAILO_FORMAT_TYPE_UINT16 == src_format_type)),
             HAILO_INVALID_ARGUMENT, "src type is {}, while the model compiled for type {}. Input quantization is impossible with this src type.",
             HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_UINT16), HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_UINT8));
@@ -48,8 +48,8 @@ Expected<bool> TransformContextUtils::should_quantize_by_type(const hailo_stream
         }
         return ((src_format_type != HAILO_FORMAT_TYPE_AUTO) && (dst_format_type != src_format_type));
     } else {
-        CHECK_AS_EXPECTED(HAILO_FORMAT_TYPE_FLOAT32 != src_format_type, HAILO_INVALID_ARGUMENT,
-            "src type cant be {} on output de-quantization", HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_FLOAT32));
+        CHECK_AS_EXPECTED(!HailoRTCommon::is_float_format_type(src_format_type), HAILO_INVALID_ARGUMENT,
+            "src type cant be {} on output de-quantization", HailoRTCommon::get_format_type_str(src_format_type));
         CHECK_AS_EXPECTED(!((HAILO_FORMAT_TYPE_UINT8 == dst_format_type) && (HAILO_FORMAT_TYPE_UINT16 == src_format_type)),
             HAILO_INVALID_ARGUMENT, "The model compiled for type {}, while the dst type is {}. Output de-quantization is impossible to this dst type",
             HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_UINT16), HailoRTCommon::get_format_type_str(HAILO_FORMAT_TYPE_UINT8));
@@ -312,10 +312,12 @@ void transform__d2h_NHWC_to_NHWC(const T *src_ptr, hailo_3d_image_shape_t *src_i
 }
 
 template<typename T>
-void transform__h2d_NV12_to_NV12(const T *src_ptr, hailo_3d_image_shape_t *src_image_shape, T *dst_ptr, hailo_3d_image_shape_t *dst_image_shape)
+void transform__h2d_NV12_to_NV12(const T *src_y_ptr, const T *src_uv_ptr, hailo_3d_image_shape_t *src_image_shape, T *dst_ptr,
+    hailo_3d_image_shape_t *dst_image_shape)
 {
     /* Validate arguments */
-    ASSERT(NULL != src_ptr);
+    ASSERT(NULL != src_y_ptr);
+    ASSERT(NULL != src_uv_ptr);
     ASSERT(NULL != dst_ptr);
     uint32_t rows_count = src_image_shape->height * src_image_shape->features;
     ASSERT(0 == fmod(rows_count, 1.5));
@@ -324,34 +326,50 @@ void transform__h2d_NV12_to_NV12(const T *src_ptr, hailo_3d_image_shape_t *src_i
     auto row_leftover = dst_image_shape->width - src_image_shape->width;
 
     size_t src_offset_y = 0;
-    size_t src_offset_uv = ((static_cast<uint32_t>(rows_count / 1.5)) * src_image_shape->width);
+    size_t src_offset_uv = 0;
     size_t dst_offset = 0;
 
     for(uint32_t h = 0; h < (static_cast<uint32_t>(rows_count / 1.5)); h += 2) {
         /* Copy 2 rows of Y for each row of U,V */
         // Copy Y
         for (auto i = 0; i < 2; i++) {
-            memcpy(dst_ptr + dst_offset, src_ptr + src_offset_y, (src_image_shape->width * sizeof(T)));
+            memcpy(dst_ptr + dst_offset, src_y_ptr + src_offset_y, (src_image_shape->width * sizeof(T)));
             src_offset_y += (src_image_shape->width);
             dst_offset += (src_image_shape->width);
-            memset((dst_ptr + dst_offset), 0, (row_leftover * sizeof(T)));
-            dst_offset += row_leftover;
+            if (0 != row_leftover) {
+                memset((dst_ptr + dst_offset), 0, (row_leftover * sizeof(T)));
+                dst_offset += row_leftover;
+            }
         }
 
         // Copy U, V
-        memcpy(dst_ptr + dst_offset, (src_ptr + src_offset_uv), (src_image_shape->width * sizeof(T)));
+        memcpy(dst_ptr + dst_offset, (src_uv_ptr + src_offset_uv), (src_image_shape->width * sizeof(T)));
         src_offset_uv += src_image_shape->width;
         dst_offset += src_image_shape->width;
-        memset((dst_ptr + dst_offset), 0, (row_leftover * sizeof(T)));
-        dst_offset += row_leftover;
+        if (0 != row_leftover) {
+            memset((dst_ptr + dst_offset), 0, (row_leftover * sizeof(T)));
+            dst_offset += row_leftover;
+        }
     }
 }
 
+template<typename T>
+void transform__h2d_NV12_to_NV12(const T *src_ptr, hailo_3d_image_shape_t *src_image_shape, T *dst_ptr, hailo_3d_image_shape_t *dst_image_shape)
+{
+    // The UV plane follows the Y plane
+    const auto y_plane_rows_count = static_cast<uint32_t>((src_image_shape->height * src_image_shape->features) / 1.5);
+    transform__h2d_NV12_to_NV12<T>(src_ptr, src_ptr + (y_plane_rows_count * src_image_shape->width), src_image_shape,
+        dst_ptr, dst_image_shape);
+}
+
 template <typename T>
-void transform__h2d_I420_to_YYYYUV(const T *src_ptr, hailo_3d_image_shape_t *src_image_shape, T *dst_ptr, hailo_3d_image_shape_t *dst_image_shape)
+void transform__h2d_I420_to_YYYYUV(const T *src_y_ptr, const T *src_u_ptr, const T *src_v_ptr, hailo_3d_image_shape_t *src_image_shape,
+    T *dst_ptr, hailo_3d_image_shape_t *dst_image_shape)
 {
     /* Validate arguments */
-    ASSERT(NULL != src_ptr);
+    ASSERT(NULL != src_y_ptr);
+    ASSERT(NULL != src_u_ptr);
+    ASSERT(NULL != src_v_ptr);
     ASSERT(NULL != dst_ptr);
     uint32_t rows_count = src_image_shape->height * src_image_shape->features;
     ASSERT(0 == (rows_count % 3));
@@ -364,39 +382,56 @@ void transform__h2d_I420_to_YYYYUV(const T *src_ptr, hailo_3d_image_shape_t *src
     uint32_t y_plane_rows_count = static_cast<uint32_t>(rows_count / 1.5);
 
     size_t src_offset_y = 0;
-    size_t src_offset_u = (y_plane_rows_count * src_image_shape->width);
-    size_t src_offset_v = src_offset_u + (static_cast<uint32_t>((y_plane_rows_count / 2) * (src_image_shape->width / 2)));
+    size_t src_offset_u = 0;
+    size_t src_offset_v = 0;
     size_t dst_offset = 0;
 
     for(uint32_t h = 0; h < y_plane_rows_count; h += 2) {
         // Copy Y
         for (auto j = 0; j < 2; j++) {
-            memcpy(dst_ptr + dst_offset, src_ptr + src_offset_y, (src_image_shape->width * sizeof(T)));
+            memcpy(dst_ptr + dst_offset, src_y_ptr + src_offset_y, (src_image_shape->width * sizeof(T)));
             src_offset_y += (src_image_shape->width);
             dst_offset += (src_image_shape->width);
             // add padding
-            memset((dst_ptr + dst_offset), 0, (padding_size_y * sizeof(T)));
-            dst_offset += padding_size_y;
+            if (0 != padding_size_y) {
+                memset((dst_ptr + dst_offset), 0, (padding_size_y * sizeof(T)));
+                dst_offset += padding_size_y;
+            }
         }
 
         // Copy U/2
-        memcpy(dst_ptr + dst_offset, (src_ptr + src_offset_u), ((src_image_shape->width / 2) * sizeof(T)));
+        memcpy(dst_ptr + dst_offset, (src_u_ptr + src_offset_u), ((src_image_shape->width / 2) * sizeof(T)));
         src_offset_u += (src_image_shape->width / 2);
         dst_offset += (src_image_shape->width / 2);
         // Add padding
-        memset((dst_ptr + dst_offset), 0, (padding_size_uv * sizeof(T)));
-        dst_offset += padding_size_uv;
+        if (0 != padding_size_uv) {
+            memset((dst_ptr + dst_offset), 0, (padding_size_uv * sizeof(T)));
+            dst_offset += padding_size_uv;
+        }
 
         // Copy V/2
-        memcpy(dst_ptr + dst_offset, (src_ptr + src_offset_v), ((src_image_shape->width / 2) * sizeof(T)));
+        memcpy(dst_ptr + dst_offset, (src_v_ptr + src_offset_v), ((src_image_shape->width / 2) * sizeof(T)));
         src_offset_v += (src_image_shape->width / 2);
         dst_offset += (src_image_shape->width / 2);
         // Add padding
-        memset((dst_ptr + dst_offset), 0, (padding_size_uv * sizeof(T)));
-        dst_offset += padding_size_uv;
+        if (0 != padding_size_uv) {
+            memset((dst_ptr + dst_offset), 0, (padding_size_uv * sizeof(T)));
+            dst_offset += padding_size_uv;
+        }
     }
 }
 
+template <typename T>
+void transform__h2d_I420_to_YYYYUV(const T *src_ptr, hailo_3d_image_shape_t *src_image_shape, T *dst_ptr, hailo_3d_image_shape_t *dst_image_shape)
+{
+    // The U and V planes follow the Y plane
+    const auto y_plane_rows_count = static_cast<uint32_t>((src_image_shape->height * src_image_shape->features) / 1.5);
+    const auto y_plane_size = y_plane_rows_count * src_image_shape->width;
+    const auto u_plane_size = (y_plane_rows_count / 2) * (src_image_shape->width / 2);
+    transform__h2d_I420_to_YYYYUV<T>(src_ptr, src_ptr + y_plane_size, src_ptr + y_plane_size + u_plane_size, src_image_shape,
+        dst_ptr, dst_image_shape);
+}
+
 template<typename T>
 void transform__h2d_NHWC_to_NHCW(const T *src_ptr, hailo_3d_image_shape_t *src_image_shape,
     T *dst_ptr, hailo_3d_image_shape_t *dst_image_shape)
@@ -482,6 +517,131 @@ void transform__d2h_NHCW_to_NHWC(const T *src_ptr, hailo_3d_image_shape_t *src_i
     }
 }
 
+/* NCHW outputs are written in blocks of source pixels - the block (with all of its features) stays in the cache while
+   it is scattered into short contiguous runs, one per feature plane */
+static const uint32_t NCHW_REORDER_BLOCK_WIDTH = 64;
+
+// Elements of a single feature, along a row of the src frame
+static inline size_t get_d2h_pixel_stride(const hailo_3d_image_shape_t &src_image_shape, hailo_format_order_t src_order)
+{
+    return (HAILO_FORMAT_ORDER_NHCW == src_order) ? 1 : src_image_shape.features;
+}
+
+static inline size_t get_d2h_feature_offset(const hailo_3d_image_shape_t &src_image_shape, hailo_format_order_t src_order,
+    uint32_t feature)
+{
+    return (HAILO_FORMAT_ORDER_NHCW == src_order) ? (static_cast<size_t>(feature) * src_image_shape.width) : feature;
+}
+
+template<typename T>
+void transform__d2h_to_NCHW(const T *src_ptr, const hailo_3d_image_shape_t &src_image_shape, hailo_format_order_t src_order,
+    T *dst_ptr, const hailo_3d_image_shape_t &dst_image_shape)
+{
+    /* Validate arguments */
+    ASSERT(NULL != src_ptr);
+    ASSERT(NULL != dst_ptr);
+
+    const size_t src_row_size = static_cast<size_t>(src_image_shape.width) * src_image_shape.features;
+    const size_t dst_plane_size = static_cast<size_t>(dst_image_shape.width) * dst_image_shape.height;
+    const size_t pixel_stride = get_d2h_pixel_stride(src_image_shape, src_order);
+    for (uint32_t r = 0; r < dst_image_shape.height; r++) {
+        for (uint32_t w = 0; w < dst_image_shape.width; w += NCHW_REORDER_BLOCK_WIDTH) {
+            const uint32_t block_width = std::min(NCHW_REORDER_BLOCK_WIDTH, dst_image_shape.width - w);
+            for (uint32_t f = 0; f < dst_image_shape.features; f++) {
+                const T *src = src_ptr + (r * src_row_size) + get_d2h_feature_offset(src_image_shape, src_order, f) +
+                    (w * pixel_stride);
+                T *dst = dst_ptr + (f * dst_plane_size) + (static_cast<size_t>(r) * dst_image_shape.width) + w;
+                for (uint32_t i = 0; i < block_width; i++) {
+                    dst[i] = src[i * pixel_stride];
+                }
+            }
+        }
+    }
+}
+
+template<typename Q>
+static inline void dequantize_run(const Q *src, size_t src_stride, float32_t *dst, uint32_t count, float32_t qp_zp,
+    float32_t qp_scale)
+{
+    for (uint32_t i = 0; i < count; i++) {
+        dst[i] = Quantization::dequantize_output<float32_t, Q>(src[i * src_stride], qp_zp, qp_scale);
+    }
+}
+
+#if defined(__aarch64__)
+static inline float32x4_t dequantize_u32x4(uint32x4_t value, float32x4_t qp_zp, float32x4_t qp_scale)
+{
+    return vmulq_f32(vsubq_f32(vcvtq_f32_u32(value), qp_zp), qp_scale);
+}
+
+template<>
+inline void dequantize_run<uint8_t>(const uint8_t *src, size_t src_stride, float32_t *dst, uint32_t count, float32_t qp_zp,
+    float32_t qp_scale)
+{
+    uint32_t i = 0;
+    if (1 == src_stride) {
+        const float32x4_t zp = vdupq_n_f32(qp_zp);
+        const float32x4_t scale = vdupq_n_f32(qp_scale);
+        for (; (i + 8) <= count; i += 8) {
+            const uint16x8_t value = vmovl_u8(vld1_u8(src + i));
+            vst1q_f32(dst + i, dequantize_u32x4(vmovl_u16(vget_low_u16(value)), zp, scale));
+            vst1q_f32(dst + i + 4, dequantize_u32x4(vmovl_u16(vget_high_u16(value)), zp, scale));
+        }
+    }
+    for (; i < count; i++) {
+        dst[i] = Quantization::dequantize_output<float32_t, uint8_t>(src[i * src_stride], qp_zp, qp_scale);
+    }
+}
+
+template<>
+inline void dequantize_run<uint16_t>(const uint16_t *src, size_t src_stride, float32_t *dst, uint32_t count, float32_t qp_zp,
+    float32_t qp_scale)
+{
+    uint32_t i = 0;
+    if (1 == src_stride) {
+        const float32x4_t zp = vdupq_n_f32(qp_zp);
+        const float32x4_t scale = vdupq_n_f32(qp_scale);
+        for (; (i + 8) <= count; i += 8) {
+            const uint16x8_t value = vld1q_u16(src + i);
+            vst1q_f32(dst + i, dequantize_u32x4(vmovl_u16(vget_low_u16(value)), zp, scale));
+            vst1q_f32(dst + i + 4, dequantize_u32x4(vmovl_u16(vget_high_u16(value)), zp, scale));
+        }
+    }
+    for (; i < count; i++) {
+        dst[i] = Quantization::dequantize_output<float32_t, uint16_t>(src[i * src_stride], qp_zp, qp_scale);
+    }
+}
+#endif /* defined(__aarch64__) */
+
+// Reorders NHCW/NHWC frames into NCHW and de-quantizes them in the same pass, instead of reordering in place and
+// de-quantizing the whole frame again. @a quant_infos holds either one entry per feature, or a single entry for all of them.
+template<typename Q>
+void transform__d2h_to_NCHW_dequantize(const Q *src_ptr, const hailo_3d_image_shape_t &src_image_shape,
+    hailo_format_order_t src_order, float32_t *dst_ptr, const hailo_3d_image_shape_t &dst_image_shape,
+    const std::vector<QuantInfoForDequantize> &quant_infos)
+{
+    /* Validate arguments */
+    ASSERT(NULL != src_ptr);
+    ASSERT(NULL != dst_ptr);
+    ASSERT((1 == quant_infos.size()) || (dst_image_shape.features <= quant_infos.size()));
+
+    const size_t src_row_size = static_cast<size_t>(src_image_shape.width) * src_image_shape.features;
+    const size_t dst_plane_size = static_cast<size_t>(dst_image_shape.width) * dst_image_shape.height;
+    const size_t pixel_stride = get_d2h_pixel_stride(src_image_shape, src_order);
+    for (uint32_t r = 0; r < dst_image_shape.height; r++) {
+        for (uint32_t w = 0; w < dst_image_shape.width; w += NCHW_REORDER_BLOCK_WIDTH) {
+            const uint32_t block_width = std::min(NCHW_REORDER_BLOCK_WIDTH, dst_image_shape.width - w);
+            for (uint32_t f = 0; f < dst_image_shape.features; f++) {
+                const auto &quant_info = quant_infos[(1 == quant_infos.size()) ? 0 : f];
+                const Q *src = src_ptr + (r * src_row_size) + get_d2h_feature_offset(src_image_shape, src_order, f) +
+                    (w * pixel_stride);
+                float32_t *dst = dst_ptr + (f * dst_plane_size) + (static_cast<size_t>(r) * dst_image_shape.width) + w;
+                dequantize_run<Q>(src, pixel_stride, dst, block_width, quant_info.m_qp_zp, quant_info.m_qp_scale);
+            }
+        }
+    }
+}
+
 template<typename T>
 void transform__d2h_NHW_to_NHW(const T *src_ptr, hailo_3d_image_shape_t *src_image_shape, T *dst_ptr,
     hailo_3d_image_shape_t *dst_image_shape)
@@ -924,6 +1084,28 @@ hailo_status InputTransformContext::quantize_stream(const void *src_ptr, void *q
                 return HAILO_INVALID_OPERATION;
             }
             break;
+        case HAILO_FORMAT_TYPE_FLOAT16:
+            if (HAILO_FORMAT_TYPE_UINT8 == m_dst_format.type) {
+                Quantization::quantize_input_buffer<fp16_t, uint8_t>((fp16_t*)src_ptr, (uint8_t*)quant_buffer, shape_size, m_dst_quant_infos[0]);
+            }
+            else if (HAILO_FORMAT_TYPE_UINT16 == m_dst_format.type) {
+                Quantization::quantize_input_buffer<fp16_t, uint16_t>((fp16_t*)src_ptr, (uint16_t*)quant_buffer, shape_size, m_dst_quant_infos[0]);
+            }
+            else {
+                return HAILO_INVALID_OPERATION;
+            }
+            break;
+        case HAILO_FORMAT_TYPE_BFLOAT16:
+            if (HAILO_FORMAT_TYPE_UINT8 == m_dst_format.type) {
+                Quantization::quantize_input_buffer<bf16_t, uint8_t>((bf16_t*)src_ptr, (uint8_t*)quant_buffer, shape_size, m_dst_quant_infos[0]);
+            }
+            else if (HAILO_FORMAT_TYPE_UINT16 == m_dst_format.type) {
+                Quantization::quantize_input_buffer<bf16_t, uint16_t>((bf16_t*)src_ptr, (uint16_t*)quant_buffer, shape_size, m_dst_quant_infos[0]);
+            }
+            else {
+                return HAILO_INVALID_OPERATION;
+            }
+            break;
         default:
             LOGGER__ERROR("Invalid src-buffer's type format");
             return HAILO_INVALID_ARGUMENT;
@@ -975,6 +1157,10 @@ hailo_status FrameOutputTransformContext::quantize_stream(const void *dst_ptr)
                 }
             }
             break;
+        case HAILO_FORMAT_TYPE_FLOAT16:
+            return dequantize_stream<fp16_t>((fp16_t*)dst_ptr, shape_size);
+        case HAILO_FORMAT_TYPE_BFLOAT16:
+            return dequantize_stream<bf16_t>((bf16_t*)dst_ptr, shape_size);
         default:
             LOGGER__ERROR("Invalid dst-buffer's type format");
             return HAILO_INVALID_ARGUMENT;
@@ -983,6 +1169,53 @@ hailo_status FrameOutputTransformContext::quantize_stream(const void *dst_ptr)
     return HAILO_SUCCESS;
 }
 
+// Whether the reorder can read the planes of a multi-planar frame from separate buffers
+static bool is_planes_reorder(const hailo_format_t &src_format, const hailo_format_t &dst_format)
+{
+    return ((HAILO_FORMAT_ORDER_NV12 == src_format.order) && (HAILO_FORMAT_ORDER_HAILO_YYUV == dst_format.order)) ||
+        ((HAILO_FORMAT_ORDER_NV21 == src_format.order) && (HAILO_FORMAT_ORDER_HAILO_YYVU == dst_format.order)) ||
+        ((HAILO_FORMAT_ORDER_I420 == src_format.order) && (HAILO_FORMAT_ORDER_HAILO_YYYYUV == dst_format.order));
+}
+
+template<typename T>
+static hailo_status reorder_input_planes(const hailo_pix_buffer_t &src, hailo_3d_image_shape_t src_image_shape,
+    hailo_format_t src_format, T *dst_ptr, hailo_3d_image_shape_t dst_image_shape)
+{
+    const auto y_plane_rows_count = static_cast<uint32_t>((src_image_shape.height * src_image_shape.features) / 1.5);
+    const auto y_plane_size = y_plane_rows_count * src_image_shape.width * sizeof(T);
+    const uint32_t expected_planes_count = (HAILO_FORMAT_ORDER_I420 == src_format.order) ? 3 : 2;
+    CHECK(expected_planes_count == src.number_of_planes, HAILO_INVALID_ARGUMENT,
+        "Expected {} planes for {} frame, got {}", expected_planes_count,
+        HailoRTCommon::get_format_order_str(src_format.order), src.number_of_planes);
+    CHECK(y_plane_size == src.planes[0].bytes_used, HAILO_INVALID_ARGUMENT,
+        "Y plane size must be {}, got {}", y_plane_size, src.planes[0].bytes_used);
+
+    if (HAILO_FORMAT_ORDER_I420 == src_format.order) {
+        CHECK(src.planes[1].bytes_used == src.planes[2].bytes_used, HAILO_INVALID_ARGUMENT,
+            "U and V planes must be of the same size, got {} and {}", src.planes[1].bytes_used, src.planes[2].bytes_used);
+        transform__h2d_I420_to_YYYYUV<T>(static_cast<const T*>(src.planes[0].user_ptr), static_cast<const T*>(src.planes[1].user_ptr),
+            static_cast<const T*>(src.planes[2].user_ptr), &src_image_shape, dst_ptr, &dst_image_shape);
+    } else {
+        transform__h2d_NV12_to_NV12<T>(static_cast<const T*>(src.planes[0].user_ptr), static_cast<const T*>(src.planes[1].user_ptr),
+            &src_image_shape, dst_ptr, &dst_image_shape);
+    }
+    return HAILO_SUCCESS;
+}
+
+static hailo_status reorder_input_planes(const hailo_pix_buffer_t &src, const hailo_3d_image_shape_t &src_image_shape,
+    const hailo_format_t &src_format, void *dst_ptr, const hailo_3d_image_shape_t &dst_image_shape)
+{
+    switch (src_format.type) {
+        case HAILO_FORMAT_TYPE_UINT8:
+            return reorder_input_planes<uint8_t>(src, src_image_shape, src_format, static_cast<uint8_t*>(dst_ptr), dst_image_shape);
+        case HAILO_FORMAT_TYPE_UINT16:
+            return reorder_input_planes<uint16_t>(src, src_image_shape, src_format, static_cast<uint16_t*>(dst_ptr), dst_image_shape);
+        default:
+            LOGGER__ERROR("Invalid src-buffer's type format {}", src_format.type);
+            return HAILO_INVALID_ARGUMENT;
+    }
+}
+
 hailo_status reorder_input_stream(const void *src_ptr, hailo_3d_image_shape_t src_image_shape, hailo_format_t src_format, 
     void *dst_ptr, hailo_3d_image_shape_t dst_image_shape, hailo_format_t dst_format)
 {
@@ -1334,6 +1567,19 @@ hailo_status reorder_output_stream(const void *src_ptr, hailo_3d_image_shape_t s
                     LOGGER__ERROR("Invalid src-buffer's type format");
                     return HAILO_INVALID_ARGUMENT;
             }
+    } else if (((HAILO_FORMAT_ORDER_NHWC == src_format.order) || (HAILO_FORMAT_ORDER_FCR == src_format.order)) &&
+               (HAILO_FORMAT_ORDER_NCHW) == dst_format.order) {
+            switch (src_format.type) {
+                case HAILO_FORMAT_TYPE_UINT8:
+                    transform__d2h_to_NCHW<uint8_t>((uint8_t*)src_ptr, src_image_shape, src_format.order, (uint8_t*)dst_ptr, dst_image_shape);
+                    break;
+                case HAILO_FORMAT_TYPE_UINT16:
+                    transform__d2h_to_NCHW<uint16_t>((uint16_t*)src_ptr, src_image_shape, src_format.order, (uint16_t*)dst_ptr, dst_image_shape);
+                    break;
+                default:
+                    LOGGER__ERROR("Invalid src-buffer's type format");
+                    return HAILO_INVALID_ARGUMENT;
+            }
     } else if ((HAILO_FORMAT_ORDER_NHW == src_format.order) &&
                (HAILO_FORMAT_ORDER_NCHW) == dst_format.order) {
 
@@ -1466,6 +1712,17 @@ hailo_status FrameOutputTransformContext::transform_inner(const void *src_ptr, v
         return HAILO_SUCCESS;
     }
 
+    if (m_should_dequantize_while_reordering) {
+        if (HAILO_FORMAT_TYPE_UINT8 == m_src_format.type) {
+            transform__d2h_to_NCHW_dequantize<uint8_t>((uint8_t*)src_ptr, m_src_image_shape, m_src_format.order, (float32_t*)dst_ptr,
+                m_dst_image_shape, m_quant_info_per_feature);
+        } else {
+            transform__d2h_to_NCHW_dequantize<uint16_t>((uint16_t*)src_ptr, m_src_image_shape, m_src_format.order, (float32_t*)dst_ptr,
+                m_dst_image_shape, m_quant_info_per_feature);
+        }
+        return HAILO_SUCCESS;
+    }
+
     if (m_should_reorder) {
         if (m_should_transpose) {
             /* If user needs to reorder and transform - the output of the reorder is the transform buffer*/
@@ -1705,7 +1962,7 @@ Expected<std::unique_ptr<InputTransformContext>> InputTransformContext::create(c
     auto should_reorder = TransformContextUtils::should_reorder(src_image_shape, internal_src_format, dst_image_shape, dst_format);
     auto should_pad_periph = TransformContextUtils::should_pad_periph(dst_image_shape, dst_format);
 
-    std::unique_ptr<InputTransformContext> transform_context(new (std::nothrow) InputTransformContext(src_frame_size, src_image_shape,
+    std::unique_ptr<InputTransformContext> transform_context(new (std::nothrow) FrameInputTransformContext(src_frame_size, src_image_shape,
         internal_src_format, dst_frame_size, dst_image_shape, dst_format, dst_quant_infos, std::move(quant_buffer),
         std::move(transpose_buffer), *should_quantize, should_transpose, should_reorder, should_pad_periph));
     CHECK_AS_EXPECTED(nullptr != transform_context, HAILO_OUT_OF_HOST_MEMORY);
@@ -1767,6 +2024,24 @@ InputTransformContext::InputTransformContext(size_t src_frame_size, const hailo_
         m_transpose_buffer(std::move(transpose_buffer))
 {}
 
+FrameInputTransformContext::FrameInputTransformContext(size_t src_frame_size, const hailo_3d_image_shape_t &src_image_shape,
+    const hailo_format_t &src_format, size_t dst_frame_size, const hailo_3d_image_shape_t &dst_image_shape,
+    const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_infos, Buffer &&quant_buffer,
+    Buffer &&transpose_buffer, const bool should_quantize, const bool should_transpose, const bool should_reorder,
+    const bool should_pad_periph) :
+        InputTransformContext(src_frame_size, src_image_shape, src_format, dst_frame_size, dst_image_shape, dst_format,
+            dst_quant_infos, std::move(quant_buffer), std::move(transpose_buffer), should_quantize, should_transpose,
+            should_reorder, should_pad_periph)
+{}
+
+Expected<MemoryView> FrameInputTransformContext::planes_buffer(size_t size)
+{
+    if (m_planes_buffer.size() != size) {
+        TRY(m_planes_buffer, Buffer::create(size));
+    }
+    return MemoryView(m_planes_buffer);
+}
+
 hailo_status InputTransformContext::transform(const MemoryView src, MemoryView dst)
 {
     /* Check sizes */
@@ -1781,6 +2056,47 @@ hailo_status InputTransformContext::transform(const MemoryView src, MemoryView d
     return HAILO_SUCCESS;
 }
 
+hailo_status InputTransformContext::transform(const hailo_pix_buffer_t &src, MemoryView dst)
+{
+    CHECK(HAILO_PIX_BUFFER_MEMORY_TYPE_USERPTR == src.memory_type, HAILO_NOT_SUPPORTED,
+        "Memory type of pix buffer must be of type USERPTR!");
+    CHECK((0 < src.number_of_planes) && (src.number_of_planes <= MAX_NUMBER_OF_PLANES), HAILO_INVALID_ARGUMENT,
+        "Invalid number of planes {}", src.number_of_planes);
+    CHECK(dst.size() == m_dst_frame_size, HAILO_INVALID_ARGUMENT,
+        "dst_size must be {}. passed size - {}", m_dst_frame_size, dst.size());
+
+    size_t src_size = 0;
+    bool is_contiguous = true;
+    for (uint32_t plane_index = 0; plane_index < src.number_of_planes; plane_index++) {
+        const auto &plane = src.planes[plane_index];
+        src_size += plane.bytes_used;
+        if ((plane_index + 1) < src.number_of_planes) {
+            is_contiguous &= ((static_cast<const uint8_t*>(plane.user_ptr) + plane.bytes_used) == src.planes[plane_index + 1].user_ptr);
+        }
+    }
+    CHECK(src_size == m_src_frame_size, HAILO_INVALID_ARGUMENT,
+        "src size must be {}. passed size - {}", m_src_frame_size, src_size);
+
+    if (is_contiguous) {
+        return transform(MemoryView(src.planes[0].user_ptr, src_size), dst);
+    }
+
+    // When the planes are only repacked, each one is read straight from its own buffer
+    if (m_should_reorder && !m_should_quantize && !m_should_transpose && is_planes_reorder(m_src_format, m_dst_format)) {
+        return reorder_input_planes(src, m_src_image_shape, m_src_format, dst.data(), m_dst_image_shape);
+    }
+
+    // Otherwise, the planes are gathered into a contiguous frame first
+    TRY(auto gathered_planes, planes_buffer(src_size));
+    size_t copied_bytes = 0;
+    for (uint32_t plane_index = 0; plane_index < src.number_of_planes; plane_index++) {
+        const auto &plane = src.planes[plane_index];
+        memcpy(gathered_planes.data() + copied_bytes, plane.user_ptr, plane.bytes_used);
+        copied_bytes += plane.bytes_used;
+    }
+    return transform(gathered_planes, dst);
+}
+
 size_t InputTransformContext::get_src_frame_size() const
 {
     return m_src_frame_size;
@@ -1893,7 +2209,7 @@ FrameOutputTransformContext::FrameOutputTransformContext(size_t src_frame_size,
     const bool should_quantize, const bool should_transpose, const bool should_reorder, const bool should_pad_periph) :
         OutputTransformContext(src_frame_size, src_format, dst_frame_size, dst_format, dst_quant_infos, should_quantize, 
             should_transpose, should_reorder, should_pad_periph), m_src_image_shape(src_image_shape), m_dst_image_shape(dst_image_shape), 
-            m_transpose_buffer(std::move(transpose_buffer))
+            m_transpose_buffer(std::move(transpose_buffer)), m_should_dequantize_while_reordering(false)
 {
     // TODO: Add verification that quant infos size equals to features count (HRT-11052)
 
@@ -1912,12 +2228,18 @@ FrameOutputTransformContext::FrameOutputTransformContext(size_t src_frame_size,
     case HAILO_FORMAT_ORDER_NHW:
     case HAILO_FORMAT_ORDER_BAYER_RGB:
     case HAILO_FORMAT_ORDER_12_BIT_BAYER_RGB:
-    case HAILO_FORMAT_ORDER_NCHW:
         for (const auto &quant_info : dst_quant_infos) {
             m_quant_info_per_feature.emplace_back(quant_info.qp_zp, quant_info.qp_scale);
         }
         m_quant_infos_rep_count = static_cast<uint32_t>(dst_frame_size);
         break;
+    case HAILO_FORMAT_ORDER_NCHW:
+        for (const auto &quant_info : dst_quant_infos) {
+            m_quant_info_per_feature.emplace_back(quant_info.qp_zp, quant_info.qp_scale);
+        }
+        // Each feature is a whole plane
+        m_quant_infos_rep_count = dst_image_shape.width * dst_image_shape.height;
+        break;
     case HAILO_FORMAT_ORDER_NHWC:
     case HAILO_FORMAT_ORDER_FCR:
     case HAILO_FORMAT_ORDER_F8CR:
@@ -1938,6 +2260,21 @@ FrameOutputTransformContext::FrameOutputTransformContext(size_t src_frame_size,
         LOGGER__CRITICAL("Got unknown format order = {}", HailoRTCommon::get_format_order_str(dst_format.order));
         break;
     }
+
+    // Planar float32 outputs are reordered and de-quantized in a single pass
+    const bool is_nchw_dequantize = should_quantize && should_reorder && !should_transpose &&
+        (HAILO_FORMAT_ORDER_NCHW == dst_format.order) && (HAILO_FORMAT_TYPE_FLOAT32 == dst_format.type) &&
+        ((HAILO_FORMAT_ORDER_NHCW == src_format.order) || (HAILO_FORMAT_ORDER_NHWC == src_format.order) ||
+            (HAILO_FORMAT_ORDER_FCR == src_format.order)) &&
+        ((HAILO_FORMAT_TYPE_UINT8 == src_format.type) || (HAILO_FORMAT_TYPE_UINT16 == src_format.type)) &&
+        (src_image_shape.height == dst_image_shape.height) && (src_image_shape.width >= dst_image_shape.width) &&
+        (src_image_shape.features >= dst_image_shape.features);
+    const bool has_quant_info_per_feature = m_are_all_qps_the_same ? !m_quant_info_per_feature.empty() :
+        (m_quant_info_per_feature.size() >= dst_image_shape.features);
+    m_should_dequantize_while_reordering = is_nchw_dequantize && has_quant_info_per_feature;
+    if (m_should_dequantize_while_reordering && m_are_all_qps_the_same) {
+        m_quant_info_per_feature.resize(1, m_quant_info_per_feature[0]);
+    }
 }
 
 Expected<std::unique_ptr<OutputTransformContext>> FrameOutputTransformContext::create(const hailo_3d_image_shape_t &src_image_shape,
@@ -1977,7 +2314,11 @@ NMSOutputTransformContext::NMSOutputTransformContext(size_t src_frame_size, cons
     const hailo_nms_info_t &nms_info, Buffer &&quant_buffer, const bool should_quantize, const bool should_transpose) :
         OutputTransformContext(src_frame_size, src_format, dst_frame_size, dst_format, dst_quant_infos, should_quantize ,should_transpose, 
         true, false), m_nms_info(nms_info), m_chunk_offsets(nms_info.chunks_per_frame, 0), m_quant_buffer(std::move(quant_buffer))
-{}
+{
+    if (HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE == dst_format.order) {
+        m_detections.reserve(static_cast<size_t>(nms_info.number_of_classes) * nms_info.chunks_per_frame * nms_info.max_bboxes_per_class);
+    }
+}
 
 Expected<std::unique_ptr<OutputTransformContext>> NMSOutputTransformContext::create(const hailo_format_t &src_format,
     const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_infos, const hailo_nms_info_t &nms_info)
@@ -1988,21 +2329,37 @@ Expected<std::unique_ptr<OutputTransformContext>> NMSOutputTransformContext::cre
 
     const auto internal_dst_format = HailoRTDefaults::expand_auto_format(dst_format, src_format);
 
-    CHECK_AS_EXPECTED(HAILO_FORMAT_ORDER_HAILO_NMS == internal_dst_format.order, HAILO_INVALID_ARGUMENT,
-        "Format order should be HAILO_FORMAT_ORDER_HAILO_NMS");
+    CHECK_AS_EXPECTED((HAILO_FORMAT_ORDER_HAILO_NMS == internal_dst_format.order) ||
+        (HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE == internal_dst_format.order), HAILO_INVALID_ARGUMENT,
+        "Format order should be HAILO_FORMAT_ORDER_HAILO_NMS or HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE");
 
     CHECK_AS_EXPECTED(HAILO_FORMAT_TYPE_FLOAT32 == internal_dst_format.type, HAILO_INVALID_ARGUMENT,
-        "Format order HAILO_FORMAT_ORDER_HAILO_NMS only supports format type of HAILO_FORMAT_TYPE_FLOAT32");
+        "Format order {} only supports format type of HAILO_FORMAT_TYPE_FLOAT32",
+        HailoRTCommon::get_format_order_str(internal_dst_format.order));
+
+    const bool is_by_score = (HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE == internal_dst_format.order);
+    hailo_format_t by_class_format = internal_dst_format;
+    by_class_format.order = HAILO_FORMAT_ORDER_HAILO_NMS;
 
     const auto src_frame_size = HailoRTCommon::get_nms_hw_frame_size(nms_info);
-    auto dst_frame_size = HailoRTCommon::get_nms_host_frame_size(nms_info, internal_dst_format);
+    auto dst_frame_size = HailoRTCommon::get_nms_host_frame_size(nms_info, by_class_format);
+    if (is_by_score) {
+        hailo_nms_shape_t nms_shape{};
+        nms_shape.number_of_classes = nms_info.number_of_classes;
+        nms_shape.max_bboxes_per_class = nms_info.chunks_per_frame * nms_info.max_bboxes_per_class;
+        const auto max_detections = static_cast<uint64_t>(nms_shape.number_of_classes) * nms_shape.max_bboxes_per_class;
+        CHECK_AS_EXPECTED(max_detections <= HailoRTCommon::MAX_NMS_BY_SCORE_DETECTIONS, HAILO_INVALID_ARGUMENT,
+            "HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE supports up to {} detections, got {}",
+            HailoRTCommon::MAX_NMS_BY_SCORE_DETECTIONS, max_detections);
+        dst_frame_size = HailoRTCommon::get_nms_by_score_host_frame_size(nms_shape);
+    }
 
     Buffer quant_buffer;
     auto should_quantize = TransformContextUtils::should_quantize(HAILO_D2H_STREAM, src_format, internal_dst_format);
     CHECK_EXPECTED(should_quantize);
-    if (*should_quantize) {
-        dst_frame_size = HailoRTCommon::get_nms_host_frame_size(nms_info, internal_dst_format);
-        auto expected_nms_quant_buffer = Buffer::create(dst_frame_size, 0);
+    // The by-score layout is gathered from the by-class buffer, so it is always parsed into the quant buffer first
+    if (*should_quantize || is_by_score) {
+        auto expected_nms_quant_buffer = Buffer::create(HailoRTCommon::get_nms_host_frame_size(nms_info, by_class_format), 0);
         CHECK_EXPECTED(expected_nms_quant_buffer);
         quant_buffer = expected_nms_quant_buffer.release();
     }
@@ -2039,7 +2396,8 @@ hailo_status NMSOutputTransformContext::transform(const MemoryView src, MemoryVi
     CHECK(dst.size() == m_dst_frame_size, HAILO_INVALID_ARGUMENT,
         "dst_size must be {}. passed size - {}", m_dst_frame_size, dst.size());
 
-    assert((HAILO_FORMAT_ORDER_HAILO_NMS == m_src_format.order) && (HAILO_FORMAT_ORDER_HAILO_NMS == m_dst_format.order));
+    assert((HAILO_FORMAT_ORDER_HAILO_NMS == m_src_format.order) && ((HAILO_FORMAT_ORDER_HAILO_NMS == m_dst_format.order) ||
+        (HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE == m_dst_format.order)));
 
     auto shape_size = HailoRTCommon::get_nms_host_shape_size(m_nms_info);
 
@@ -2048,6 +2406,12 @@ hailo_status NMSOutputTransformContext::transform(const MemoryView src, MemoryVi
         return HAILO_INVALID_OPERATION;
     }
 
+    if (HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE == m_dst_format.order) {
+        transform__d2h_NMS(src.data(), m_quant_buffer.data(), m_nms_info, m_chunk_offsets);
+        fill_by_score_buffer(dst);
+        return HAILO_SUCCESS;
+    }
+
     auto dst_buffer = m_should_quantize ? m_quant_buffer.data() : dst.data();
     transform__d2h_NMS(src.data(), dst_buffer, m_nms_info, m_chunk_offsets);
 
@@ -2104,6 +2468,49 @@ std::string FrameOutputTransformContext::description() const
     return transform_description.str();
 }
 
+void NMSOutputTransformContext::fill_by_score_buffer(MemoryView dst)
+{
+    // The quant buffer holds the by-class layout with uint16 elements: {count, bbox[count]} per class.
+    // Only the detections themselves are dequantized, straight into the compact layout.
+    const auto *src_ptr = reinterpret_cast<const uint16_t*>(m_quant_buffer.data());
+    const auto &quant_info = m_dst_quant_infos[0]; // TODO: Support NMS scale by feature (HRT-11052)
+    const auto dequantize = [this, &quant_info](uint16_t value) {
+        return m_should_quantize ? Quantization::dequantize_output<float32_t, uint16_t>(value, quant_info) :
+            static_cast<float32_t>(value);
+    };
+
+    auto rounding_tonearest_guard = RoundingToNearestGuard();
+    m_detections.clear();
+    size_t offset = 0;
+    for (uint32_t class_index = 0; class_index < m_nms_info.number_of_classes; class_index++) {
+        const size_t bbox_count = src_ptr[offset++];
+        for (size_t bbox_index = 0; bbox_index < bbox_count; bbox_index++) {
+            const auto *bbox = reinterpret_cast<const hailo_bbox_t*>(src_ptr + offset);
+            hailo_detection_t detection{};
+            detection.box.y_min = dequantize(bbox->y_min);
+            detection.box.x_min = dequantize(bbox->x_min);
+            detection.box.y_max = dequantize(bbox->y_max);
+            detection.box.x_max = dequantize(bbox->x_max);
+            detection.score = dequantize(bbox->score);
+            detection.class_id = static_cast<uint16_t>(class_index);
+            m_detections.push_back(detection);
+            offset += HailoRTCommon::BBOX_PARAMS;
+        }
+    }
+
+    // Stable, so detections with an equal score keep their class order
+    std::stable_sort(m_detections.begin(), m_detections.end(),
+        [](const hailo_detection_t &a, const hailo_detection_t &b) { return a.score > b.score; });
+
+    const auto max_detections = std::min<size_t>((dst.size() - sizeof(uint16_t)) / sizeof(hailo_detection_t),
+        HailoRTCommon::MAX_NMS_BY_SCORE_DETECTIONS);
+    const auto detections_count = std::min(m_detections.size(), max_detections);
+    *reinterpret_cast<uint16_t*>(dst.data()) = static_cast<uint16_t>(detections_count);
+    if (detections_count > 0) {
+        std::memcpy(dst.data() + sizeof(uint16_t), m_detections.data(), detections_count * sizeof(hailo_detection_t));
+    }
+}
+
 std::string NMSOutputTransformContext::description() const
 {
     std::stringstream transform_description;
@@ -2111,6 +2518,10 @@ std::string NMSOutputTransformContext::description() const
     transform_description << "number_of_classes: " << m_nms_info.number_of_classes <<
         ", max_bboxes_per_class: " << m_nms_info.max_bboxes_per_class;
 
+    if (HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE == m_dst_format.order) {
+        transform_description << " | sort by score";
+    }
+
     if (m_should_quantize) {
         transform_description << " | " <<
             TransformContextUtils::make_quantization_description(m_src_format.type, m_dst_format.type, m_dst_quant_infos);
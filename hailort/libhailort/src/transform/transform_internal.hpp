@@ -123,6 +123,22 @@ struct QuantInfoForDequantize
     {}
 };
 
+class HAILORTAPI FrameInputTransformContext final : public InputTransformContext
+{
+public:
+    FrameInputTransformContext(size_t src_frame_size, const hailo_3d_image_shape_t &src_image_shape,
+        const hailo_format_t &src_format, size_t dst_frame_size, const hailo_3d_image_shape_t &dst_image_shape,
+        const hailo_format_t &dst_format, const std::vector<hailo_quant_info_t> &dst_quant_infos, Buffer &&quant_buffer,
+        Buffer &&transpose_buffer, const bool should_quantize, const bool should_transpose, const bool should_reorder,
+        const bool should_pad_periph);
+
+private:
+    virtual Expected<MemoryView> planes_buffer(size_t size) override;
+
+    // Holds the gathered planes of non-contiguous pix buffers, allocated on first use
+    Buffer m_planes_buffer;
+};
+
 class HAILORTAPI FrameOutputTransformContext final : public OutputTransformContext
 {
 public:
@@ -144,6 +160,39 @@ public:
     virtual std::string description() const override;
 
 private:
+    template <typename T>
+    hailo_status dequantize_stream(T *dst_ptr, uint32_t shape_size)
+    {
+        /* if output layer is argmax - do not rescale */
+        if (HAILO_FORMAT_ORDER_NHW == m_dst_format.order) {
+            if (HAILO_FORMAT_TYPE_UINT8 == m_src_format.type) {
+                Quantization::dequantize_output_buffer_in_place<T, uint8_t>(dst_ptr, 0, shape_size, 0, 1);
+            } else if (HAILO_FORMAT_TYPE_UINT16 == m_src_format.type) {
+                Quantization::dequantize_output_buffer_in_place<T, uint16_t>(dst_ptr, 0, shape_size, 0, 1);
+            } else {
+                return HAILO_INVALID_OPERATION;
+            }
+            return HAILO_SUCCESS;
+        }
+
+        if (HAILO_FORMAT_TYPE_UINT8 == m_src_format.type) {
+            if (m_are_all_qps_the_same) {
+                Quantization::dequantize_output_buffer_in_place<T, uint8_t>(dst_ptr, shape_size, m_dst_quant_infos[0]);
+            } else {
+                dequantize_output_by_feature<T, uint8_t>(dst_ptr, shape_size, m_quant_info_per_feature, m_quant_infos_rep_count);
+            }
+        } else if (HAILO_FORMAT_TYPE_UINT16 == m_src_format.type) {
+            if (m_are_all_qps_the_same) {
+                Quantization::dequantize_output_buffer_in_place<T, uint16_t>(dst_ptr, shape_size, m_dst_quant_infos[0]);
+            } else {
+                dequantize_output_by_feature<T, uint16_t>(dst_ptr, shape_size, m_quant_info_per_feature, m_quant_infos_rep_count);
+            }
+        } else {
+            return HAILO_INVALID_OPERATION;
+        }
+        return HAILO_SUCCESS;
+    }
+
     template <typename T, typename Q>
     static inline void dequantize_output_by_feature(T *dst_ptr, uint32_t buffer_elements_count,
         const std::vector<QuantInfoForDequantize> &quant_infos, uint32_t repetition_count)
@@ -164,6 +213,7 @@ private:
     bool m_are_all_qps_the_same;
     std::vector<QuantInfoForDequantize> m_quant_info_per_feature;
     uint32_t m_quant_infos_rep_count;
+    bool m_should_dequantize_while_reordering;
 };
 
 class HAILORTAPI NMSOutputTransformContext final : public OutputTransformContext
@@ -180,12 +230,16 @@ public:
     virtual std::string description() const override;
 
 private:
+    // Gathers the detections of all classes from the quantized by-class buffer, and writes them sorted by score
+    void fill_by_score_buffer(MemoryView dst);
 
     const hailo_nms_info_t m_nms_info;
 
     // For each chunk contains offset of current nms class. Used here in order to avoid run-time allocations
     std::vector<size_t> m_chunk_offsets;
     Buffer m_quant_buffer;
+    // Used only with HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE - reused between frames in order to avoid run-time allocations
+    std::vector<hailo_detection_t> m_detections;
 };
 
 } /* namespace hailort */
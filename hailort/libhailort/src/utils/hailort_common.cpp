@@ -16,6 +16,7 @@ namespace hailort
 // Needed for the linker
 const uint32_t HailoRTCommon::BBOX_PARAMS;
 const uint32_t HailoRTCommon::MAX_DEFUSED_LAYER_COUNT;
+const uint32_t HailoRTCommon::MAX_NMS_BY_SCORE_DETECTIONS;
 const size_t HailoRTCommon::HW_DATA_ALIGNMENT;
 const uint32_t HailoRTCommon::MAX_NMS_BURST_SIZE;
 const size_t HailoRTCommon::DMA_ABLE_ALIGNMENT_WRITE_HW_LIMITATION;
@@ -51,6 +52,8 @@ uint32_t HailoRTCommon::get_nms_host_frame_size(const hailo_nms_shape_t &nms_sha
     double frame_size = 0;
     if (HAILO_FORMAT_ORDER_HAILO_NMS_WITH_BYTE_MASK == format.order) {
         frame_size = get_nms_with_byte_mask_host_frame_size(nms_shape);
+    } else if (HAILO_FORMAT_ORDER_HAILO_NMS_BY_SCORE == format.order) {
+        frame_size = get_nms_by_score_host_frame_size(nms_shape);
     } else {
         auto shape_size = get_nms_host_shape_size(nms_shape);
         frame_size =  shape_size * get_format_data_bytes(format);
@@ -241,6 +241,20 @@ struct HefLoadedTrace : Trace
     MD5_SUM_t md5_hash;
 };
 
+struct CompletionExecutorStatsTrace : Trace
+{
+    CompletionExecutorStatsTrace(const device_id_t &device_id, size_t threads_count, size_t queue_depth,
+        size_t max_queue_depth)
+        : Trace("completion_executor_stats"), device_id(device_id), threads_count(threads_count),
+          queue_depth(queue_depth), max_queue_depth(max_queue_depth)
+    {}
+
+    device_id_t device_id;
+    size_t threads_count;
+    size_t queue_depth;
+    size_t max_queue_depth;
+};
+
 struct DumpProfilerStateTrace : Trace
 {
     DumpProfilerStateTrace() : Trace("dump_profiler_state") {}
@@ -271,6 +285,7 @@ public:
     virtual void handle_trace(const DumpProfilerStateTrace&) {};
     virtual void handle_trace(const InitProfilerProtoTrace&) {};
     virtual void handle_trace(const HefLoadedTrace&) {};
+    virtual void handle_trace(const CompletionExecutorStatsTrace&) {};
 
 };
 
@@ -189,6 +189,7 @@ hailo_status MonitorHandler::start_mon(const std::string &unique_vdevice_hash)
 
     m_mon_thread = std::thread([this] ()
     {
+        OsUtils::set_current_thread_name("SCHED_MON");
         while (true) {
             auto status = m_mon_shutdown_event->wait(DEFAULT_SCHEDULER_MON_INTERVAL);
             if (HAILO_TIMEOUT == status) {
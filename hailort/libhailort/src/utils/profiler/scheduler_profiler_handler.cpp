@@ -184,6 +184,26 @@ void SchedulerProfilerHandler::handle_trace(const HefLoadedTrace &trace)
     added_trace->mutable_loaded_hef()->set_time_stamp(trace.timestamp);
 }
 
+void SchedulerProfilerHandler::handle_trace(const CompletionExecutorStatsTrace &trace)
+{
+    log(JSON({
+        {"action", json_to_string(trace.name)},
+        {"timestamp", json_to_string(trace.timestamp)},
+        {"device_id", json_to_string(trace.device_id)},
+        {"threads_count", json_to_string(trace.threads_count)},
+        {"queue_depth", json_to_string(trace.queue_depth)},
+        {"max_queue_depth", json_to_string(trace.max_queue_depth)}
+    }));
+
+    std::lock_guard<std::mutex> lock(m_proto_lock);
+    auto added_trace = m_profiler_trace_proto.add_added_trace();
+    added_trace->mutable_completion_executor_stats()->set_time_stamp(trace.timestamp);
+    added_trace->mutable_completion_executor_stats()->set_device_id(trace.device_id);
+    added_trace->mutable_completion_executor_stats()->set_threads_count(static_cast<uint32_t>(trace.threads_count));
+    added_trace->mutable_completion_executor_stats()->set_queue_depth(trace.queue_depth);
+    added_trace->mutable_completion_executor_stats()->set_max_queue_depth(trace.max_queue_depth);
+}
+
 void SchedulerProfilerHandler::handle_trace(const AddCoreOpTrace &trace)
 {
     log(JSON({
@@ -56,6 +56,7 @@ public:
     virtual void handle_trace(const DumpProfilerStateTrace&) override;
     virtual void handle_trace(const InitProfilerProtoTrace&) override;
     virtual void handle_trace(const HefLoadedTrace&) override;
+    virtual void handle_trace(const CompletionExecutorStatsTrace&) override;
 
 private:
     void log(JSON json);
@@ -537,6 +537,9 @@ Expected<std::unique_ptr<VDevice>> VDevice::create(const hailo_vdevice_params_t
         LOGGER__ERROR("multi_process_service requires service compilation with HAILO_BUILD_SERVICE");
         return make_unexpected(HAILO_INVALID_OPERATION);
 #endif // HAILO_SUPPORT_MULTI_PROCESS
+    } else if (get_env_variable(HAILO_HRPC_ADDRESS_ENV_VAR)) {
+        // The device is connected to a remote hailort_server, so there are no local devices to scan
+        TRY(vdevice, VDeviceHrpcClient::create(params));
     } else {
         auto acc_type = HailoRTDriver::AcceleratorType::ACC_TYPE_MAX_VALUE;
         if (nullptr != params.device_ids) {
@@ -581,6 +584,13 @@ Expected<std::unique_ptr<VDevice>> VDevice::create(const std::vector<std::string
 
 Expected<HailoRTDriver::AcceleratorType> VDeviceBase::get_accelerator_type(hailo_device_id_t *device_ids, size_t device_count)
 {
+    // The emulated device is not found by the scan, and it emulates an NNC accelerator
+    if ((nullptr != device_ids) && std::all_of(device_ids, device_ids + device_count, [](const hailo_device_id_t &id) {
+            return HailoRTDriver::EMULATED_DEVICE_ID == std::string(id.id);
+        })) {
+        return HailoRTDriver::AcceleratorType::NNC_ACCELERATOR;
+    }
+
     auto acc_type = HailoRTDriver::AcceleratorType::ACC_TYPE_MAX_VALUE;
     TRY(auto device_infos, HailoRTDriver::scan_devices());
     if (nullptr != device_ids) {
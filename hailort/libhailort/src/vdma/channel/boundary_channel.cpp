@@ -24,11 +24,11 @@ namespace hailort {
 namespace vdma {
 Expected<BoundaryChannelPtr> BoundaryChannel::create(HailoRTDriver &driver, vdma::ChannelId channel_id,
     Direction direction, vdma::DescriptorList &&desc_list, TransferLauncher &transfer_launcher,
-    size_t ongoing_transfers, size_t pending_transfers, const std::string &stream_name, LatencyMeterPtr latency_meter)
+    CompletionExecutor &completion_executor, size_t ongoing_transfers, size_t pending_transfers, const std::string &stream_name, LatencyMeterPtr latency_meter)
 {
     hailo_status status = HAILO_UNINITIALIZED;
     auto channel_ptr = make_shared_nothrow<BoundaryChannel>(driver, channel_id, direction, std::move(desc_list),
-        transfer_launcher, ongoing_transfers, pending_transfers, stream_name, latency_meter, status);
+        transfer_launcher, completion_executor, ongoing_transfers, pending_transfers, stream_name, latency_meter, status);
     CHECK_NOT_NULL_AS_EXPECTED(channel_ptr, HAILO_OUT_OF_HOST_MEMORY);
     CHECK_SUCCESS_AS_EXPECTED(status, "Failed creating BoundaryChannel");
     return channel_ptr;
@@ -36,12 +36,13 @@ Expected<BoundaryChannelPtr> BoundaryChannel::create(HailoRTDriver &driver, vdma
 
 BoundaryChannel::BoundaryChannel(HailoRTDriver &driver, vdma::ChannelId channel_id, Direction direction,
                                  DescriptorList &&desc_list, TransferLauncher &transfer_launcher,
-                                 size_t ongoing_transfers_queue_size, size_t pending_transfers_queue_size,
+                                 CompletionExecutor &completion_executor, size_t ongoing_transfers_queue_size, size_t pending_transfers_queue_size,
                                  const std::string &stream_name, LatencyMeterPtr latency_meter, hailo_status &status) :
     m_channel_id(channel_id),
     m_direction(direction),
     m_driver(driver),
     m_transfer_launcher(transfer_launcher),
+    m_completion_executor(completion_executor),
     m_desc_list(std::move(desc_list)),
     m_stream_name(stream_name),
     m_descs(m_desc_list.count()),
@@ -97,56 +98,64 @@ static hailo_status get_callback_status(vdma::ChannelId channel_id, const Channe
 
 hailo_status BoundaryChannel::trigger_channel_completion(const ChannelIrqData &irq_data)
 {
-    std::unique_lock<std::mutex> lock(m_channel_mutex);
-
-    if (!m_is_channel_activated) {
-        return HAILO_STREAM_NOT_ACTIVATED;
-    }
+    std::vector<TransferRequest> completed_requests;
+    hailo_status callback_status = HAILO_UNINITIALIZED;
+    {
+        std::unique_lock<std::mutex> lock(m_channel_mutex);
 
-    if (m_latency_meter != nullptr) {
-        CHECK_SUCCESS(update_latency_meter());
-    }
+        if (!m_is_channel_activated) {
+            return HAILO_STREAM_NOT_ACTIVATED;
+        }
 
-    CHECK(irq_data.transfers_completed <= m_ongoing_transfers.size(), HAILO_INTERNAL_FAILURE,
-        "Invalid amount of completed transfers {} max {}", irq_data.transfers_completed, m_ongoing_transfers.size());
-    
-    auto callback_status = get_callback_status(m_channel_id, irq_data);
-    // If channel is no longer active - all transfers should be completed
-    const size_t num_transfers_to_trigger = (HAILO_SUCCESS == callback_status) ? irq_data.transfers_completed :
-        m_ongoing_transfers.size();
-    for (size_t i = 0; i < num_transfers_to_trigger; i++) {
-        auto transfer = std::move(m_ongoing_transfers.front());
-        m_ongoing_transfers.pop_front();
-
-        // We increase desc num_proc (can happen only in this flow). After it is increased -
-        //  1. On D2H channels - the output can be read by the user.
-        //  2. On H2D channels - new input can be written to the buffer.
-        m_descs.set_tail((transfer.last_desc + 1) & m_descs.size_mask());
-
-        // We've freed up room in the descriptor list, so we can launch another transfer
-        if (!m_pending_transfers.empty()) {
-            m_transfer_launcher.enqueue_transfer([this]() {
-                std::unique_lock<std::mutex> lock(m_channel_mutex);
-                if (m_pending_transfers.empty()) {
-                    return;
-                }
-                auto transfer_request = std::move(m_pending_transfers.front());
-                m_pending_transfers.pop_front();
-                const auto status = launch_transfer_impl(std::move(transfer_request));
-                if (status != HAILO_SUCCESS) {
-                    on_request_complete(lock, transfer_request, status);
-                }
-            });
+        if (m_latency_meter != nullptr) {
+            CHECK_SUCCESS(update_latency_meter());
         }
 
-        // Call the user callback
-        // We want to do this after launching transfers queued in m_pending_transfers, in order to keep the
-        // callback order consistent.
-        // Also, we want to make sure that the callbacks are called after the descriptors can be reused (so the user
-        // will be able to start new transfer).
-        on_request_complete(lock, transfer.request, callback_status);
+        CHECK(irq_data.transfers_completed <= m_ongoing_transfers.size(), HAILO_INTERNAL_FAILURE,
+            "Invalid amount of completed transfers {} max {}", irq_data.transfers_completed, m_ongoing_transfers.size());
+
+        callback_status = get_callback_status(m_channel_id, irq_data);
+        // If channel is no longer active - all transfers should be completed
+        const size_t num_transfers_to_trigger = (HAILO_SUCCESS == callback_status) ? irq_data.transfers_completed :
+            m_ongoing_transfers.size();
+        completed_requests.reserve(num_transfers_to_trigger);
+        for (size_t i = 0; i < num_transfers_to_trigger; i++) {
+            auto transfer = std::move(m_ongoing_transfers.front());
+            m_ongoing_transfers.pop_front();
+
+            // We increase desc num_proc (can happen only in this flow). After it is increased -
+            //  1. On D2H channels - the output can be read by the user.
+            //  2. On H2D channels - new input can be written to the buffer.
+            m_descs.set_tail((transfer.last_desc + 1) & m_descs.size_mask());
+
+            // We've freed up room in the descriptor list, so we can launch another transfer
+            if (!m_pending_transfers.empty()) {
+                m_transfer_launcher.enqueue_transfer([this]() {
+                    std::unique_lock<std::mutex> lock(m_channel_mutex);
+                    if (m_pending_transfers.empty()) {
+                        return;
+                    }
+                    auto transfer_request = std::move(m_pending_transfers.front());
+                    m_pending_transfers.pop_front();
+                    const auto status = launch_transfer_impl(std::move(transfer_request));
+                    if (status != HAILO_SUCCESS) {
+                        on_request_complete(lock, transfer_request, status);
+                    }
+                });
+            }
+
+            completed_requests.emplace_back(std::move(transfer.request));
+        }
     }
 
+    // Call the user callbacks
+    // We want to do this after launching transfers queued in m_pending_transfers, in order to keep the
+    // callback order consistent.
+    // Also, we want to make sure that the callbacks are called after the descriptors can be reused (so the user
+    // will be able to start new transfer).
+    // The channel lock is released, so user code never runs while holding it.
+    complete_requests(std::move(completed_requests), callback_status);
+
     return HAILO_SUCCESS;
 }
 
@@ -293,22 +302,29 @@ hailo_status BoundaryChannel::bind_buffer(MappedBufferPtr buffer)
 
 void BoundaryChannel::cancel_pending_transfers()
 {
-    std::unique_lock<std::mutex> lock(m_channel_mutex);
-    // Cancel all ongoing transfers
-    while (!m_ongoing_transfers.empty()) {
-        auto transfer = std::move(m_ongoing_transfers.front());
-        m_ongoing_transfers.pop_front();
+    std::vector<TransferRequest> canceled_requests;
+    {
+        std::unique_lock<std::mutex> lock(m_channel_mutex);
+        canceled_requests.reserve(m_ongoing_transfers.size() + m_pending_transfers.size());
+
+        // Cancel all ongoing transfers
+        while (!m_ongoing_transfers.empty()) {
+            canceled_requests.emplace_back(std::move(m_ongoing_transfers.front().request));
+            m_ongoing_transfers.pop_front();
+        }
 
-        on_request_complete(lock, transfer.request, HAILO_STREAM_ABORT);
+        // Then cancel all pending transfers (which were to happen after the ongoing transfers are done)
+        while (!m_pending_transfers.empty()) {
+            canceled_requests.emplace_back(std::move(m_pending_transfers.front()));
+            m_pending_transfers.pop_front();
+        }
     }
 
-    // Then cancel all pending transfers (which were to happen after the ongoing transfers are done)
-    while (!m_pending_transfers.empty()) {
-        auto pending_transfer = std::move(m_pending_transfers.front());
-        m_pending_transfers.pop_front();
+    complete_requests(std::move(canceled_requests), HAILO_STREAM_ABORT);
 
-        on_request_complete(lock, pending_transfer, HAILO_STREAM_ABORT);
-    }
+    // Make sure no callback of this channel is called after the channel was canceled (unless canceled from a
+    // completion, where it can't be waited for - see CompletionExecutor::wait_for_idle)
+    m_completion_executor.wait_for_idle(completion_key());
 }
 
 size_t BoundaryChannel::get_max_ongoing_transfers(size_t /* transfer_size */) const
@@ -370,10 +386,25 @@ void BoundaryChannel::on_request_complete(std::unique_lock<std::mutex> &lock, Tr
     hailo_status complete_status)
 {
     lock.unlock();
-    request.callback(complete_status);
+    complete_requests({std::move(request)}, complete_status);
     lock.lock();
 }
 
+void BoundaryChannel::complete_requests(std::vector<TransferRequest> &&requests, hailo_status complete_status)
+{
+    for (auto &request : requests) {
+        m_completion_executor.enqueue(completion_key(), [request = std::move(request), complete_status]() {
+            request.callback(complete_status);
+        });
+    }
+}
+
+size_t BoundaryChannel::completion_key() const
+{
+    // All completions of a channel go to the same executor thread, so they are called in order
+    return (m_channel_id.engine_index * VDMA_CHANNELS_PER_ENGINE) + m_channel_id.channel_index;
+}
+
 bool BoundaryChannel::is_desc_between(uint16_t begin, uint16_t end, uint16_t desc)
 {
     if (begin == end) {
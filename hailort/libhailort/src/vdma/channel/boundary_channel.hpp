@@ -12,6 +12,7 @@
 
 #include "vdma/channel/channel_id.hpp"
 #include "vdma/channel/transfer_launcher.hpp"
+#include "vdma/channel/completion_executor.hpp"
 #include "vdma/memory/descriptor_list.hpp"
 #include "stream_common/transfer_common.hpp"
 
@@ -38,11 +39,12 @@ public:
     using Direction = HailoRTDriver::DmaDirection;
 
     static Expected<BoundaryChannelPtr> create(HailoRTDriver &driver, vdma::ChannelId channel_id, Direction direction,
-        vdma::DescriptorList &&desc_list, TransferLauncher &transfer_launcher, size_t ongoing_transfers,
-        size_t pending_transfers = 0, const std::string &stream_name = "", LatencyMeterPtr latency_meter = nullptr);
+        vdma::DescriptorList &&desc_list, TransferLauncher &transfer_launcher, CompletionExecutor &completion_executor,
+        size_t ongoing_transfers, size_t pending_transfers = 0, const std::string &stream_name = "", LatencyMeterPtr latency_meter = nullptr);
 
     BoundaryChannel(HailoRTDriver &driver, vdma::ChannelId channel_id, Direction direction, DescriptorList &&desc_list,
-        TransferLauncher &transfer_launcher, size_t ongoing_transfers_queue_size, size_t pending_transfers_queue_size,
+        TransferLauncher &transfer_launcher, CompletionExecutor &completion_executor,
+        size_t ongoing_transfers_queue_size, size_t pending_transfers_queue_size,
         const std::string &stream_name, LatencyMeterPtr latency_meter, hailo_status &status);
     BoundaryChannel(const BoundaryChannel &other) = delete;
     BoundaryChannel &operator=(const BoundaryChannel &other) = delete;
@@ -64,10 +66,13 @@ public:
     // HAILO_STREAM_ABORT as a status to the callbacks.
     // Note: This function is to be called on a deactivated channel object. Calling on an active channel will lead to
     // unexpected results
+    // Returns after all of the channel's callbacks were called (unless called from inside a callback).
     void cancel_pending_transfers();
 
     /**
      * Called when some transfer (or transfers) is completed.
+     * The callbacks of the completed transfers are handed off to the completion executor, after the channel lock
+     * is released.
      */
     hailo_status trigger_channel_completion(const ChannelIrqData &irq_data);
 
@@ -105,6 +110,8 @@ private:
 
     void on_request_complete(std::unique_lock<std::mutex> &lock, TransferRequest &request,
         hailo_status complete_status);
+    void complete_requests(std::vector<TransferRequest> &&requests, hailo_status complete_status);
+    size_t completion_key() const;
     hailo_status launch_transfer_impl(TransferRequest &&transfer_request);
 
     static bool is_desc_between(uint16_t begin, uint16_t end, uint16_t desc);
@@ -114,6 +121,7 @@ private:
     const Direction m_direction;
     HailoRTDriver &m_driver;
     TransferLauncher &m_transfer_launcher;
+    CompletionExecutor &m_completion_executor;
     DescriptorList m_desc_list; // Host side descriptor list
     const std::string m_stream_name;
     // Since all desc list sizes are a power of 2, we can use IsPow2Tag to optimize the circular buffer
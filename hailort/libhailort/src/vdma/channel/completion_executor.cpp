@@ -0,0 +1,184 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file completion_executor.cpp
+ * @brief Runs vdma transfer completion callbacks outside of the interrupt dispatcher thread
+ **/
+
+#include "completion_executor.hpp"
+#include "common/utils.hpp"
+#include "common/os_utils.hpp"
+#include "common/string_utils.hpp"
+
+namespace hailort {
+namespace vdma {
+
+constexpr size_t CompletionExecutor::DEFAULT_THREADS_COUNT;
+constexpr size_t CompletionExecutor::MAX_THREADS_COUNT;
+
+static size_t get_threads_count_from_env()
+{
+    auto threads_count_str = get_env_variable(HAILO_VDMA_COMPLETION_THREADS_ENV_VAR);
+    if (!threads_count_str) {
+        return CompletionExecutor::DEFAULT_THREADS_COUNT;
+    }
+
+    auto threads_count = StringUtils::to_uint32(threads_count_str.value(), 10);
+    if (!threads_count || (threads_count.value() > CompletionExecutor::MAX_THREADS_COUNT)) {
+        LOGGER__WARNING("Invalid {} value '{}' (expected 0-{}), using {}", HAILO_VDMA_COMPLETION_THREADS_ENV_VAR,
+            threads_count_str.value(), CompletionExecutor::MAX_THREADS_COUNT, CompletionExecutor::DEFAULT_THREADS_COUNT);
+        return CompletionExecutor::DEFAULT_THREADS_COUNT;
+    }
+
+    return threads_count.value();
+}
+
+Expected<std::unique_ptr<CompletionExecutor>> CompletionExecutor::create()
+{
+    return create(get_threads_count_from_env());
+}
+
+Expected<std::unique_ptr<CompletionExecutor>> CompletionExecutor::create(size_t threads_count)
+{
+    CHECK_AS_EXPECTED(threads_count <= MAX_THREADS_COUNT, HAILO_INVALID_ARGUMENT,
+        "Invalid completion threads count {} (max {})", threads_count, MAX_THREADS_COUNT);
+
+    hailo_status status = HAILO_UNINITIALIZED;
+    auto executor = make_unique_nothrow<CompletionExecutor>(threads_count, status);
+    CHECK_NOT_NULL_AS_EXPECTED(executor, HAILO_OUT_OF_HOST_MEMORY);
+    CHECK_SUCCESS_AS_EXPECTED(status, "Failed creating CompletionExecutor");
+    return executor;
+}
+
+CompletionExecutor::CompletionExecutor(size_t threads_count, hailo_status &status) :
+    m_workers(),
+    m_queue_depth(0),
+    m_max_queue_depth(0)
+{
+    m_workers.reserve(threads_count);
+    for (size_t i = 0; i < threads_count; i++) {
+        auto worker = make_unique_nothrow<Worker>();
+        if (nullptr == worker) {
+            LOGGER__ERROR("Failed allocating completion executor worker");
+            status = HAILO_OUT_OF_HOST_MEMORY;
+            return;
+        }
+        m_workers.emplace_back(std::move(worker));
+    }
+
+    // Start the threads only after m_workers is final, since each thread references its worker
+    for (auto &worker : m_workers) {
+        auto &worker_ref = *worker;
+        worker->thread = std::thread([this, &worker_ref] { worker_thread(worker_ref); });
+    }
+
+    status = HAILO_SUCCESS;
+}
+
+CompletionExecutor::~CompletionExecutor()
+{
+    signal_threads_quit();
+    for (auto &worker : m_workers) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+
+    if (0 != m_max_queue_depth.load()) {
+        LOGGER__DEBUG("Completion executor max queue depth {}", m_max_queue_depth.load());
+    }
+}
+
+void CompletionExecutor::enqueue(size_t key, Completion &&completion)
+{
+    if (m_workers.empty()) {
+        // Inline mode
+        completion();
+        return;
+    }
+
+    auto &worker = *m_workers[key % m_workers.size()];
+    {
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.queue.emplace(std::move(completion));
+        update_queue_depth(1);
+    }
+
+    worker.cond.notify_one();
+}
+
+void CompletionExecutor::wait_for_idle(size_t key)
+{
+    if (m_workers.empty() || is_executor_thread()) {
+        // Nothing is deferred, or we are called from a completion - waiting could deadlock.
+        return;
+    }
+
+    auto &worker = *m_workers[key % m_workers.size()];
+    std::unique_lock<std::mutex> lock(worker.mutex);
+    worker.idle_cond.wait(lock, [&worker] { return worker.queue.empty() && !worker.is_running_completion; });
+}
+
+void CompletionExecutor::worker_thread(Worker &worker)
+{
+    OsUtils::set_current_thread_name("VDMA_COMPLETE");
+
+    while (true) {
+        Completion completion;
+        {
+            std::unique_lock<std::mutex> lock(worker.mutex);
+            worker.cond.wait(lock, [&worker] { return worker.should_quit || !worker.queue.empty(); });
+            if (worker.queue.empty()) {
+                // should_quit is set and all completions were called
+                return;
+            }
+
+            completion = std::move(worker.queue.front());
+            worker.queue.pop();
+            worker.is_running_completion = true;
+            m_queue_depth--;
+        }
+
+        completion();
+
+        {
+            std::lock_guard<std::mutex> lock(worker.mutex);
+            worker.is_running_completion = false;
+        }
+        worker.idle_cond.notify_all();
+    }
+}
+
+void CompletionExecutor::signal_threads_quit()
+{
+    for (auto &worker : m_workers) {
+        {
+            std::lock_guard<std::mutex> lock(worker->mutex);
+            worker->should_quit = true;
+        }
+        worker->cond.notify_all();
+    }
+}
+
+bool CompletionExecutor::is_executor_thread() const
+{
+    const auto this_thread_id = std::this_thread::get_id();
+    for (const auto &worker : m_workers) {
+        if (worker->thread.get_id() == this_thread_id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void CompletionExecutor::update_queue_depth(size_t added)
+{
+    const auto depth = m_queue_depth.fetch_add(added) + added;
+    auto max_depth = m_max_queue_depth.load();
+    while ((depth > max_depth) && !m_max_queue_depth.compare_exchange_weak(max_depth, depth)) {}
+}
+
+} /* namespace vdma */
+} /* namespace hailort */
@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+**/
+/**
+ * @file completion_executor.hpp
+ * @brief Runs vdma transfer completion callbacks outside of the interrupt dispatcher thread
+ *
+ * Completions are sharded between the worker threads by a key (the channel), so callbacks of a single channel are
+ * always called in order, while different channels may complete in parallel. An executor created with zero threads
+ * runs the completions inline on the enqueuing thread (lowest latency, but user code runs on the interrupt thread).
+ **/
+
+#ifndef _HAILO_COMPLETION_EXECUTOR_HPP_
+#define _HAILO_COMPLETION_EXECUTOR_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <queue>
+#include <vector>
+#include <atomic>
+
+namespace hailort {
+namespace vdma {
+
+#define HAILO_VDMA_COMPLETION_THREADS_ENV_VAR ("HAILO_VDMA_COMPLETION_THREADS")
+
+class CompletionExecutor final
+{
+public:
+    using Completion = std::function<void()>;
+
+    static constexpr size_t DEFAULT_THREADS_COUNT = 1;
+    static constexpr size_t MAX_THREADS_COUNT = 16;
+
+    // Creates the executor with the thread count given by HAILO_VDMA_COMPLETION_THREADS (or DEFAULT_THREADS_COUNT)
+    static Expected<std::unique_ptr<CompletionExecutor>> create();
+    static Expected<std::unique_ptr<CompletionExecutor>> create(size_t threads_count);
+    CompletionExecutor(size_t threads_count, hailo_status &status);
+    ~CompletionExecutor();
+
+    CompletionExecutor(CompletionExecutor &&) = delete;
+    CompletionExecutor(const CompletionExecutor &) = delete;
+    CompletionExecutor &operator=(CompletionExecutor &&) = delete;
+    CompletionExecutor &operator=(const CompletionExecutor &) = delete;
+
+    // Completions enqueued with the same key are called in the order they were enqueued.
+    void enqueue(size_t key, Completion &&completion);
+
+    // Blocks until all completions enqueued with the given key were called. Returns immediately when called from one
+    // of the executor threads (i.e. from inside a completion) - waiting there could deadlock, either on the thread's
+    // own queue or with a completion of another thread waiting for this one. So a completion can't rely on the
+    // completions of other keys being done (e.g. when cancelling another channel's transfers).
+    void wait_for_idle(size_t key);
+
+    size_t threads_count() const { return m_workers.size(); }
+
+    // Number of completions enqueued and not yet called
+    size_t queue_depth() const { return m_queue_depth.load(); }
+    // Highest queue_depth seen since the executor was created
+    size_t max_queue_depth() const { return m_max_queue_depth.load(); }
+
+private:
+    struct Worker {
+        std::mutex mutex;
+        std::condition_variable cond;
+        std::condition_variable idle_cond;
+        std::queue<Completion> queue;
+        bool is_running_completion = false;
+        // should_quit is used to quit the thread (called on destruction), after the queue is drained
+        bool should_quit = false;
+        std::thread thread;
+    };
+
+    void worker_thread(Worker &worker);
+    void signal_threads_quit();
+    bool is_executor_thread() const;
+    void update_queue_depth(size_t added);
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::atomic<size_t> m_queue_depth;
+    std::atomic<size_t> m_max_queue_depth;
+};
+
+} /* namespace vdma */
+} /* namespace hailort */
+
+#endif /* _HAILO_COMPLETION_EXECUTOR_HPP_ */
@@ -10,22 +10,75 @@
 #include "interrupts_dispatcher.hpp"
 #include "hailo/hailort_common.hpp"
 #include "common/os_utils.hpp"
+#include "common/string_utils.hpp"
 
 namespace hailort {
 namespace vdma {
 
+static std::chrono::microseconds get_window_from_env(const char *env_var_name)
+{
+    auto window_str = get_env_variable(env_var_name);
+    if (!window_str) {
+        return std::chrono::microseconds(0);
+    }
+
+    auto window_us = StringUtils::to_uint32(window_str.value(), 10);
+    if (!window_us) {
+        LOGGER__WARNING("Invalid {} value '{}', ignoring", env_var_name, window_str.value());
+        return std::chrono::microseconds(0);
+    }
+
+    return std::chrono::microseconds(window_us.value());
+}
+
+InterruptsWaitParams InterruptsWaitParams::from_env()
+{
+    InterruptsWaitParams params{};
+    params.busy_poll_window = get_window_from_env(HAILO_VDMA_INTERRUPTS_BUSY_POLL_US_ENV_VAR);
+    params.coalesce_window = get_window_from_env(HAILO_VDMA_INTERRUPTS_COALESCE_US_ENV_VAR);
+    return params;
+}
+
 Expected<std::unique_ptr<InterruptsDispatcher>> InterruptsDispatcher::create(std::reference_wrapper<HailoRTDriver> driver)
 {
-    auto thread = make_unique_nothrow<InterruptsDispatcher>(driver);
+    return create(driver, InterruptsWaitParams::from_env());
+}
+
+Expected<std::unique_ptr<InterruptsDispatcher>> InterruptsDispatcher::create(std::reference_wrapper<HailoRTDriver> driver,
+    const InterruptsWaitParams &wait_params)
+{
+    if ((wait_params.busy_poll_window.count() > 0) || (wait_params.coalesce_window.count() > 0)) {
+        LOGGER__INFO("vDMA interrupts busy poll window {}us, coalesce window {}us",
+            wait_params.busy_poll_window.count(), wait_params.coalesce_window.count());
+    }
+
+    auto thread = make_unique_nothrow<InterruptsDispatcher>(driver, wait_params);
     CHECK_NOT_NULL_AS_EXPECTED(thread, HAILO_OUT_OF_HOST_MEMORY);
     return thread;
 }
 
-InterruptsDispatcher::InterruptsDispatcher(std::reference_wrapper<HailoRTDriver> driver) :
+InterruptsDispatcher::InterruptsDispatcher(std::reference_wrapper<HailoRTDriver> driver,
+    const InterruptsWaitParams &wait_params) :
     m_driver(driver),
+    m_wait_params(wait_params),
+    m_should_stop_polling(false),
     m_interrupts_thread([this] { wait_interrupts(); })
 {}
 
+static std::vector<vdma::ChannelId> get_channels_in_bitmap(const ChannelsBitmap &channels_bitmap)
+{
+    std::vector<vdma::ChannelId> channels;
+    for (size_t engine_index = 0; engine_index < channels_bitmap.size(); engine_index++) {
+        for (size_t channel_index = 0; channel_index < VDMA_CHANNELS_PER_ENGINE; channel_index++) {
+            if (channels_bitmap[engine_index] & (1U << channel_index)) {
+                channels.emplace_back(vdma::ChannelId{static_cast<uint8_t>(engine_index),
+                    static_cast<uint8_t>(channel_index)});
+            }
+        }
+    }
+    return channels;
+}
+
 InterruptsDispatcher::~InterruptsDispatcher()
 {
     if (m_wait_context != nullptr) {
@@ -48,11 +101,20 @@ hailo_status InterruptsDispatcher::start(const ChannelsBitmap &channels_bitmap,
         std::unique_lock<std::mutex> lock(m_mutex);
         CHECK(m_wait_context == nullptr, HAILO_INVALID_OPERATION, "Interrupt thread already running");
 
+        // Busy polling is done by reading the interrupts timestamps, so it can't be used when the user measures them.
+        const bool should_busy_poll = (m_wait_params.busy_poll_window.count() > 0) && !enable_timestamp_measure;
+        if ((m_wait_params.busy_poll_window.count() > 0) && enable_timestamp_measure) {
+            LOGGER__WARNING("vDMA interrupts busy polling is disabled while measuring latency");
+        }
+
         auto wait_context = make_unique_nothrow<WaitContext>(WaitContext{channels_bitmap, process_irq});
         CHECK_NOT_NULL(wait_context, HAILO_OUT_OF_HOST_MEMORY);
         m_wait_context = std::move(wait_context);
+        m_polled_channels = should_busy_poll ? get_channels_in_bitmap(channels_bitmap) : std::vector<vdma::ChannelId>{};
+        m_should_stop_polling = false;
 
-        auto status = m_driver.get().vdma_enable_channels(m_wait_context->bitmap, enable_timestamp_measure);
+        auto status = m_driver.get().vdma_enable_channels(m_wait_context->bitmap,
+            enable_timestamp_measure || should_busy_poll);
         CHECK_SUCCESS(status, "Failed to enable vdma channels");
     }
     m_cond.notify_one();
@@ -80,6 +142,7 @@ hailo_status InterruptsDispatcher::stop()
     // Nullify wait context so the thread will pause
     const auto bitmap = m_wait_context->bitmap;
     m_wait_context = nullptr;
+    m_should_stop_polling = true;
 
     // Calling disable interrupts will cause the vdma_interrupts_wait to return.
     auto status = m_driver.get().vdma_disable_channels(bitmap);
@@ -97,6 +160,9 @@ void InterruptsDispatcher::wait_interrupts()
 {
     OsUtils::set_current_thread_name("CHANNEL_INTR");
 
+    // Time of the last interrupts processing pass, used for the busy poll and coalesce windows
+    auto last_irq_time = std::chrono::steady_clock::time_point::min();
+
     std::unique_lock<std::mutex> lock(m_mutex);
     while (true) {
 
@@ -116,6 +182,14 @@ void InterruptsDispatcher::wait_interrupts()
         //   2. vdma_disable_channels will be called, vdma_interrupts_wait will return with an empty list.
         //   3. Other error returns - shouldn't really happen, we exit the interrupt thread.
         lock.unlock();
+        wait_before_blocking(last_irq_time);
+        lock.lock();
+        if ((m_wait_context == nullptr) || m_should_stop_polling) {
+            // stop() was called while waiting before blocking, the channels may already be disabled (so nothing
+            // would release the blocking wait)
+            continue;
+        }
+        lock.unlock();
         auto irq_data = m_driver.get().vdma_interrupts_wait(wait_context.bitmap);
         lock.lock();
 
@@ -125,11 +199,47 @@ void InterruptsDispatcher::wait_interrupts()
         }
 
         if (irq_data->channels_count > 0) {
+            last_irq_time = std::chrono::steady_clock::now();
             wait_context.process_irq(irq_data.release());
         }
     }
 }
 
+void InterruptsDispatcher::wait_before_blocking(std::chrono::steady_clock::time_point last_irq_time)
+{
+    if (m_wait_params.coalesce_window.count() > 0) {
+        // Let completions accumulate, so the next blocking wait returns all of them at once.
+        const auto coalesce_end = last_irq_time + m_wait_params.coalesce_window;
+        if (std::chrono::steady_clock::now() < coalesce_end) {
+            std::this_thread::sleep_until(coalesce_end);
+        }
+    }
+
+    if (m_polled_channels.empty()) {
+        return;
+    }
+
+    // Spin until some interrupt arrives (then the blocking wait returns without sleeping) or until the window is over.
+    const auto poll_end = last_irq_time + m_wait_params.busy_poll_window;
+    while ((std::chrono::steady_clock::now() < poll_end) && !m_should_stop_polling) {
+        if (poll_channels()) {
+            return;
+        }
+    }
+}
+
+bool InterruptsDispatcher::poll_channels()
+{
+    for (const auto &channel_id : m_polled_channels) {
+        auto timestamps = m_driver.get().vdma_interrupts_read_timestamps(channel_id);
+        if (!timestamps || (timestamps->count > 0)) {
+            // On failure, just fall back to the blocking wait
+            return true;
+        }
+    }
+    return false;
+}
+
 void InterruptsDispatcher::signal_thread_quit()
 {
     {
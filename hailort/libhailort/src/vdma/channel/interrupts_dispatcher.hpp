@@ -16,10 +16,29 @@
 #include <thread>
 #include <functional>
 #include <condition_variable>
+#include <atomic>
+#include <chrono>
 
 namespace hailort {
 namespace vdma {
 
+#define HAILO_VDMA_INTERRUPTS_BUSY_POLL_US_ENV_VAR ("HAILO_VDMA_INTERRUPTS_BUSY_POLL_US")
+#define HAILO_VDMA_INTERRUPTS_COALESCE_US_ENV_VAR ("HAILO_VDMA_INTERRUPTS_COALESCE_US")
+
+struct InterruptsWaitParams {
+    // After each processed interrupt, the interrupts thread keeps polling the channels (using the non blocking
+    // timestamps ioctl) for this window before blocking in the driver again. Trades a cpu core for lower wakeup
+    // latency. Zero disables busy polling.
+    std::chrono::microseconds busy_poll_window = std::chrono::microseconds(0);
+
+    // Minimal time between two interrupt processing passes. Completions arriving within the window are processed
+    // together, reducing the interrupts thread wakeups on the expense of latency. Zero disables coalescing.
+    std::chrono::microseconds coalesce_window = std::chrono::microseconds(0);
+
+    // Reads HAILO_VDMA_INTERRUPTS_BUSY_POLL_US and HAILO_VDMA_INTERRUPTS_COALESCE_US
+    static InterruptsWaitParams from_env();
+};
+
 /// When needed, creates thread (or threads) that waits for interrupts on all channels.
 class InterruptsDispatcher final {
 public:
@@ -27,7 +46,9 @@ public:
     using ProcessIrqCallback = std::function<void(IrqData &&irq_data)>;
 
     static Expected<std::unique_ptr<InterruptsDispatcher>> create(std::reference_wrapper<HailoRTDriver> driver);
-    explicit InterruptsDispatcher(std::reference_wrapper<HailoRTDriver> driver);
+    static Expected<std::unique_ptr<InterruptsDispatcher>> create(std::reference_wrapper<HailoRTDriver> driver,
+        const InterruptsWaitParams &wait_params);
+    InterruptsDispatcher(std::reference_wrapper<HailoRTDriver> driver, const InterruptsWaitParams &wait_params);
     ~InterruptsDispatcher();
 
     InterruptsDispatcher(const InterruptsDispatcher &) = delete;
@@ -42,14 +63,17 @@ public:
 
 private:
 
-    void wait_interrupts();
-    void signal_thread_quit();
-
     struct WaitContext {
         ChannelsBitmap bitmap;
         ProcessIrqCallback process_irq;
     };
 
+    void wait_interrupts();
+    void signal_thread_quit();
+    // Called before blocking on vdma_interrupts_wait, returns when the blocking wait should be called.
+    void wait_before_blocking(std::chrono::steady_clock::time_point last_irq_time);
+    bool poll_channels();
+
     enum class ThreadState {
         // The interrupts thread is actually waiting for interrupts
         active,
@@ -62,10 +86,16 @@ private:
     std::condition_variable m_cond;
 
     const std::reference_wrapper<HailoRTDriver> m_driver;
+    const InterruptsWaitParams m_wait_params;
 
     ThreadState m_thread_state = ThreadState::not_active;
     // When m_wait_context is not nullptr, the thread should start waiting for interrupts.
     std::unique_ptr<WaitContext> m_wait_context;
+    // Channels polled between the blocking waits, empty if busy polling is disabled. Set on start(), when the thread
+    // is not active.
+    std::vector<vdma::ChannelId> m_polled_channels;
+    // Set on stop(), so the thread won't keep busy polling channels that are being disabled.
+    std::atomic_bool m_should_stop_polling;
 
     // m_should_quit is used to quit the thread (called on destruction)
     bool m_should_quit = false;
@@ -0,0 +1,752 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file emulated_driver.cpp
+ * @brief In process emulation of the hailo driver
+ **/
+
+#include "vdma/driver/emulated_driver.hpp"
+
+#include "common/logger_macros.hpp"
+#include "common/utils.hpp"
+#include "common/string_utils.hpp"
+
+#include "device_common/control_protocol.hpp"
+#include "firmware_version.h"
+#include "byte_order.h"
+#include "md5.h"
+
+#include <thread>
+#include <algorithm>
+
+#ifdef __QNX__
+#include <unistd.h>
+#endif // __QNX__
+
+
+namespace hailort
+{
+
+static constexpr std::chrono::microseconds DEFAULT_TRANSFER_LATENCY(5);
+static constexpr uint32_t DEFAULT_CHANNEL_BANDWIDTH_MBPS = 3000;
+static constexpr std::chrono::microseconds DEFAULT_INFER_LATENCY(1000);
+static constexpr std::chrono::microseconds DEFAULT_CONTROL_LATENCY(0);
+
+static constexpr uint64_t EMULATED_DESC_LIST_DMA_ADDRESS_BASE = 0x100000000;
+
+static const char EMULATED_BOARD_NAME[] = "Hailo-8 Emulated";
+static const char EMULATED_SERIAL_NUMBER[] = "EMULATED";
+static const char EMULATED_PRODUCT_NAME[] = "Hailo-8 Emulated Device";
+
+static Expected<uint32_t> get_env_uint32(const char *env_var_name, uint32_t default_value)
+{
+    auto env_var = get_env_variable(env_var_name);
+    if (HAILO_NOT_FOUND == env_var.status()) {
+        return Expected<uint32_t>(default_value);
+    }
+    CHECK_EXPECTED(env_var);
+
+    auto value = StringUtils::to_uint32(env_var.value(), 10);
+    CHECK_AS_EXPECTED(value.has_value(), HAILO_INVALID_ARGUMENT, "Invalid value '{}' for {}", env_var.value(),
+        env_var_name);
+    return value;
+}
+
+Expected<EmulatedLatencyModel> EmulatedLatencyModel::create_from_env()
+{
+    EmulatedLatencyModel model{};
+
+    TRY(const auto transfer_latency_us, get_env_uint32(EMULATED_DRIVER_TRANSFER_LATENCY_US_ENV_VAR,
+        static_cast<uint32_t>(DEFAULT_TRANSFER_LATENCY.count())));
+    TRY(model.channel_bandwidth_mbps, get_env_uint32(EMULATED_DRIVER_BANDWIDTH_MBPS_ENV_VAR,
+        DEFAULT_CHANNEL_BANDWIDTH_MBPS));
+    TRY(const auto infer_latency_us, get_env_uint32(EMULATED_DRIVER_INFER_LATENCY_US_ENV_VAR,
+        static_cast<uint32_t>(DEFAULT_INFER_LATENCY.count())));
+    TRY(const auto control_latency_us, get_env_uint32(EMULATED_DRIVER_CONTROL_LATENCY_US_ENV_VAR,
+        static_cast<uint32_t>(DEFAULT_CONTROL_LATENCY.count())));
+
+    model.transfer_latency = std::chrono::microseconds(transfer_latency_us);
+    model.infer_latency = std::chrono::microseconds(infer_latency_us);
+    model.control_latency = std::chrono::microseconds(control_latency_us);
+    return model;
+}
+
+Expected<std::unique_ptr<EmulatedDriver>> EmulatedDriver::create()
+{
+    TRY(const auto latency_model, EmulatedLatencyModel::create_from_env());
+    LOGGER__INFO("Using emulated driver (transfer latency {}us, bandwidth {}MB/s, infer latency {}us)",
+        std::chrono::duration_cast<std::chrono::microseconds>(latency_model.transfer_latency).count(),
+        latency_model.channel_bandwidth_mbps,
+        std::chrono::duration_cast<std::chrono::microseconds>(latency_model.infer_latency).count());
+
+    auto driver = make_unique_nothrow<EmulatedDriver>(latency_model);
+    CHECK_NOT_NULL_AS_EXPECTED(driver, HAILO_OUT_OF_HOST_MEMORY);
+    return driver;
+}
+
+EmulatedDriver::EmulatedDriver(const EmulatedLatencyModel &latency_model) :
+    m_latency_model(latency_model),
+    m_next_handle(1),
+    m_channels(),
+    m_channels_disable_count(0),
+    m_notifications_disabled(false)
+{}
+
+int EmulatedDriver::run_ioctl(uint32_t ioctl_code, void *param)
+{
+    switch (ioctl_code) {
+    case HAILO_QUERY_DRIVER_INFO:
+        return query_driver_info(*static_cast<hailo_driver_info*>(param));
+    case HAILO_QUERY_DEVICE_PROPERTIES:
+        return query_device_properties(*static_cast<hailo_device_properties*>(param));
+    case HAILO_MEMORY_TRANSFER:
+        return memory_transfer(*static_cast<hailo_memory_transfer_params*>(param));
+    case HAILO_VDMA_ENABLE_CHANNELS:
+        return vdma_enable_channels(*static_cast<hailo_vdma_enable_channels_params*>(param));
+    case HAILO_VDMA_DISABLE_CHANNELS:
+        return vdma_disable_channels(*static_cast<hailo_vdma_disable_channels_params*>(param));
+    case HAILO_VDMA_INTERRUPTS_WAIT:
+        return vdma_interrupts_wait(*static_cast<hailo_vdma_interrupts_wait_params*>(param));
+    case HAILO_VDMA_INTERRUPTS_READ_TIMESTAMPS:
+        return vdma_interrupts_read_timestamps(*static_cast<hailo_vdma_interrupts_read_timestamp_params*>(param));
+    case HAILO_VDMA_BUFFER_MAP:
+        return vdma_buffer_map(*static_cast<hailo_vdma_buffer_map_params*>(param));
+    case HAILO_VDMA_BUFFER_UNMAP:
+        return vdma_buffer_unmap(*static_cast<hailo_vdma_buffer_unmap_params*>(param));
+    case HAILO_VDMA_BUFFER_SYNC:
+        // Buffers are never accessed by the emulated device
+        return 0;
+    case HAILO_DESC_LIST_CREATE:
+        return descriptors_list_create(*static_cast<hailo_desc_list_create_params*>(param));
+    case HAILO_DESC_LIST_RELEASE:
+        return descriptors_list_release(*static_cast<hailo_desc_list_release_params*>(param));
+    case HAILO_DESC_LIST_PROGRAM:
+        return descriptors_list_program(*static_cast<hailo_desc_list_program_params*>(param));
+    case HAILO_VDMA_LAUNCH_TRANSFER:
+        return launch_transfer(*static_cast<hailo_vdma_launch_transfer_params*>(param));
+    case HAILO_FW_CONTROL:
+        return fw_control(*static_cast<hailo_fw_control*>(param));
+    case HAILO_READ_NOTIFICATION:
+        return read_notification(*static_cast<hailo_d2h_notification*>(param));
+    case HAILO_DISABLE_NOTIFICATION:
+        return disable_notification();
+    case HAILO_READ_LOG:
+        return read_log(*static_cast<hailo_read_log_params*>(param));
+    case HAILO_RESET_NN_CORE:
+        return 0;
+    case HAILO_MARK_AS_IN_USE:
+        return mark_as_in_use(*static_cast<hailo_mark_as_in_use_params*>(param));
+    default:
+        LOGGER__ERROR("Ioctl {:x} is not supported by the emulated driver", ioctl_code);
+        return ENOTSUP;
+    }
+}
+
+int EmulatedDriver::query_driver_info(hailo_driver_info &params)
+{
+    hailo_version_t library_version{};
+    auto status = hailo_get_library_version(&library_version);
+    if (HAILO_SUCCESS != status) {
+        return EINVAL;
+    }
+
+    params.major_version = library_version.major;
+    params.minor_version = library_version.minor;
+    params.revision_version = library_version.revision;
+    return 0;
+}
+
+int EmulatedDriver::query_device_properties(hailo_device_properties &params)
+{
+    params.desc_max_page_size = DESC_MAX_PAGE_SIZE;
+    params.board_type = HAILO_BOARD_TYPE_HAILO8;
+    params.allocation_mode = HAILO_ALLOCATION_MODE_USERSPACE;
+    params.dma_type = HAILO_DMA_TYPE_PCIE;
+    params.dma_engines_count = DMA_ENGINES_COUNT;
+    params.is_fw_loaded = true;
+#ifdef __QNX__
+    params.resource_manager_pid = getpid();
+#endif // __QNX__
+    return 0;
+}
+
+int EmulatedDriver::memory_transfer(hailo_memory_transfer_params &params)
+{
+    if (params.count > sizeof(params.buffer)) {
+        return EINVAL;
+    }
+
+    // The emulated device memory always reads as zeros, writes are dropped
+    if (TRANSFER_READ == params.transfer_direction) {
+        memset(params.buffer, 0, params.count);
+    }
+    return 0;
+}
+
+int EmulatedDriver::vdma_buffer_map(hailo_vdma_buffer_map_params &params)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    params.mapped_handle = m_next_handle++;
+    m_mapped_buffers.emplace(params.mapped_handle, params.size);
+    return 0;
+}
+
+int EmulatedDriver::vdma_buffer_unmap(const hailo_vdma_buffer_unmap_params &params)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return (1 == m_mapped_buffers.erase(params.mapped_handle)) ? 0 : EINVAL;
+}
+
+int EmulatedDriver::descriptors_list_create(hailo_desc_list_create_params &params)
+{
+    if ((0 == params.desc_count) || (0 == params.desc_page_size) || (params.desc_page_size > DESC_MAX_PAGE_SIZE)) {
+        return EINVAL;
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    params.desc_handle = m_next_handle++;
+    // Unique fake address, the emulated device never dereferences it
+    params.dma_address = EMULATED_DESC_LIST_DMA_ADDRESS_BASE + (static_cast<uint64_t>(params.desc_handle) << 20);
+    m_desc_lists.emplace(params.desc_handle, DescList{params.desc_count, params.desc_page_size});
+    return 0;
+}
+
+int EmulatedDriver::descriptors_list_release(const hailo_desc_list_release_params &params)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return (1 == m_desc_lists.erase(params.desc_handle)) ? 0 : EINVAL;
+}
+
+int EmulatedDriver::descriptors_list_program(const hailo_desc_list_program_params &params)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    const auto buffer = m_mapped_buffers.find(params.buffer_handle);
+    if ((m_desc_lists.end() == m_desc_lists.find(params.desc_handle)) || (m_mapped_buffers.end() == buffer) ||
+        (params.buffer_offset + params.buffer_size > buffer->second)) {
+        return EINVAL;
+    }
+    return 0;
+}
+
+EmulatedDriver::Channel *EmulatedDriver::get_channel(uint8_t engine_index, uint8_t channel_index)
+{
+    if ((engine_index >= DMA_ENGINES_COUNT) || (channel_index >= VDMA_CHANNELS_PER_ENGINE)) {
+        return nullptr;
+    }
+    return &m_channels[engine_index][channel_index];
+}
+
+int EmulatedDriver::vdma_enable_channels(const hailo_vdma_enable_channels_params &params)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    m_contexts.emplace_back();
+    auto &context = m_contexts.back();
+    for (uint8_t engine_index = 0; engine_index < MAX_VDMA_ENGINES_COUNT; engine_index++) {
+        for (uint8_t channel_index = 0; channel_index < VDMA_CHANNELS_PER_ENGINE; channel_index++) {
+            if (0 == (params.channels_bitmap_per_engine[engine_index] & (1U << channel_index))) {
+                continue;
+            }
+
+            auto channel = get_channel(engine_index, channel_index);
+            if ((nullptr == channel) || (nullptr != channel->context)) {
+                LOGGER__ERROR("Invalid channel {}:{} given to enable", engine_index, channel_index);
+                detach_context(context);
+                m_contexts.pop_back();
+                return EINVAL;
+            }
+
+            *channel = Channel{};
+            channel->is_h2d = (channel_index < VDMA_DEST_CHANNELS_START);
+            channel->context = &context;
+            channel->measure_timestamps = params.enable_timestamps_measure;
+            if (channel->is_h2d) {
+                channel->input_index = context.h2d_channels.size();
+                context.h2d_channels.push_back(channel);
+            } else {
+                context.d2h_channels.push_back(channel);
+            }
+        }
+    }
+    context.pending_inputs.resize(context.h2d_channels.size());
+    return 0;
+}
+
+void EmulatedDriver::detach_context(Context &context)
+{
+    for (auto channel : context.h2d_channels) {
+        *channel = Channel{};
+    }
+    for (auto channel : context.d2h_channels) {
+        *channel = Channel{};
+    }
+}
+
+int EmulatedDriver::vdma_disable_channels(const hailo_vdma_disable_channels_params &params)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        for (uint8_t engine_index = 0; engine_index < MAX_VDMA_ENGINES_COUNT; engine_index++) {
+            for (uint8_t channel_index = 0; channel_index < VDMA_CHANNELS_PER_ENGINE; channel_index++) {
+                if (0 == (params.channels_bitmap_per_engine[engine_index] & (1U << channel_index))) {
+                    continue;
+                }
+
+                auto channel = get_channel(engine_index, channel_index);
+                if ((nullptr == channel) || (nullptr == channel->context)) {
+                    continue;
+                }
+
+                // Disabling a channel disables its whole context (the channels are always disabled together)
+                auto context = channel->context;
+                detach_context(*context);
+                m_contexts.remove_if([context](const Context &other) { return &other == context; });
+            }
+        }
+        m_channels_disable_count++;
+    }
+    m_cv.notify_all();
+    return 0;
+}
+
+void EmulatedDriver::schedule_transfer(Channel &channel, Transfer &transfer, Clock::time_point ready_time)
+{
+    const auto copy_time = (0 == m_latency_model.channel_bandwidth_mbps) ? std::chrono::nanoseconds(0) :
+        std::chrono::nanoseconds(transfer.size * 1000 / m_latency_model.channel_bandwidth_mbps);
+
+    transfer.start_time = std::max(ready_time, channel.busy_until);
+    channel.busy_until = transfer.start_time + copy_time;
+    transfer.complete_time = channel.busy_until + m_latency_model.transfer_latency;
+    transfer.is_scheduled = true;
+    channel.scheduled_pending++;
+}
+
+void EmulatedDriver::infer_ready_frames(Context &context)
+{
+    if (context.h2d_channels.empty()) {
+        return;
+    }
+
+    // A frame is inferred once all of its inputs arrived
+    while (std::all_of(context.pending_inputs.begin(), context.pending_inputs.end(),
+            [](const std::deque<Clock::time_point> &inputs) { return !inputs.empty(); })) {
+        auto inputs_ready = Clock::time_point::min();
+        for (auto &inputs : context.pending_inputs) {
+            inputs_ready = std::max(inputs_ready, inputs.front());
+            inputs.pop_front();
+        }
+
+        const auto start_time = std::max(inputs_ready, context.core_busy_until);
+        context.core_busy_until = start_time + m_latency_model.infer_latency;
+        if (!context.d2h_channels.empty()) {
+            context.inferred_frames.push_back(context.core_busy_until);
+        }
+    }
+}
+
+void EmulatedDriver::schedule_d2h_transfers(Context &context)
+{
+    const bool has_inputs = !context.h2d_channels.empty();
+    for (auto channel : context.d2h_channels) {
+        for (auto &transfer : channel->ongoing_transfers) {
+            if (transfer.is_scheduled) {
+                continue;
+            }
+
+            auto ready_time = transfer.launch_time;
+            if (has_inputs) {
+                const auto frame_offset = channel->frames_consumed - context.first_frame_index;
+                if (frame_offset >= context.inferred_frames.size()) {
+                    // The next frame was not inferred yet
+                    break;
+                }
+                ready_time = std::max(ready_time, context.inferred_frames[frame_offset]);
+            }
+
+            schedule_transfer(*channel, transfer, ready_time);
+            channel->frames_consumed++;
+        }
+    }
+
+    if (!has_inputs) {
+        return;
+    }
+
+    // Drop the frames all outputs were scheduled for
+    size_t min_frames_consumed = context.first_frame_index + context.inferred_frames.size();
+    for (auto channel : context.d2h_channels) {
+        min_frames_consumed = std::min(min_frames_consumed, channel->frames_consumed);
+    }
+    while (context.first_frame_index < min_frames_consumed) {
+        context.inferred_frames.pop_front();
+        context.first_frame_index++;
+    }
+}
+
+int EmulatedDriver::launch_transfer(hailo_vdma_launch_transfer_params &params)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        auto channel = get_channel(params.engine_index, params.channel_index);
+        const auto desc_list = m_desc_lists.find(params.desc_handle);
+        if ((nullptr == channel) || (m_desc_lists.end() == desc_list) ||
+            (params.starting_desc >= desc_list->second.desc_count) ||
+            (params.buffers_count > HAILO_MAX_BUFFERS_PER_SINGLE_TRANSFER)) {
+            return EINVAL;
+        }
+
+        size_t transfer_size = 0;
+        size_t descs_count = 0;
+        for (uint8_t i = 0; i < params.buffers_count; i++) {
+            const auto buffer = m_mapped_buffers.find(params.buffers[i].mapped_buffer_handle);
+            if ((m_mapped_buffers.end() == buffer) ||
+                (static_cast<size_t>(params.buffers[i].offset) + params.buffers[i].size > buffer->second)) {
+                return EINVAL;
+            }
+            transfer_size += params.buffers[i].size;
+            descs_count += DIV_ROUND_UP(params.buffers[i].size, desc_list->second.desc_page_size);
+        }
+        if ((0 == descs_count) || (descs_count > desc_list->second.desc_count)) {
+            return EINVAL;
+        }
+
+        if (nullptr == channel->context) {
+            // Same as the driver - the channel was disabled (or never enabled), the transfer is aborted
+            params.launch_transfer_status = -ECONNRESET;
+            return ECONNRESET;
+        }
+
+        Transfer transfer{};
+        transfer.size = transfer_size;
+        transfer.launch_time = Clock::now();
+        transfer.first_desc = static_cast<uint16_t>(params.starting_desc);
+        transfer.last_desc = static_cast<uint16_t>((params.starting_desc + descs_count - 1) %
+            desc_list->second.desc_count);
+        transfer.desc_list_size = desc_list->second.desc_count;
+        transfer.measure_first_desc = (0 != (params.first_interrupts_domain & HAILO_VDMA_INTERRUPTS_DOMAIN_HOST));
+        transfer.is_scheduled = false;
+
+        auto &context = *channel->context;
+        channel->ongoing_transfers.push_back(transfer);
+        if (channel->is_h2d) {
+            // Inputs are consumed by the device as soon as they arrive
+            auto &input_transfer = channel->ongoing_transfers.back();
+            schedule_transfer(*channel, input_transfer, input_transfer.launch_time);
+            context.pending_inputs[channel->input_index].push_back(input_transfer.complete_time);
+            infer_ready_frames(context);
+        }
+        schedule_d2h_transfers(context);
+
+        params.descs_programed = static_cast<uint32_t>(descs_count);
+        params.launch_transfer_status = 0;
+    }
+    m_cv.notify_all();
+    return 0;
+}
+
+static uint64_t to_timestamp_ns(std::chrono::steady_clock::time_point time)
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count());
+}
+
+int EmulatedDriver::vdma_interrupts_wait(hailo_vdma_interrupts_wait_params &params)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    const auto disable_count = m_channels_disable_count;
+    while (true) {
+        if (disable_count != m_channels_disable_count) {
+            // Channels were disabled, release the waiter (same as the driver)
+            params.channels_count = 0;
+            return 0;
+        }
+
+        const auto now = Clock::now();
+        auto next_completion = Clock::time_point::max();
+        uint8_t channels_count = 0;
+        bool has_enabled_channel = false;
+        for (uint8_t engine_index = 0; engine_index < DMA_ENGINES_COUNT; engine_index++) {
+            for (uint8_t channel_index = 0; channel_index < VDMA_CHANNELS_PER_ENGINE; channel_index++) {
+                if (0 == (params.channels_bitmap_per_engine[engine_index] & (1U << channel_index))) {
+                    continue;
+                }
+
+                auto &channel = m_channels[engine_index][channel_index];
+                has_enabled_channel |= (nullptr != channel.context);
+                uint8_t transfers_completed = 0;
+                while ((channel.scheduled_pending > 0) && (transfers_completed < UINT8_MAX)) {
+                    const auto &transfer = channel.ongoing_transfers.front();
+                    if (transfer.complete_time > now) {
+                        next_completion = std::min(next_completion, transfer.complete_time);
+                        break;
+                    }
+
+                    if (channel.measure_timestamps) {
+                        if (channel.is_h2d && transfer.measure_first_desc) {
+                            channel.timestamps.push_back({to_timestamp_ns(transfer.start_time),
+                                static_cast<uint16_t>((transfer.first_desc + 1) % transfer.desc_list_size)});
+                        }
+                        channel.timestamps.push_back({to_timestamp_ns(transfer.complete_time),
+                            static_cast<uint16_t>((transfer.last_desc + 1) % transfer.desc_list_size)});
+                        while (channel.timestamps.size() > CHANNEL_IRQ_TIMESTAMPS_SIZE) {
+                            channel.timestamps.pop_front();
+                        }
+                    }
+
+                    channel.ongoing_transfers.pop_front();
+                    channel.scheduled_pending--;
+                    transfers_completed++;
+                }
+
+                if (transfers_completed > 0) {
+                    auto &irq_data = params.irq_data[channels_count++];
+                    irq_data.engine_index = engine_index;
+                    irq_data.channel_index = channel_index;
+                    irq_data.is_active = true;
+                    irq_data.transfers_completed = transfers_completed;
+                    irq_data.host_error = 0;
+                    irq_data.device_error = 0;
+                    irq_data.validation_success = true;
+                }
+            }
+        }
+
+        if (channels_count > 0) {
+            params.channels_count = channels_count;
+            return 0;
+        }
+
+        if (!has_enabled_channel) {
+            // The channels were disabled before the wait started, nothing will wake it up (same as the driver)
+            params.channels_count = 0;
+            return 0;
+        }
+
+        if (Clock::time_point::max() == next_completion) {
+            m_cv.wait(lock);
+        } else {
+            m_cv.wait_until(lock, next_completion);
+        }
+    }
+}
+
+int EmulatedDriver::vdma_interrupts_read_timestamps(hailo_vdma_interrupts_read_timestamp_params &params)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto channel = get_channel(params.engine_index, params.channel_index);
+    if (nullptr == channel) {
+        return EINVAL;
+    }
+
+    params.timestamps_count = 0;
+    for (const auto &timestamp : channel->timestamps) {
+        params.timestamps[params.timestamps_count++] = timestamp;
+    }
+    channel->timestamps.clear();
+    return 0;
+}
+
+template<typename T>
+static size_t add_response_payload(uint8_t *response, size_t response_size, uint32_t parameter_count,
+    const T &parameters)
+{
+    auto payload = reinterpret_cast<CONTROL_PROTOCOL__payload_t*>(response + response_size);
+    payload->parameter_count = BYTE_ORDER__htonl(parameter_count);
+    memcpy(payload->parameters, &parameters, sizeof(parameters));
+    return response_size + sizeof(*payload) + sizeof(parameters);
+}
+
+template<size_t N>
+static void set_string_parameter(uint32_t &length, uint8_t (&data)[N], const char *value)
+{
+    // The fields are fixed sized, the string is padded with zeros
+    length = BYTE_ORDER__htonl(static_cast<uint32_t>(N));
+    memset(data, 0, N);
+    memcpy(data, value, std::min(N, strlen(value)));
+}
+
+static CONTROL_PROTOCOL_identify_response_t create_identify_response()
+{
+    CONTROL_PROTOCOL_identify_response_t identify{};
+    identify.protocol_version_length = BYTE_ORDER__htonl(sizeof(identify.protocol_version));
+    identify.protocol_version = BYTE_ORDER__htonl(CONTROL_PROTOCOL__PROTOCOL_VERSION);
+    identify.fw_version_length = BYTE_ORDER__htonl(sizeof(identify.fw_version));
+    identify.fw_version.firmware_major = FIRMWARE_VERSION_MAJOR;
+    identify.fw_version.firmware_minor = FIRMWARE_VERSION_MINOR;
+    identify.fw_version.firmware_revision = FIRMWARE_VERSION_REVISION;
+    identify.logger_version_length = BYTE_ORDER__htonl(sizeof(identify.logger_version));
+    identify.logger_version = 0;
+    set_string_parameter(identify.board_name_length, identify.board_name, EMULATED_BOARD_NAME);
+    identify.device_architecture_length = BYTE_ORDER__htonl(sizeof(identify.device_architecture));
+    identify.device_architecture = BYTE_ORDER__htonl(HAILO_ARCH_HAILO8);
+    set_string_parameter(identify.serial_number_length, identify.serial_number, EMULATED_SERIAL_NUMBER);
+    set_string_parameter(identify.part_number_length, identify.part_number, "");
+    set_string_parameter(identify.product_name_length, identify.product_name, EMULATED_PRODUCT_NAME);
+    return identify;
+}
+
+static CONTROL_PROTOCOL__get_hw_consts_response_t create_hw_consts_response()
+{
+    CONTROL_PROTOCOL__get_hw_consts_response_t hw_consts{};
+    hw_consts.hw_consts_length = BYTE_ORDER__htonl(sizeof(hw_consts.hw_consts));
+    // The emulated core has no fifos to overflow, so the values are the most permissive ones. The firmware sends this
+    // struct in host order.
+    hw_consts.hw_consts.fifo_word_granularity_bytes = 8;
+    hw_consts.hw_consts.max_periph_buffers_per_frame = 0x7FFF;
+    hw_consts.hw_consts.max_periph_bytes_per_buffer = 0xFFFF;
+    hw_consts.hw_consts.max_acceptable_bytes_per_buffer = 0xFFFF;
+    hw_consts.hw_consts.outbound_data_stream_size = 0x20000;
+    hw_consts.hw_consts.should_optimize_credits = false;
+    hw_consts.hw_consts.default_initial_credit_size = 0x800;
+    return hw_consts;
+}
+
+static CONTROL_PROTOCOL__get_extended_device_information_response_t create_extended_device_information_response()
+{
+    CONTROL_PROTOCOL__get_extended_device_information_response_t info{};
+    info.neural_network_core_clock_rate_length = BYTE_ORDER__htonl(sizeof(info.neural_network_core_clock_rate));
+    info.neural_network_core_clock_rate = BYTE_ORDER__htonl(HAILO8_CLOCK_RATE);
+    info.supported_features_length = BYTE_ORDER__htonl(sizeof(info.supported_features));
+    // Parsed with ntohl, as a 32 bit value
+    info.supported_features = BYTE_ORDER__htonl(1 << CONTROL_PROTOCOL__SUPPORTED_FEATURES_PCIE_BIT_OFFSET);
+    info.boot_source_length = BYTE_ORDER__htonl(sizeof(info.boot_source));
+    info.boot_source = BYTE_ORDER__htonl(CONTROL_PROTOCOL__BOOT_SOURCE_PCIE);
+    info.lcs_length = BYTE_ORDER__htonl(sizeof(info.lcs));
+    info.soc_id_length = BYTE_ORDER__htonl(sizeof(info.soc_id));
+    info.eth_mac_length = BYTE_ORDER__htonl(sizeof(info.eth_mac_address));
+    info.fuse_info_length = BYTE_ORDER__htonl(sizeof(info.fuse_info));
+    info.pd_info_length = BYTE_ORDER__htonl(sizeof(info.pd_info));
+    info.partial_clusters_layout_bitmap_length = BYTE_ORDER__htonl(sizeof(info.partial_clusters_layout_bitmap));
+    return info;
+}
+
+static bool is_acked_without_payload(uint32_t opcode)
+{
+    switch (opcode) {
+    case HAILO_CONTROL_OPCODE_WRITE_MEMORY:
+    case HAILO_CONTROL_OPCODE_NN_CORE_LATENCY_MEASUREMENT_CONFIG:
+    case HAILO_CONTROL_OPCODE_CONTEXT_SWITCH_SET_NETWORK_GROUP_HEADER:
+    case HAILO_CONTROL_OPCODE_CONTEXT_SWITCH_SET_CONTEXT_INFO:
+    case HAILO_CONTROL_OPCODE_IDLE_TIME_SET_MEASUREMENT:
+    case HAILO_CONTROL_OPCODE_CHANGE_CONTEXT_SWITCH_STATUS:
+    case HAILO_CONTROL_OPCODE_APP_WD_ENABLE:
+    case HAILO_CONTROL_OPCODE_APP_WD_CONFIG:
+    case HAILO_CONTROL_OPCODE_SET_DATAFLOW_INTERRUPT:
+    case HAILO_CONTROL_OPCODE_D2H_EVENT_MANAGER_SET_HOST_INFO:
+    case HAILO_CONTROL_OPCODE_D2H_EVENT_MANAGER_SEND_EVENT_HOST_INFO:
+    case HAILO_CONTROL_OPCODE_CONFIG_CONTEXT_SWITCH_BREAKPOINT:
+    case HAILO_CONTROL_OPCODE_SET_FW_LOGGER:
+    case HAILO_CONTROL_OPCODE_SET_PAUSE_FRAMES:
+    case HAILO_CONTROL_OPCODE_CONFIG_CONTEXT_SWITCH_TIMESTAMP:
+    case HAILO_CONTROL_OPCODE_SET_CLOCK_FREQ:
+    case HAILO_CONTROL_OPCODE_SET_THROTTLING_STATE:
+    case HAILO_CONTROL_OPCODE_SET_OVERCURRENT_STATE:
+    case HAILO_CONTROL_OPCODE_CORE_WD_ENABLE:
+    case HAILO_CONTROL_OPCODE_CORE_WD_CONFIG:
+    case HAILO_CONTROL_OPCODE_CONTEXT_SWITCH_CLEAR_CONFIGURED_APPS:
+    case HAILO_CONTROL_OPCODE_SET_SLEEP_STATE:
+    case HAILO_CONTROL_OPCODE_SIGNAL_DRIVER_DOWN:
+    case HAILO_CONTROL_OPCODE_CONTEXT_SWITCH_INIT_CACHE_INFO:
+    case HAILO_CONTROL_OPCODE_CONTEXT_SWITCH_UPDATE_CACHE_READ_OFFSET:
+    case HAILO_CONTROL_OPCODE_CONTEXT_SWITCH_SIGNAL_CACHE_UPDATED:
+        return true;
+    default:
+        return false;
+    }
+}
+
+size_t EmulatedDriver::build_control_response(const uint8_t *request, size_t request_size, uint8_t *response)
+{
+    if (request_size < sizeof(CONTROL_PROTOCOL__request_header_t)) {
+        return 0;
+    }
+    const auto request_header = reinterpret_cast<const CONTROL_PROTOCOL__request_header_t*>(request);
+    const auto opcode = BYTE_ORDER__ntohl(request_header->common_header.opcode);
+
+    auto response_header = reinterpret_cast<CONTROL_PROTOCOL__response_header_t*>(response);
+    memset(response_header, 0, sizeof(*response_header));
+    response_header->common_header.version = request_header->common_header.version;
+    response_header->common_header.sequence = request_header->common_header.sequence;
+    response_header->common_header.opcode = request_header->common_header.opcode;
+    CONTROL_PROTOCOL_flags_t flags{};
+    flags.bitstruct.ack = CONTROL_PROTOCOL__ACK_SET;
+    response_header->common_header.flags.integer = BYTE_ORDER__htonl(flags.integer);
+
+    const size_t response_size = sizeof(*response_header);
+    switch (opcode) {
+    case HAILO_CONTROL_OPCODE_IDENTIFY:
+        return add_response_payload(response, response_size, 8, create_identify_response());
+    case HAILO_CONTROL_OPCODE_GET_HW_CONSTS:
+        return add_response_payload(response, response_size, 1, create_hw_consts_response());
+    case HAILO_CONTROL_OPCODE_GET_DEVICE_INFORMATION:
+        return add_response_payload(response, response_size, 9, create_extended_device_information_response());
+    default:
+        if (!is_acked_without_payload(opcode)) {
+            LOGGER__WARNING("Control opcode {} is not supported by the emulated device", opcode);
+            response_header->status.major_status = BYTE_ORDER__htonl(CONTROL_PROTOCOL_STATUS_CONTROL_UNSUPPORTED);
+        }
+        return response_size;
+    }
+}
+
+int EmulatedDriver::fw_control(hailo_fw_control &params)
+{
+    if (m_latency_model.control_latency.count() > 0) {
+        std::this_thread::sleep_for(m_latency_model.control_latency);
+    }
+
+    if (params.buffer_len > sizeof(params.buffer)) {
+        return EINVAL;
+    }
+
+    uint8_t response[MAX_CONTROL_LENGTH] = {};
+    const auto response_size = build_control_response(params.buffer, params.buffer_len, response);
+    if (0 == response_size) {
+        return EINVAL;
+    }
+
+    memcpy(params.buffer, response, response_size);
+    params.buffer_len = static_cast<uint32_t>(response_size);
+
+    MD5_CTX ctx;
+    MD5_Init(&ctx);
+    MD5_Update(&ctx, params.buffer, response_size);
+    MD5_Final(params.expected_md5, &ctx);
+    return 0;
+}
+
+int EmulatedDriver::read_notification(hailo_d2h_notification &/* params */)
+{
+    // The emulated firmware never sends notifications, block until notifications are disabled
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_notifications_cv.wait(lock, [this]() { return m_notifications_disabled; });
+    return ECANCELED;
+}
+
+int EmulatedDriver::disable_notification()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_notifications_disabled = true;
+    }
+    m_notifications_cv.notify_all();
+    return 0;
+}
+
+int EmulatedDriver::read_log(hailo_read_log_params &params)
+{
+    params.read_bytes = 0;
+    return 0;
+}
+
+int EmulatedDriver::mark_as_in_use(hailo_mark_as_in_use_params &params)
+{
+    // Each emulated driver is a device of its own
+    params.in_use = false;
+    return 0;
+}
+
+} /* namespace hailort */
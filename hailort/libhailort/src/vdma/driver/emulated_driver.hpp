@@ -0,0 +1,173 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file emulated_driver.hpp
+ * @brief In process emulation of the hailo driver, used to run the runtime without a device.
+ *
+ * The emulated device is a Hailo-8 connected over PCIe, with the firmware already loaded. The controls are answered
+ * by a minimal fake firmware, and the vDMA transfers are completed according to a latency model. The buffers are
+ * never accessed, so the outputs hold no meaningful data. The latency model:
+ *  - Each transfer occupies its channel for size/bandwidth, and completes after an additional fixed latency.
+ *  - The channels enabled together (the boundary channels of a core-op) form a context. The n-th transfer on a D2H
+ *    channel of a context waits for the n-th transfer on each of the context's H2D channels, and for the context
+ *    to infer that frame. Frames are inferred one after the other, each for the inference latency.
+ * The model assumes a single transfer per frame on each channel.
+ **/
+
+#ifndef _HAILO_EMULATED_DRIVER_HPP_
+#define _HAILO_EMULATED_DRIVER_HPP_
+
+#include "hailo/hailort.h"
+#include "hailo/expected.hpp"
+
+#include "vdma/driver/hailort_driver.hpp"
+#include "hailo_ioctl_common.h"
+
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <deque>
+#include <list>
+#include <unordered_map>
+
+
+namespace hailort
+{
+
+#define EMULATED_DRIVER_TRANSFER_LATENCY_US_ENV_VAR ("HAILO_EMULATED_DRIVER_TRANSFER_LATENCY_US")
+#define EMULATED_DRIVER_BANDWIDTH_MBPS_ENV_VAR ("HAILO_EMULATED_DRIVER_BANDWIDTH_MBPS")
+#define EMULATED_DRIVER_INFER_LATENCY_US_ENV_VAR ("HAILO_EMULATED_DRIVER_INFER_LATENCY_US")
+#define EMULATED_DRIVER_CONTROL_LATENCY_US_ENV_VAR ("HAILO_EMULATED_DRIVER_CONTROL_LATENCY_US")
+
+struct EmulatedLatencyModel {
+    // Added to each transfer, after it was copied over the channel
+    std::chrono::nanoseconds transfer_latency;
+    // Bandwidth of each channel, in MB/s. 0 means the copy takes no time.
+    uint32_t channel_bandwidth_mbps;
+    // Time it takes a context to infer a single frame
+    std::chrono::nanoseconds infer_latency;
+    // Time it takes the firmware to answer a control
+    std::chrono::nanoseconds control_latency;
+
+    // The default model, overridden by the EMULATED_DRIVER_*_ENV_VAR environment variables
+    static Expected<EmulatedLatencyModel> create_from_env();
+};
+
+class EmulatedDriver final
+{
+public:
+    static Expected<std::unique_ptr<EmulatedDriver>> create();
+
+    explicit EmulatedDriver(const EmulatedLatencyModel &latency_model);
+
+    EmulatedDriver(const EmulatedDriver &other) = delete;
+    EmulatedDriver &operator=(const EmulatedDriver &other) = delete;
+    EmulatedDriver(EmulatedDriver &&other) = delete;
+    EmulatedDriver &operator=(EmulatedDriver &&other) = delete;
+
+    // Runs the ioctl in process, returns errno value (or 0 on success) - same as run_hailo_ioctl
+    int run_ioctl(uint32_t ioctl_code, void *param);
+
+    static constexpr uint16_t DESC_MAX_PAGE_SIZE = 4096;
+    static constexpr size_t DMA_ENGINES_COUNT = 1;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct DescList {
+        size_t desc_count;
+        uint16_t desc_page_size;
+    };
+
+    struct Transfer {
+        size_t size;
+        Clock::time_point launch_time;
+        uint16_t first_desc;
+        uint16_t last_desc;
+        // Size of the descriptors list the transfer was launched on
+        size_t desc_list_size;
+        bool measure_first_desc;
+        // Known once the transfer is scheduled (D2H transfers wait for their frame to be inferred)
+        bool is_scheduled;
+        Clock::time_point start_time;
+        Clock::time_point complete_time;
+    };
+
+    struct Context;
+
+    struct Channel {
+        bool is_h2d = true;
+        Context *context = nullptr;
+        bool measure_timestamps = false;
+        // Index of the channel in the context h2d_channels/pending_inputs
+        size_t input_index = 0;
+        // Ongoing transfers, ordered. The scheduled ones are a prefix of the queue.
+        std::deque<Transfer> ongoing_transfers;
+        size_t scheduled_pending = 0;
+        // Number of frames (of the context) the channel has scheduled transfers for
+        size_t frames_consumed = 0;
+        Clock::time_point busy_until;
+        std::deque<hailo_channel_interrupt_timestamp> timestamps;
+    };
+
+    struct Context {
+        std::vector<Channel*> h2d_channels;
+        std::vector<Channel*> d2h_channels;
+        // Completion times of the inputs that were not inferred yet, per H2D channel
+        std::vector<std::deque<Clock::time_point>> pending_inputs;
+        // Times the frames were inferred at, from frame number first_frame_index
+        std::deque<Clock::time_point> inferred_frames;
+        size_t first_frame_index = 0;
+        Clock::time_point core_busy_until;
+    };
+
+    int query_driver_info(hailo_driver_info &params);
+    int query_device_properties(hailo_device_properties &params);
+    int memory_transfer(hailo_memory_transfer_params &params);
+    int vdma_enable_channels(const hailo_vdma_enable_channels_params &params);
+    int vdma_disable_channels(const hailo_vdma_disable_channels_params &params);
+    int vdma_interrupts_wait(hailo_vdma_interrupts_wait_params &params);
+    int vdma_interrupts_read_timestamps(hailo_vdma_interrupts_read_timestamp_params &params);
+    int vdma_buffer_map(hailo_vdma_buffer_map_params &params);
+    int vdma_buffer_unmap(const hailo_vdma_buffer_unmap_params &params);
+    int descriptors_list_create(hailo_desc_list_create_params &params);
+    int descriptors_list_release(const hailo_desc_list_release_params &params);
+    int descriptors_list_program(const hailo_desc_list_program_params &params);
+    int launch_transfer(hailo_vdma_launch_transfer_params &params);
+    int fw_control(hailo_fw_control &params);
+    int read_notification(hailo_d2h_notification &params);
+    int disable_notification();
+    int read_log(hailo_read_log_params &params);
+    int mark_as_in_use(hailo_mark_as_in_use_params &params);
+
+    Channel *get_channel(uint8_t engine_index, uint8_t channel_index);
+    void schedule_transfer(Channel &channel, Transfer &transfer, Clock::time_point ready_time);
+    void infer_ready_frames(Context &context);
+    void schedule_d2h_transfers(Context &context);
+    void detach_context(Context &context);
+    size_t build_control_response(const uint8_t *request, size_t request_size, uint8_t *response);
+
+    const EmulatedLatencyModel m_latency_model;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+
+    uintptr_t m_next_handle;
+    std::unordered_map<size_t, size_t> m_mapped_buffers;
+    std::unordered_map<uintptr_t, DescList> m_desc_lists;
+
+    std::array<std::array<Channel, VDMA_CHANNELS_PER_ENGINE>, MAX_VDMA_ENGINES_COUNT> m_channels;
+    std::list<Context> m_contexts;
+    // Increased on each channels disable, to release the interrupts waiters
+    uint64_t m_channels_disable_count;
+
+    // Set once notifications are disabled, to release the notifications reader
+    bool m_notifications_disabled;
+    std::condition_variable m_notifications_cv;
+};
+
+} /* namespace hailort */
+
+#endif /* _HAILO_EMULATED_DRIVER_HPP_ */
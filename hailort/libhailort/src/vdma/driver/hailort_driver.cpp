@@ -8,6 +8,7 @@
  **/
 
 #include "vdma/driver/hailort_driver.hpp"
+#include "vdma/driver/emulated_driver.hpp"
 #include "vdma/driver/os/driver_os_specific.hpp"
 
 #include "common/logger_macros.hpp"
@@ -186,6 +187,25 @@ Expected<std::unique_ptr<HailoRTDriver>> HailoRTDriver::create_pcie_ep()
     return create(PCIE_EP_DEVICE_ID, PCIE_EP_DRIVER_PATH);
 }
 
+Expected<std::unique_ptr<HailoRTDriver>> HailoRTDriver::create_emulated()
+{
+    TRY(auto emulated_driver, EmulatedDriver::create());
+
+#if defined(_WIN32)
+    FileDescriptor fd(INVALID_HANDLE_VALUE);
+#else
+    FileDescriptor fd(-1);
+#endif
+
+    hailo_status status = HAILO_UNINITIALIZED;
+    std::unique_ptr<HailoRTDriver> driver(new (std::nothrow) HailoRTDriver(EMULATED_DEVICE_ID, std::move(fd),
+        std::move(emulated_driver), status));
+    CHECK_NOT_NULL_AS_EXPECTED(driver, HAILO_OUT_OF_HOST_MEMORY);
+    CHECK_SUCCESS_AS_EXPECTED(status);
+
+    return driver;
+}
+
 bool HailoRTDriver::is_pcie_ep_loaded()
 {
 #if defined(_MSC_VER)
@@ -211,7 +231,13 @@ static hailo_status validate_driver_version(const hailo_driver_info &driver_info
 }
 
 HailoRTDriver::HailoRTDriver(const std::string &device_id, FileDescriptor &&fd, hailo_status &status) :
+    HailoRTDriver(device_id, std::move(fd), nullptr, status)
+{}
+
+HailoRTDriver::HailoRTDriver(const std::string &device_id, FileDescriptor &&fd,
+    std::unique_ptr<EmulatedDriver> &&emulated_driver, hailo_status &status) :
     m_fd(std::move(fd)),
+    m_emulated_driver(std::move(emulated_driver)),
     m_device_id(device_id),
     m_allocate_driver_buffer(false)
 {
@@ -863,6 +889,10 @@ static bool is_blocking_ioctl(unsigned long request)
 template<typename PointerType>
 int HailoRTDriver::run_ioctl(uint32_t ioctl_code, PointerType param)
 {
+    if (m_emulated_driver) {
+        return m_emulated_driver->run_ioctl(ioctl_code, static_cast<void*>(param));
+    }
+
     // We lock m_driver lock on all request but the blocking onces. Read m_driver_lock doc in the header
     std::unique_lock<std::mutex> lock;
     if (!is_blocking_ioctl(ioctl_code)) {
@@ -876,6 +906,10 @@ int HailoRTDriver::run_ioctl(uint32_t ioctl_code, PointerType param)
 template<typename PointerType>
 int HailoRTDriver::run_ioctl(uint32_t ioctl_code, PointerType param)
 {
+    if (m_emulated_driver) {
+        return m_emulated_driver->run_ioctl(ioctl_code, static_cast<void*>(param));
+    }
+
     return run_hailo_ioctl(m_fd, ioctl_code, param);
 }
 #else
@@ -127,6 +127,8 @@ inline InterruptsDomain& operator|=(InterruptsDomain &a, InterruptsDomain b)
     return a;
 }
 
+class EmulatedDriver;
+
 class HailoRTDriver final
 {
 public:
@@ -205,6 +207,9 @@ public:
     static Expected<std::unique_ptr<HailoRTDriver>> create_pcie_ep();
     static bool is_pcie_ep_loaded();
 
+    // Creates a driver backed by an in process emulation of a device (see EmulatedDriver), no device is needed.
+    static Expected<std::unique_ptr<HailoRTDriver>> create_emulated();
+
     static Expected<std::vector<DeviceInfo>> scan_devices();
     static Expected<std::vector<DeviceInfo>> scan_devices(AcceleratorType accelerator_type);
 
@@ -379,6 +384,7 @@ public:
 
     static constexpr const char *INTEGRATED_NNC_DEVICE_ID = "[integrated]";
     static constexpr const char *PCIE_EP_DEVICE_ID = "[pci_ep]";
+    static constexpr const char *EMULATED_DEVICE_ID = "[emulated]";
 
 private:
     template<typename PointerType>
@@ -398,6 +404,8 @@ private:
     hailo_status continous_buffer_munmap(void *address, size_t size);
 
     HailoRTDriver(const std::string &device_id, FileDescriptor &&fd, hailo_status &status);
+    HailoRTDriver(const std::string &device_id, FileDescriptor &&fd, std::unique_ptr<EmulatedDriver> &&emulated_driver,
+        hailo_status &status);
 
     bool is_valid_channel_id(const vdma::ChannelId &channel_id);
     bool is_valid_channels_bitmap(const ChannelsBitmap &bitmap)
@@ -413,6 +421,8 @@ private:
     }
 
     FileDescriptor m_fd;
+    // When set, the ioctls are served in process by the emulated driver (and m_fd is invalid)
+    std::unique_ptr<EmulatedDriver> m_emulated_driver;
     DeviceInfo m_device_info;
     std::string m_device_id;
     uint16_t m_desc_max_page_size;
@@ -74,6 +74,17 @@ Expected<std::unique_ptr<PcieDevice>> PcieDevice::create(const hailo_pcie_device
     return device;
 }
 
+Expected<std::unique_ptr<PcieDevice>> PcieDevice::create_emulated()
+{
+    TRY(auto driver, HailoRTDriver::create_emulated());
+
+    hailo_status status = HAILO_UNINITIALIZED;
+    auto device = std::unique_ptr<PcieDevice>(new (std::nothrow) PcieDevice(std::move(driver), status));
+    CHECK_AS_EXPECTED((nullptr != device), HAILO_OUT_OF_HOST_MEMORY);
+    CHECK_SUCCESS_AS_EXPECTED(status, "Failed creating emulated PcieDevice");
+    return device;
+}
+
 // same format as in lspci - [<domain>].<bus>.<device>.<func> 
 // domain (0 to ffff) bus (0 to ff), device (0 to 1f) and function (0 to 7).
 static const char *DEVICE_ID_STRING_FMT_SHORT = "%02x:%02x.%d";
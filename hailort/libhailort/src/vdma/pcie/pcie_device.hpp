@@ -26,6 +26,8 @@ public:
     static Expected<std::vector<hailo_pcie_device_info_t>> scan();
     static Expected<std::unique_ptr<PcieDevice>> create();
     static Expected<std::unique_ptr<PcieDevice>> create(const hailo_pcie_device_info_t &device_info);
+    // Creates a pcie device over the emulated driver (device id HailoRTDriver::EMULATED_DEVICE_ID)
+    static Expected<std::unique_ptr<PcieDevice>> create_emulated();
     static Expected<hailo_pcie_device_info_t> parse_pcie_device_info(const std::string &device_info_str,
         bool log_on_failure);
     static Expected<std::string> pcie_device_info_to_string(const hailo_pcie_device_info_t &device_info);
@@ -49,10 +49,11 @@ Expected<PcieSession> PcieSession::create(std::shared_ptr<HailoRTDriver> driver,
 
     TRY(auto interrupts_dispatcher, vdma::InterruptsDispatcher::create(*driver));
     TRY(auto transfer_launcher, vdma::TransferLauncher::create());
+    TRY(auto completion_executor, vdma::CompletionExecutor::create());
 
     auto create_channel = [&](vdma::ChannelId id, vdma::BoundaryChannel::Direction dir, vdma::DescriptorList &&desc_list) {
         return vdma::BoundaryChannel::create(*driver, id, dir, std::move(desc_list), *transfer_launcher,
-            MAX_ONGOING_TRANSFERS);
+            *completion_executor, MAX_ONGOING_TRANSFERS);
     };
 
     TRY(auto input_channel, create_channel(input_channel_id, vdma::BoundaryChannel::Direction::H2D, std::move(input_desc_list)));
@@ -65,7 +66,7 @@ Expected<PcieSession> PcieSession::create(std::shared_ptr<HailoRTDriver> driver,
     CHECK_SUCCESS(output_channel->activate());
 
     return PcieSession(std::move(driver), std::move(interrupts_dispatcher), std::move(transfer_launcher),
-        std::move(input_channel), std::move(output_channel), session_type);
+        std::move(completion_executor), std::move(input_channel), std::move(output_channel), session_type);
 }
 
 hailo_status PcieSession::write(const void *buffer, size_t size, std::chrono::milliseconds timeout)
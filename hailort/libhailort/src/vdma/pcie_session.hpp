@@ -15,6 +15,7 @@
 #include "vdma/channel/boundary_channel.hpp"
 #include "vdma/channel/interrupts_dispatcher.hpp"
 #include "vdma/channel/transfer_launcher.hpp"
+#include "vdma/channel/completion_executor.hpp"
 
 namespace hailort
 {
@@ -84,10 +85,12 @@ private:
     PcieSession(std::shared_ptr<HailoRTDriver> &&driver,
         std::unique_ptr<vdma::InterruptsDispatcher> &&interrupts_dispatcher,
         std::unique_ptr<vdma::TransferLauncher> &&transfer_launcher,
+        std::unique_ptr<vdma::CompletionExecutor> &&completion_executor,
         vdma::BoundaryChannelPtr &&input, vdma::BoundaryChannelPtr &&output, PcieSessionType session_type) :
         m_driver(std::move(driver)),
         m_interrupts_dispatcher(std::move(interrupts_dispatcher)),
         m_transfer_launcher(std::move(transfer_launcher)),
+        m_completion_executor(std::move(completion_executor)),
         m_input(std::move(input)),
         m_output(std::move(output)),
         m_session_type(session_type)
@@ -103,6 +106,8 @@ private:
 
     std::unique_ptr<vdma::InterruptsDispatcher> m_interrupts_dispatcher;
     std::unique_ptr<vdma::TransferLauncher> m_transfer_launcher;
+    // Must outlive the channels, which enqueue their callbacks to it
+    std::unique_ptr<vdma::CompletionExecutor> m_completion_executor;
 
     vdma::BoundaryChannelPtr m_input;
     vdma::BoundaryChannelPtr m_output;
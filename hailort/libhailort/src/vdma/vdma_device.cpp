@@ -21,6 +21,7 @@
 #include "common/os_utils.hpp"
 #include "utils/buffer_storage.hpp"
 #include "hef/hef_internal.hpp"
+#include "utils/profiler/tracer_macros.hpp"
 
 #include <new>
 #include <algorithm>
@@ -53,6 +54,11 @@ Expected<std::unique_ptr<VdmaDevice>> VdmaDevice::create(const std::string &devi
         CHECK_EXPECTED(device);;
         return std::unique_ptr<VdmaDevice>(device.release());
     }
+    else if (HailoRTDriver::EMULATED_DEVICE_ID == device_id) {
+        auto device = PcieDevice::create_emulated();
+        CHECK_EXPECTED(device);
+        return std::unique_ptr<VdmaDevice>(device.release());
+    }
     else if (auto pcie_info = PcieDevice::parse_pcie_device_info(device_id, DONT_LOG_ON_FAILURE)) {
         auto device = PcieDevice::create(pcie_info.release());
         CHECK_EXPECTED(device);
@@ -156,6 +162,9 @@ Expected<ConfiguredNetworkGroupVector> VdmaDevice::add_hef(Hef &hef, const Netwo
         assert(nullptr == m_vdma_transfer_launcher);
         TRY(m_vdma_transfer_launcher, vdma::TransferLauncher::create());
 
+        assert(nullptr == m_vdma_completion_executor);
+        TRY(m_vdma_completion_executor, vdma::CompletionExecutor::create());
+
         m_is_configured = true;
     }
 
@@ -258,6 +267,12 @@ ExpectedRef<vdma::TransferLauncher> VdmaDevice::get_vdma_transfer_launcher()
     return std::ref(*m_vdma_transfer_launcher);
 }
 
+ExpectedRef<vdma::CompletionExecutor> VdmaDevice::get_vdma_completion_executor()
+{
+    CHECK_AS_EXPECTED(m_vdma_completion_executor, HAILO_INTERNAL_FAILURE, "vDMA completion executor wasn't created");
+    return std::ref(*m_vdma_completion_executor);
+}
+
 VdmaDevice::~VdmaDevice()
 {
     auto status = stop_notification_fetch_thread();
@@ -270,6 +285,10 @@ VdmaDevice::~VdmaDevice()
             LOGGER__WARNING("clear configured apps ended with status {}", status);
         }
     }
+    if (m_vdma_completion_executor) {
+        TRACE(CompletionExecutorStatsTrace, get_dev_id(), m_vdma_completion_executor->threads_count(),
+            m_vdma_completion_executor->queue_depth(), m_vdma_completion_executor->max_queue_depth());
+    }
 }
 
 static std::pair<void *, size_t> aligned_part_to_map(void *original, size_t size)
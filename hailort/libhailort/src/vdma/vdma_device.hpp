@@ -18,6 +18,7 @@
 #include "network_group/network_group_internal.hpp"
 #include "vdma/channel/interrupts_dispatcher.hpp"
 #include "vdma/channel/transfer_launcher.hpp"
+#include "vdma/channel/completion_executor.hpp"
 #include "vdma/driver/hailort_driver.hpp"
 #include "core_op/resource_manager/cache_manager.hpp"
 
@@ -50,6 +51,7 @@ public:
 
     ExpectedRef<vdma::InterruptsDispatcher> get_vdma_interrupts_dispatcher();
     ExpectedRef<vdma::TransferLauncher> get_vdma_transfer_launcher();
+    ExpectedRef<vdma::CompletionExecutor> get_vdma_completion_executor();
 
     virtual hailo_status dma_map(void *address, size_t size, hailo_dma_buffer_direction_t direction) override;
     virtual hailo_status dma_unmap(void *address, size_t size, hailo_dma_buffer_direction_t direction) override;
@@ -71,6 +73,10 @@ protected:
     std::vector<std::shared_ptr<CoreOp>> m_core_ops;
     std::vector<std::shared_ptr<ConfiguredNetworkGroup>> m_network_groups; // TODO: HRT-9547 - Remove when ConfiguredNetworkGroup will be kept in global context
 
+    // Runs the transfers callbacks enqueued by the interrupts dispatcher, hence it must be destroyed after it.
+    // Destroying it calls all of the callbacks still queued.
+    std::unique_ptr<vdma::CompletionExecutor> m_vdma_completion_executor;
+
     // The vdma interrupts dispatcher contains a callback with a reference to the current activated network group
     // (reference to the ResourcesManager). Hence, it must be destroyed before the networks groups are destroyed.
     std::unique_ptr<vdma::InterruptsDispatcher> m_vdma_interrupts_dispatcher;
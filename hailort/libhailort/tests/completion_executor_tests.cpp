@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file completion_executor_tests.cpp
+ * @brief Tests of the vdma completion executor
+ **/
+
+#include "vdma/channel/completion_executor.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+using namespace hailort;
+using namespace hailort::vdma;
+
+TEST_CASE("Completion executor - invalid threads count", "[completion_executor]")
+{
+    CHECK(HAILO_INVALID_ARGUMENT == CompletionExecutor::create(CompletionExecutor::MAX_THREADS_COUNT + 1).status());
+}
+
+TEST_CASE("Completion executor - inline", "[completion_executor]")
+{
+    auto executor = CompletionExecutor::create(0);
+    REQUIRE(executor);
+    CHECK(0 == executor.value()->threads_count());
+
+    const auto caller_thread = std::this_thread::get_id();
+    std::thread::id completion_thread;
+    executor.value()->enqueue(0, [&completion_thread]() { completion_thread = std::this_thread::get_id(); });
+    // Ran before enqueue returned, on the enqueuing thread
+    CHECK(caller_thread == completion_thread);
+    executor.value()->wait_for_idle(0);
+}
+
+TEST_CASE("Completion executor - per key ordering", "[completion_executor]")
+{
+    static const size_t KEYS_COUNT = 5;
+    static const size_t COMPLETIONS_PER_KEY = 1000;
+
+    auto executor = CompletionExecutor::create(3);
+    REQUIRE(executor);
+    CHECK(3 == executor.value()->threads_count());
+
+    std::mutex mutex;
+    std::vector<std::vector<size_t>> order(KEYS_COUNT);
+    for (size_t i = 0; i < COMPLETIONS_PER_KEY; i++) {
+        for (size_t key = 0; key < KEYS_COUNT; key++) {
+            executor.value()->enqueue(key, [&mutex, &order, key, i]() {
+                std::lock_guard<std::mutex> lock(mutex);
+                order[key].push_back(i);
+            });
+        }
+    }
+
+    for (size_t key = 0; key < KEYS_COUNT; key++) {
+        executor.value()->wait_for_idle(key);
+        std::lock_guard<std::mutex> lock(mutex);
+        REQUIRE(COMPLETIONS_PER_KEY == order[key].size());
+        for (size_t i = 0; i < COMPLETIONS_PER_KEY; i++) {
+            REQUIRE(i == order[key][i]);
+        }
+    }
+}
+
+TEST_CASE("Completion executor - wait for idle from a completion", "[completion_executor]")
+{
+    auto executor = CompletionExecutor::create(2);
+    REQUIRE(executor);
+    auto &executor_ref = *executor.value();
+
+    // Would deadlock if wait_for_idle waited for the completion it is called from
+    std::atomic<bool> called(false);
+    executor_ref.enqueue(0, [&executor_ref, &called]() {
+        executor_ref.wait_for_idle(0);
+        called = true;
+    });
+    executor_ref.wait_for_idle(0);
+    CHECK(called);
+}
+
+TEST_CASE("Completion executor - wait for idle across threads from completions", "[completion_executor]")
+{
+    auto executor = CompletionExecutor::create(2);
+    REQUIRE(executor);
+    auto &executor_ref = *executor.value();
+
+    // Keys 0 and 1 run on different threads, each completion waits for the other key - would deadlock if
+    // wait_for_idle waited on another executor thread
+    std::atomic<size_t> calls_count(0);
+    for (size_t i = 0; i < 100; i++) {
+        executor_ref.enqueue(0, [&executor_ref, &calls_count]() {
+            executor_ref.wait_for_idle(1);
+            calls_count++;
+        });
+        executor_ref.enqueue(1, [&executor_ref, &calls_count]() {
+            executor_ref.wait_for_idle(0);
+            calls_count++;
+        });
+    }
+    executor_ref.wait_for_idle(0);
+    executor_ref.wait_for_idle(1);
+    CHECK(200 == calls_count);
+}
+
+TEST_CASE("Completion executor - queue depth", "[completion_executor]")
+{
+    auto executor = CompletionExecutor::create(1);
+    REQUIRE(executor);
+    auto &executor_ref = *executor.value();
+    CHECK(0 == executor_ref.queue_depth());
+    CHECK(0 == executor_ref.max_queue_depth());
+
+    // The first completion holds the thread until all were enqueued
+    std::mutex mutex;
+    std::unique_lock<std::mutex> lock(mutex);
+    executor_ref.enqueue(0, [&mutex]() { std::lock_guard<std::mutex> completion_lock(mutex); });
+    for (size_t i = 0; i < 9; i++) {
+        executor_ref.enqueue(0, []() {});
+    }
+    CHECK(10 >= executor_ref.queue_depth());
+    CHECK(9 <= executor_ref.queue_depth());
+    lock.unlock();
+
+    executor_ref.wait_for_idle(0);
+    CHECK(0 == executor_ref.queue_depth());
+    CHECK(10 >= executor_ref.max_queue_depth());
+    CHECK(9 <= executor_ref.max_queue_depth());
+}
+
+TEST_CASE("Completion executor - destruction drains the queue", "[completion_executor]")
+{
+    std::atomic<size_t> calls_count(0);
+    {
+        auto executor = CompletionExecutor::create(1);
+        REQUIRE(executor);
+        for (size_t i = 0; i < 100; i++) {
+            executor.value()->enqueue(i, [&calls_count]() { calls_count++; });
+        }
+    }
+    CHECK(100 == calls_count);
+}
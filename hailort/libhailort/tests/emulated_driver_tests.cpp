@@ -0,0 +1,175 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file emulated_driver_tests.cpp
+ * @brief Tests of the emulated driver's vdma channels
+ **/
+
+#include "vdma/driver/emulated_driver.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <thread>
+#include <future>
+
+using namespace hailort;
+using namespace std::chrono_literals;
+
+static const uint8_t H2D_CHANNEL_INDEX = 0;
+static const uint8_t D2H_CHANNEL_INDEX = VDMA_DEST_CHANNELS_START;
+static const uint32_t TRANSFER_SIZE = 4096;
+static const uint16_t DESC_PAGE_SIZE = 512;
+
+class EmulatedDriverFixture
+{
+public:
+    EmulatedDriverFixture() :
+        m_driver(EmulatedLatencyModel{0ns, 0, INFER_LATENCY, 0ns})
+    {}
+
+protected:
+    static constexpr std::chrono::milliseconds INFER_LATENCY = 50ms;
+
+    static uint32_t bit(uint8_t channel_index)
+    {
+        return 1U << channel_index;
+    }
+
+    int enable_channels(uint32_t channels_bitmap)
+    {
+        hailo_vdma_enable_channels_params params{};
+        params.channels_bitmap_per_engine[0] = channels_bitmap;
+        return m_driver.run_ioctl(HAILO_VDMA_ENABLE_CHANNELS, &params);
+    }
+
+    int disable_channels(uint32_t channels_bitmap)
+    {
+        hailo_vdma_disable_channels_params params{};
+        params.channels_bitmap_per_engine[0] = channels_bitmap;
+        return m_driver.run_ioctl(HAILO_VDMA_DISABLE_CHANNELS, &params);
+    }
+
+    hailo_vdma_interrupts_wait_params wait_interrupts(uint32_t channels_bitmap)
+    {
+        hailo_vdma_interrupts_wait_params params{};
+        params.channels_bitmap_per_engine[0] = channels_bitmap;
+        REQUIRE(0 == m_driver.run_ioctl(HAILO_VDMA_INTERRUPTS_WAIT, &params));
+        return params;
+    }
+
+    void create_buffer_and_desc_list()
+    {
+        hailo_vdma_buffer_map_params map_params{};
+        map_params.size = TRANSFER_SIZE;
+        REQUIRE(0 == m_driver.run_ioctl(HAILO_VDMA_BUFFER_MAP, &map_params));
+        m_buffer_handle = map_params.mapped_handle;
+
+        hailo_desc_list_create_params desc_list_params{};
+        desc_list_params.desc_count = 64;
+        desc_list_params.desc_page_size = DESC_PAGE_SIZE;
+        REQUIRE(0 == m_driver.run_ioctl(HAILO_DESC_LIST_CREATE, &desc_list_params));
+        m_desc_handle = desc_list_params.desc_handle;
+    }
+
+    int launch_transfer(uint8_t channel_index, hailo_vdma_launch_transfer_params &params)
+    {
+        params = {};
+        params.engine_index = 0;
+        params.channel_index = channel_index;
+        params.desc_handle = m_desc_handle;
+        params.starting_desc = 0;
+        params.buffers_count = 1;
+        params.buffers[0].mapped_buffer_handle = m_buffer_handle;
+        params.buffers[0].offset = 0;
+        params.buffers[0].size = TRANSFER_SIZE;
+        params.first_interrupts_domain = HAILO_VDMA_INTERRUPTS_DOMAIN_NONE;
+        params.last_interrupts_domain = HAILO_VDMA_INTERRUPTS_DOMAIN_HOST;
+        return m_driver.run_ioctl(HAILO_VDMA_LAUNCH_TRANSFER, &params);
+    }
+
+    EmulatedDriver m_driver;
+    size_t m_buffer_handle = 0;
+    uintptr_t m_desc_handle = 0;
+};
+
+constexpr std::chrono::milliseconds EmulatedDriverFixture::INFER_LATENCY;
+
+TEST_CASE_METHOD(EmulatedDriverFixture, "Emulated driver - transfers complete after the frame is inferred", "[emulated_driver]")
+{
+    create_buffer_and_desc_list();
+    REQUIRE(0 == enable_channels(bit(H2D_CHANNEL_INDEX) | bit(D2H_CHANNEL_INDEX)));
+
+    // The output is launched first, but waits for the input to be inferred
+    const auto start = std::chrono::steady_clock::now();
+    hailo_vdma_launch_transfer_params launch_params{};
+    REQUIRE(0 == launch_transfer(D2H_CHANNEL_INDEX, launch_params));
+    CHECK((TRANSFER_SIZE / DESC_PAGE_SIZE) == launch_params.descs_programed);
+    REQUIRE(0 == launch_transfer(H2D_CHANNEL_INDEX, launch_params));
+
+    auto irq = wait_interrupts(bit(H2D_CHANNEL_INDEX) | bit(D2H_CHANNEL_INDEX));
+    REQUIRE(1 == irq.channels_count);
+    CHECK(H2D_CHANNEL_INDEX == irq.irq_data[0].channel_index);
+    CHECK(1 == irq.irq_data[0].transfers_completed);
+    CHECK(irq.irq_data[0].is_active);
+
+    irq = wait_interrupts(bit(D2H_CHANNEL_INDEX));
+    REQUIRE(1 == irq.channels_count);
+    CHECK(D2H_CHANNEL_INDEX == irq.irq_data[0].channel_index);
+    CHECK(1 == irq.irq_data[0].transfers_completed);
+    CHECK((std::chrono::steady_clock::now() - start) >= INFER_LATENCY);
+
+    REQUIRE(0 == disable_channels(bit(H2D_CHANNEL_INDEX) | bit(D2H_CHANNEL_INDEX)));
+}
+
+TEST_CASE_METHOD(EmulatedDriverFixture, "Emulated driver - invalid transfers", "[emulated_driver]")
+{
+    create_buffer_and_desc_list();
+    hailo_vdma_launch_transfer_params launch_params{};
+
+    // Same as the driver, transfers on a disabled channel are aborted
+    CHECK(ECONNRESET == launch_transfer(H2D_CHANNEL_INDEX, launch_params));
+    CHECK(-ECONNRESET == launch_params.launch_transfer_status);
+
+    REQUIRE(0 == enable_channels(bit(H2D_CHANNEL_INDEX)));
+    // A channel can't be part of two contexts
+    CHECK(EINVAL == enable_channels(bit(H2D_CHANNEL_INDEX)));
+
+    m_buffer_handle++;
+    CHECK(EINVAL == launch_transfer(H2D_CHANNEL_INDEX, launch_params));
+    REQUIRE(0 == disable_channels(bit(H2D_CHANNEL_INDEX)));
+}
+
+TEST_CASE_METHOD(EmulatedDriverFixture, "Emulated driver - interrupts wait on disabled channels", "[emulated_driver]")
+{
+    // Nothing would ever wake the wait up, so it returns at once
+    auto irq = wait_interrupts(bit(H2D_CHANNEL_INDEX) | bit(D2H_CHANNEL_INDEX));
+    CHECK(0 == irq.channels_count);
+
+    REQUIRE(0 == enable_channels(bit(H2D_CHANNEL_INDEX)));
+    REQUIRE(0 == disable_channels(bit(H2D_CHANNEL_INDEX)));
+    irq = wait_interrupts(bit(H2D_CHANNEL_INDEX));
+    CHECK(0 == irq.channels_count);
+}
+
+TEST_CASE_METHOD(EmulatedDriverFixture, "Emulated driver - disable releases interrupts wait", "[emulated_driver]")
+{
+    REQUIRE(0 == enable_channels(bit(H2D_CHANNEL_INDEX)));
+
+    auto waiter = std::async(std::launch::async, [this]() {
+        hailo_vdma_interrupts_wait_params params{};
+        params.channels_bitmap_per_engine[0] = bit(H2D_CHANNEL_INDEX);
+        params.channels_count = UINT8_MAX;
+        const auto result = m_driver.run_ioctl(HAILO_VDMA_INTERRUPTS_WAIT, &params);
+        return std::make_pair(result, params.channels_count);
+    });
+
+    // No transfers were launched, so the wait blocks until the channel is disabled
+    CHECK(std::future_status::timeout == waiter.wait_for(20ms));
+    REQUIRE(0 == disable_channels(bit(H2D_CHANNEL_INDEX)));
+    REQUIRE(std::future_status::ready == waiter.wait_for(5s));
+    const auto result = waiter.get();
+    CHECK(0 == result.first);
+    CHECK(0 == result.second);
+}
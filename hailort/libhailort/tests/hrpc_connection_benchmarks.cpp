@@ -0,0 +1,87 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file hrpc_connection_benchmarks.cpp
+ * @brief Benchmarks of the hrpc socket transports over loopback - a message is sent and a single byte is replied
+ *        to it, like a frame and its acknowledgement. vsock needs a VM (or the vsock_loopback module), so it is not
+ *        measured here.
+ **/
+
+#include "hrpc/raw_connection.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <thread>
+#include <vector>
+
+using namespace hailort;
+
+static void run_ping_pong(benchmark::State &state, const std::string &address)
+{
+    const auto message_size = static_cast<size_t>(state.range(0));
+
+    auto server_context = hrpc::ConnectionContext::create_shared(true, address);
+    auto client_context = hrpc::ConnectionContext::create_shared(false, address);
+    if (!server_context || !client_context) {
+        state.SkipWithError("Failed creating the connection contexts");
+        return;
+    }
+    auto server = hrpc::RawConnection::create_shared(server_context.release());
+    auto client = hrpc::RawConnection::create_shared(client_context.release());
+    if (!server || !client) {
+        state.SkipWithError("Failed creating the connections");
+        return;
+    }
+
+    hailo_status connect_status = HAILO_UNINITIALIZED;
+    std::thread connect_thread([&client, &connect_status]() {
+        connect_status = client.value()->connect();
+    });
+    auto connection = server.value()->accept();
+    connect_thread.join();
+    if (!connection || (HAILO_SUCCESS != connect_status)) {
+        state.SkipWithError("Failed connecting");
+        return;
+    }
+
+    // Echoes a byte per message, until the client closes
+    std::thread server_thread([&connection, message_size]() {
+        std::vector<uint8_t> message(message_size);
+        uint8_t ack = 0;
+        while (HAILO_SUCCESS == connection.value()->read(message.data(), message.size())) {
+            if (HAILO_SUCCESS != connection.value()->write(&ack, sizeof(ack))) {
+                break;
+            }
+        }
+    });
+
+    std::vector<uint8_t> message(message_size);
+    uint8_t ack = 0;
+    for (auto _ : state) {
+        if ((HAILO_SUCCESS != client.value()->write(message.data(), message.size())) ||
+            (HAILO_SUCCESS != client.value()->read(&ack, sizeof(ack)))) {
+            state.SkipWithError("Failed transferring");
+            break;
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+
+    (void)client.value()->close();
+    server_thread.join();
+    (void)connection.value()->close();
+    (void)server.value()->close();
+}
+
+static void BM_UnixSocketPingPong(benchmark::State &state)
+{
+    run_ping_pong(state, "unix:/tmp/hailort_benchmark_socket");
+}
+BENCHMARK(BM_UnixSocketPingPong)->Arg(64)->Arg(4 * 1024)->Arg(1024 * 1024)->UseRealTime();
+
+static void BM_TcpLoopbackPingPong(benchmark::State &state)
+{
+    run_ping_pong(state, "tcp:127.0.0.1:47421");
+}
+BENCHMARK(BM_TcpLoopbackPingPong)->Arg(64)->Arg(4 * 1024)->Arg(1024 * 1024)->UseRealTime();
@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file hrpc_connection_tests.cpp
+ * @brief Tests of the hrpc socket transports
+ **/
+
+#include "hrpc/raw_connection.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <numeric>
+#include <thread>
+
+using namespace hailort;
+
+static void check_connection(const std::string &address)
+{
+    INFO(address);
+    auto server_context = hrpc::ConnectionContext::create_shared(true, address);
+    REQUIRE(server_context);
+    auto server = hrpc::RawConnection::create_shared(server_context.release());
+    REQUIRE(server);
+
+    auto client_context = hrpc::ConnectionContext::create_shared(false, address);
+    REQUIRE(client_context);
+    auto client = hrpc::RawConnection::create_shared(client_context.release());
+    REQUIRE(client);
+
+    // Large enough to fill the socket buffers, so both sides loop over partial transfers
+    std::vector<uint8_t> payload(8 * 1024 * 1024);
+    std::iota(payload.begin(), payload.end(), static_cast<uint8_t>(0));
+
+    hailo_status client_status = HAILO_UNINITIALIZED;
+    std::thread client_thread([&]() {
+        client_status = client.value()->connect();
+        if (HAILO_SUCCESS != client_status) {
+            return;
+        }
+        client_status = client.value()->write(payload.data(), payload.size());
+    });
+
+    auto connection = server.value()->accept();
+    REQUIRE(connection);
+    std::vector<uint8_t> received_payload(payload.size());
+    CHECK(HAILO_SUCCESS == connection.value()->read(received_payload.data(), received_payload.size()));
+    client_thread.join();
+    CHECK(HAILO_SUCCESS == client_status);
+    CHECK(payload == received_payload);
+
+    // The peer closing is reported as such
+    CHECK(HAILO_SUCCESS == client.value()->close());
+    uint8_t byte = 0;
+    CHECK(HAILO_COMMUNICATION_CLOSED == connection.value()->read(&byte, sizeof(byte)));
+    CHECK(HAILO_SUCCESS == connection.value()->close());
+    CHECK(HAILO_SUCCESS == server.value()->close());
+}
+
+TEST_CASE("hrpc connection - unix socket", "[hrpc]")
+{
+    check_connection("unix:/tmp/hailort_ut_socket");
+}
+
+TEST_CASE("hrpc connection - tcp loopback", "[hrpc]")
+{
+    // No host means loopback
+    check_connection("tcp:47321");
+    check_connection("tcp:127.0.0.1:47322");
+}
+
+TEST_CASE("hrpc connection - invalid addresses", "[hrpc]")
+{
+    for (const std::string address : {"", "pipe:x", "tcp:", "tcp:localhost:port", "tcp:1.2.3.4:99999", "vsock:1"}) {
+        INFO(address);
+        CHECK(HAILO_INVALID_ARGUMENT == hrpc::ConnectionContext::create_shared(false, address).status());
+    }
+}
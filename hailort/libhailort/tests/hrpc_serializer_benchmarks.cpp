@@ -0,0 +1,93 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file hrpc_serializer_benchmarks.cpp
+ * @brief Benchmarks of the hrpc messages encoding and decoding - the fixed-layout per-frame messages, and a protobuf
+ *        control message of a similar size for reference
+ **/
+
+#include "hrpc_protocol/serializer.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+
+using namespace hailort;
+using namespace std::chrono_literals;
+
+static void BM_RunAsyncRequestEncode(benchmark::State &state)
+{
+    std::array<uint8_t, RunAsyncSerializer::REQUEST_SIZE> buffer{};
+    for (auto _ : state) {
+        auto request = RunAsyncSerializer::serialize_request(1, 2, 3, MemoryView(buffer.data(), buffer.size()));
+        benchmark::DoNotOptimize(request);
+    }
+}
+BENCHMARK(BM_RunAsyncRequestEncode);
+
+static void BM_RunAsyncRequestDecode(benchmark::State &state)
+{
+    std::array<uint8_t, RunAsyncSerializer::REQUEST_SIZE> buffer{};
+    auto request = RunAsyncSerializer::serialize_request(1, 2, 3, MemoryView(buffer.data(), buffer.size()));
+    if (!request) {
+        state.SkipWithError("Failed serializing the request");
+        return;
+    }
+    for (auto _ : state) {
+        auto handles = RunAsyncSerializer::deserialize_request(request.value());
+        benchmark::DoNotOptimize(handles);
+    }
+}
+BENCHMARK(BM_RunAsyncRequestDecode);
+
+static void BM_CallbackCalledReplyEncode(benchmark::State &state)
+{
+    std::array<uint8_t, CallbackCalledSerializer::REPLY_SIZE> buffer{};
+    for (auto _ : state) {
+        auto reply = CallbackCalledSerializer::serialize_reply(HAILO_SUCCESS, 1, 2, 4096,
+            MemoryView(buffer.data(), buffer.size()));
+        benchmark::DoNotOptimize(reply);
+    }
+}
+BENCHMARK(BM_CallbackCalledReplyEncode);
+
+static void BM_CallbackCalledReplyDecode(benchmark::State &state)
+{
+    std::array<uint8_t, CallbackCalledSerializer::REPLY_SIZE> buffer{};
+    auto reply = CallbackCalledSerializer::serialize_reply(HAILO_SUCCESS, 1, 2, 4096, MemoryView(buffer.data(), buffer.size()));
+    if (!reply) {
+        state.SkipWithError("Failed serializing the reply");
+        return;
+    }
+    for (auto _ : state) {
+        auto fields = CallbackCalledSerializer::deserialize_reply(reply.value());
+        benchmark::DoNotOptimize(fields);
+    }
+}
+BENCHMARK(BM_CallbackCalledReplyDecode);
+
+// Protobuf reference - the per-frame messages used to be encoded like the control messages
+static void BM_ProtobufRequestEncode(benchmark::State &state)
+{
+    for (auto _ : state) {
+        auto request = SetSchedulerTimeoutSerializer::serialize_request(1, 100ms);
+        benchmark::DoNotOptimize(request);
+    }
+}
+BENCHMARK(BM_ProtobufRequestEncode);
+
+static void BM_ProtobufRequestDecode(benchmark::State &state)
+{
+    auto request = SetSchedulerTimeoutSerializer::serialize_request(1, 100ms);
+    if (!request) {
+        state.SkipWithError("Failed serializing the request");
+        return;
+    }
+    for (auto _ : state) {
+        auto fields = SetSchedulerTimeoutSerializer::deserialize_request(MemoryView(request.value()));
+        benchmark::DoNotOptimize(fields);
+    }
+}
+BENCHMARK(BM_ProtobufRequestDecode);
@@ -0,0 +1,102 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file hrpc_serializer_tests.cpp
+ * @brief Tests of the hrpc messages serialization
+ **/
+
+#include "hrpc_protocol/serializer.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <cstring>
+
+using namespace hailort;
+using namespace std::chrono_literals;
+
+TEST_CASE("hrpc serializer - run async", "[hrpc]")
+{
+    std::array<uint8_t, RunAsyncSerializer::REQUEST_SIZE> request_buffer{};
+    auto request = RunAsyncSerializer::serialize_request(1, 2, 3, MemoryView(request_buffer.data(), request_buffer.size()));
+    REQUIRE(request);
+    CHECK(RunAsyncSerializer::REQUEST_SIZE == request->size());
+
+    auto handles = RunAsyncSerializer::deserialize_request(request.value());
+    REQUIRE(handles);
+    CHECK(1 == std::get<0>(handles.value()));
+    CHECK(2 == std::get<1>(handles.value()));
+    CHECK(3 == std::get<2>(handles.value()));
+
+    auto reply = RunAsyncSerializer::serialize_reply(HAILO_QUEUE_IS_FULL);
+    REQUIRE(reply);
+    CHECK(HAILO_QUEUE_IS_FULL == RunAsyncSerializer::deserialize_reply(MemoryView(reply.value())));
+}
+
+TEST_CASE("hrpc serializer - callback called", "[hrpc]")
+{
+    // One extra byte, the message isn't required to be aligned
+    std::array<uint8_t, CallbackCalledSerializer::REPLY_SIZE + 1> buffer{};
+    const MemoryView unaligned_view(buffer.data() + 1, CallbackCalledSerializer::REPLY_SIZE);
+    const uint64_t BUFFERS_SIZE = (1ULL << 33) + 5;
+    auto reply = CallbackCalledSerializer::serialize_reply(HAILO_SUCCESS, 7, 8, BUFFERS_SIZE, unaligned_view);
+    REQUIRE(reply);
+
+    auto fields = CallbackCalledSerializer::deserialize_reply(reply.value());
+    REQUIRE(fields);
+    CHECK(HAILO_SUCCESS == std::get<0>(fields.value()));
+    CHECK(7 == std::get<1>(fields.value()));
+    CHECK(8 == std::get<2>(fields.value()));
+    CHECK(BUFFERS_SIZE == std::get<3>(fields.value()));
+}
+
+TEST_CASE("hrpc serializer - invalid fixed messages", "[hrpc]")
+{
+    std::array<uint8_t, CallbackCalledSerializer::REPLY_SIZE> buffer{};
+    const MemoryView view(buffer.data(), buffer.size());
+
+    // The buffer given to serialize into is too small
+    CHECK(HAILO_INSUFFICIENT_BUFFER == CallbackCalledSerializer::serialize_reply(HAILO_SUCCESS, 0, 0, 0,
+        MemoryView(buffer.data(), buffer.size() - 1)).status());
+
+    REQUIRE(CallbackCalledSerializer::serialize_reply(HAILO_SUCCESS, 0, 0, 0, view));
+    rpc_fixed_message_header_t header{};
+    std::memcpy(&header, buffer.data(), sizeof(header));
+    CHECK(RPC_FIXED_MESSAGE_VERSION == header.version);
+    CHECK(CallbackCalledSerializer::REPLY_SIZE == header.size);
+
+    SECTION("Truncated message") {
+        CHECK(HAILO_RPC_FAILED == CallbackCalledSerializer::deserialize_reply(
+            MemoryView(buffer.data(), buffer.size() - 1)).status());
+        CHECK(HAILO_RPC_FAILED == CallbackCalledSerializer::deserialize_reply(
+            MemoryView(buffer.data(), sizeof(header) - 1)).status());
+    }
+    SECTION("Other version") {
+        header.version = RPC_FIXED_MESSAGE_VERSION + 1;
+        std::memcpy(buffer.data(), &header, sizeof(header));
+        CHECK(HAILO_RPC_FAILED == CallbackCalledSerializer::deserialize_reply(view).status());
+    }
+    SECTION("Other message") {
+        // A message of another type has another size
+        CHECK(HAILO_RPC_FAILED == RunAsyncSerializer::deserialize_reply(view));
+    }
+}
+
+TEST_CASE("hrpc serializer - protobuf messages", "[hrpc]")
+{
+    auto request = SetSchedulerTimeoutSerializer::serialize_request(5, 100ms);
+    REQUIRE(request);
+    auto handle_and_timeout = SetSchedulerTimeoutSerializer::deserialize_request(MemoryView(request.value()));
+    REQUIRE(handle_and_timeout);
+    CHECK(5 == std::get<0>(handle_and_timeout.value()));
+    CHECK(100ms == std::get<1>(handle_and_timeout.value()));
+
+    auto reply = CreateInferModelSerializer::serialize_reply(HAILO_SUCCESS, 9);
+    REQUIRE(reply);
+    auto status_and_handle = CreateInferModelSerializer::deserialize_reply(MemoryView(reply.value()));
+    REQUIRE(status_and_handle);
+    CHECK(HAILO_SUCCESS == std::get<0>(status_and_handle.value()));
+    CHECK(9 == std::get<1>(status_and_handle.value()));
+}
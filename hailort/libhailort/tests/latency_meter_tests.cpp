@@ -0,0 +1,140 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file latency_meter_tests.cpp
+ * @brief Tests of the latency histogram and the latency meter
+ **/
+
+#include "hailo/hailort.h"
+#include "hailo/network_group.hpp"
+#include "common/latency_meter.hpp"
+
+#include <catch2/catch.hpp>
+
+using namespace hailort;
+using namespace std::chrono_literals;
+
+// Percentiles are exact up to the bucket width, which is at most 1/SUB_BUCKETS_COUNT of the value
+static void check_approx(std::chrono::nanoseconds expected, std::chrono::nanoseconds actual)
+{
+    const auto tolerance = expected.count() / static_cast<int64_t>(LatencyHistogram::SUB_BUCKETS_COUNT);
+    CHECK(std::abs(expected.count() - actual.count()) <= tolerance);
+}
+
+TEST_CASE("Latency histogram - empty", "[latency_meter]")
+{
+    LatencyHistogram histogram;
+    const auto snapshot = histogram.snapshot(false);
+    CHECK(0 == snapshot.count);
+    CHECK(0ns == snapshot.mean());
+    CHECK(0ns == snapshot.percentile(50));
+    CHECK(0ns == snapshot.max);
+}
+
+TEST_CASE("Latency histogram - small values are exact", "[latency_meter]")
+{
+    LatencyHistogram histogram;
+    for (int64_t i = 1; i <= 10; i++) {
+        histogram.add_sample(std::chrono::nanoseconds(i));
+    }
+    const auto snapshot = histogram.snapshot(false);
+    CHECK(10 == snapshot.count);
+    CHECK(5ns == snapshot.mean()); // 55 / 10, rounded down
+    CHECK(5ns == snapshot.percentile(50));
+    CHECK(10ns == snapshot.percentile(100));
+    CHECK(1ns == snapshot.percentile(0));
+    CHECK(10ns == snapshot.max);
+}
+
+TEST_CASE("Latency histogram - percentiles", "[latency_meter]")
+{
+    LatencyHistogram histogram;
+    for (int64_t i = 1; i <= 1000; i++) {
+        histogram.add_sample(std::chrono::microseconds(i));
+    }
+    const auto snapshot = histogram.snapshot(false);
+    CHECK(1000 == snapshot.count);
+    CHECK(std::chrono::nanoseconds(500500) == snapshot.mean());
+    check_approx(500us, snapshot.percentile(50));
+    check_approx(950us, snapshot.percentile(95));
+    check_approx(990us, snapshot.percentile(99));
+    // Never above the largest sample
+    CHECK(1000us == snapshot.max);
+    CHECK(snapshot.percentile(100) <= snapshot.max);
+}
+
+TEST_CASE("Latency histogram - out of range samples", "[latency_meter]")
+{
+    LatencyHistogram histogram;
+    histogram.add_sample(std::chrono::nanoseconds(-5));
+    histogram.add_sample(std::chrono::hours(1));
+    const auto snapshot = histogram.snapshot(false);
+    CHECK(2 == snapshot.count);
+    // Negative samples are counted as 0, samples past the last bucket are kept in it (max stays exact)
+    CHECK(0ns == snapshot.percentile(50));
+    CHECK(std::chrono::hours(1) == snapshot.max);
+    CHECK(snapshot.percentile(100) <= snapshot.max);
+}
+
+TEST_CASE("Latency histogram - reset and merge", "[latency_meter]")
+{
+    LatencyHistogram histogram;
+    histogram.add_sample(10us);
+    histogram.add_sample(20us);
+
+    auto first = histogram.snapshot(false);
+    CHECK(2 == first.count);
+    first = histogram.snapshot(true);
+    CHECK(2 == first.count);
+
+    // Each sample is returned by exactly one reset snapshot
+    histogram.add_sample(40us);
+    const auto second = histogram.snapshot(true);
+    CHECK(1 == second.count);
+    CHECK(40us == second.max);
+    CHECK(0 == histogram.snapshot(false).count);
+
+    auto merged = first;
+    merged.merge(second);
+    CHECK(3 == merged.count);
+    CHECK(std::chrono::nanoseconds(70000 / 3) == merged.mean());
+    CHECK(40us == merged.max);
+    check_approx(20us, merged.percentile(50));
+}
+
+TEST_CASE("Latency meter - frame latency", "[latency_meter]")
+{
+    LatencyMeter meter({"output0", "output1"}, 16);
+    CHECK(HAILO_NOT_AVAILABLE == meter.get_latency_histogram(false).status());
+    CHECK(HAILO_NOT_AVAILABLE == meter.get_latency(false).status());
+
+    // The frame ends when its last output ends
+    meter.add_start_sample(100us);
+    meter.add_end_sample("output0", 150us);
+    CHECK(HAILO_NOT_AVAILABLE == meter.get_latency(false).status());
+    meter.add_end_sample("output1", 130us);
+
+    meter.add_start_sample(200us);
+    meter.add_end_sample("output1", 230us);
+    meter.add_end_sample("output0", 290us);
+
+    auto histogram = meter.get_latency_histogram(false);
+    REQUIRE(histogram);
+    CHECK(2 == histogram->count);
+    CHECK(90us == histogram->max);
+    CHECK(70us == histogram->mean());
+
+    auto latency = meter.get_latency(true);
+    REQUIRE(latency);
+    CHECK(70us == latency.value());
+    CHECK(HAILO_NOT_AVAILABLE == meter.get_latency(false).status());
+}
+
+TEST_CASE("Latency measurement result - layout", "[latency_meter]")
+{
+    // Applications built against older headers allocate these, the distribution is returned by the _ext variants
+    CHECK(sizeof(float64_t) == sizeof(hailo_latency_measurement_result_t));
+    CHECK(sizeof(std::chrono::nanoseconds) == sizeof(LatencyMeasurementResult));
+}
@@ -0,0 +1,11 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file main.cpp
+ * @brief Entry point of HailoRT's unit tests
+ **/
+
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
@@ -0,0 +1,208 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file preprocess_tests.cpp
+ * @brief Tests of the host pre-processing (resize, letterbox/crop and normalize)
+ **/
+
+#include "transform/preprocess.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <vector>
+
+using namespace hailort;
+
+static hailo_preprocess_params_t create_params(hailo_resize_mode_t resize_mode, uint32_t src_width, uint32_t src_height,
+    hailo_format_order_t src_order = HAILO_FORMAT_ORDER_NHWC)
+{
+    hailo_preprocess_params_t params{};
+    params.resize_mode = resize_mode;
+    params.src_width = src_width;
+    params.src_height = src_height;
+    params.src_order = src_order;
+    return params;
+}
+
+static std::vector<uint8_t> run_preprocess(const hailo_preprocess_params_t &params, const hailo_3d_image_shape_t &dst_shape,
+    std::vector<uint8_t> &src)
+{
+    auto context = PreProcessContext::create(params, dst_shape);
+    REQUIRE(context);
+    REQUIRE(src.size() == context.value()->src_frame_size());
+
+    std::vector<uint8_t> dst(context.value()->dst_frame_size());
+    REQUIRE(HAILO_SUCCESS == context.value()->run(MemoryView(src.data(), src.size()), MemoryView(dst.data(), dst.size())));
+    return dst;
+}
+
+TEST_CASE("Pre-process - transform info", "[preprocess]")
+{
+    const hailo_3d_image_shape_t dst_shape = {100, 100, 3};
+
+    auto stretch = PreProcessContext::get_transform_info(create_params(HAILO_RESIZE_MODE_STRETCH, 200, 100), dst_shape);
+    REQUIRE(stretch);
+    CHECK(Approx(0.5f) == stretch->scale_x);
+    CHECK(Approx(1.0f) == stretch->scale_y);
+    CHECK(Approx(0.0f).margin(1e-4) == stretch->offset_x);
+    CHECK(Approx(0.0f).margin(1e-4) == stretch->offset_y);
+
+    // Scaled by the longer side, centered vertically
+    auto letterbox = PreProcessContext::get_transform_info(create_params(HAILO_RESIZE_MODE_LETTERBOX, 200, 100), dst_shape);
+    REQUIRE(letterbox);
+    CHECK(Approx(0.5f) == letterbox->scale_x);
+    CHECK(Approx(0.5f) == letterbox->scale_y);
+    CHECK(Approx(0.0f).margin(1e-4) == letterbox->offset_x);
+    CHECK(Approx(25.0f) == letterbox->offset_y);
+
+    // Scaled by the shorter side, centered horizontally
+    auto crop = PreProcessContext::get_transform_info(create_params(HAILO_RESIZE_MODE_CROP, 200, 100), dst_shape);
+    REQUIRE(crop);
+    CHECK(Approx(1.0f) == crop->scale_x);
+    CHECK(Approx(1.0f) == crop->scale_y);
+    CHECK(Approx(-50.0f) == crop->offset_x);
+    CHECK(Approx(0.0f).margin(1e-4) == crop->offset_y);
+
+    // The right half of the frame, stretched
+    const hailo_rectangle_t roi = {0.0f, 0.5f, 1.0f, 1.0f};
+    auto roi_stretch = PreProcessContext::get_transform_info(create_params(HAILO_RESIZE_MODE_STRETCH, 200, 100), dst_shape, roi);
+    REQUIRE(roi_stretch);
+    CHECK(Approx(1.0f) == roi_stretch->scale_x);
+    CHECK(Approx(-100.0f) == roi_stretch->offset_x);
+}
+
+TEST_CASE("Pre-process - invalid params", "[preprocess]")
+{
+    const hailo_3d_image_shape_t rgb_shape = {16, 16, 3};
+
+    CHECK(HAILO_INVALID_ARGUMENT == PreProcessContext::validate(create_params(HAILO_RESIZE_MODE_NONE, 32, 32), rgb_shape));
+    CHECK(HAILO_INVALID_ARGUMENT == PreProcessContext::validate(create_params(HAILO_RESIZE_MODE_STRETCH, 1, 32), rgb_shape));
+    CHECK(HAILO_INVALID_ARGUMENT == PreProcessContext::validate(create_params(HAILO_RESIZE_MODE_STRETCH, 32, 32),
+        hailo_3d_image_shape_t{16, 16, 4}));
+    CHECK(HAILO_INVALID_ARGUMENT == PreProcessContext::validate(
+        create_params(HAILO_RESIZE_MODE_STRETCH, 32, 32, HAILO_FORMAT_ORDER_NCHW), rgb_shape));
+    CHECK(HAILO_INVALID_ARGUMENT == PreProcessContext::validate(
+        create_params(HAILO_RESIZE_MODE_STRETCH, 33, 32, HAILO_FORMAT_ORDER_NV12), rgb_shape));
+    CHECK(HAILO_INVALID_ARGUMENT == PreProcessContext::validate(
+        create_params(HAILO_RESIZE_MODE_STRETCH, 32, 32, HAILO_FORMAT_ORDER_NV12), hailo_3d_image_shape_t{16, 16, 1}));
+
+    auto params = create_params(HAILO_RESIZE_MODE_STRETCH, 32, 32);
+    params.normalize = true;
+    params.std[0] = params.std[1] = 1.0f;
+    CHECK(HAILO_INVALID_ARGUMENT == PreProcessContext::validate(params, rgb_shape));
+
+    params = create_params(HAILO_RESIZE_MODE_STRETCH, 32, 32);
+    CHECK(HAILO_INVALID_ARGUMENT == PreProcessContext::validate_roi(params, {0.5f, 0.0f, 0.4f, 1.0f}));
+    CHECK(HAILO_INVALID_ARGUMENT == PreProcessContext::validate_roi(params, {0.0f, 0.0f, 1.1f, 1.0f}));
+    CHECK(HAILO_INVALID_ARGUMENT == PreProcessContext::validate_roi(params, {0.0f, 0.0f, 0.01f, 1.0f}));
+}
+
+TEST_CASE("Pre-process - frame sizes", "[preprocess]")
+{
+    const hailo_3d_image_shape_t dst_shape = {16, 16, 3};
+    CHECK((40 * 30 * 3) == PreProcessContext::get_src_frame_size(create_params(HAILO_RESIZE_MODE_STRETCH, 40, 30), dst_shape));
+    CHECK((40 * 30 * 3 / 2) == PreProcessContext::get_src_frame_size(
+        create_params(HAILO_RESIZE_MODE_STRETCH, 40, 30, HAILO_FORMAT_ORDER_NV12), dst_shape));
+
+    auto params = create_params(HAILO_RESIZE_MODE_STRETCH, 40, 30);
+    CHECK(HAILO_FORMAT_TYPE_UINT8 == PreProcessContext::get_dst_format(params).type);
+    params.normalize = true;
+    CHECK(HAILO_FORMAT_TYPE_FLOAT32 == PreProcessContext::get_dst_format(params).type);
+    CHECK(HAILO_FORMAT_ORDER_NHWC == PreProcessContext::get_dst_format(params).order);
+}
+
+TEST_CASE("Pre-process - same size is a copy", "[preprocess]")
+{
+    const hailo_3d_image_shape_t dst_shape = {7, 5, 3};
+    std::vector<uint8_t> src(7 * 5 * 3);
+    for (size_t i = 0; i < src.size(); i++) {
+        src[i] = static_cast<uint8_t>((i * 37) % 256);
+    }
+    CHECK(src == run_preprocess(create_params(HAILO_RESIZE_MODE_STRETCH, 5, 7), dst_shape, src));
+}
+
+TEST_CASE("Pre-process - bilinear upscale", "[preprocess]")
+{
+    // A horizontal gradient, upscaled x2. Pixel centers are aligned, and the edges are clamped.
+    const hailo_3d_image_shape_t dst_shape = {2, 8, 1};
+    std::vector<uint8_t> src = {
+        0, 64, 128, 192,
+        0, 64, 128, 192,
+    };
+    const std::vector<int> expected = {0, 16, 48, 80, 112, 144, 176, 192};
+
+    const auto dst = run_preprocess(create_params(HAILO_RESIZE_MODE_STRETCH, 4, 2), dst_shape, src);
+    for (size_t row = 0; row < dst_shape.height; row++) {
+        for (size_t col = 0; col < dst_shape.width; col++) {
+            INFO("row " << row << " col " << col);
+            CHECK(std::abs(expected[col] - static_cast<int>(dst[(row * dst_shape.width) + col])) <= 1);
+        }
+    }
+}
+
+TEST_CASE("Pre-process - letterbox padding", "[preprocess]")
+{
+    // 8x4 frame into 8x8 - the frame is in rows 2-5, the rest is padding
+    const hailo_3d_image_shape_t dst_shape = {8, 8, 3};
+    auto params = create_params(HAILO_RESIZE_MODE_LETTERBOX, 8, 4);
+    params.padding_value[0] = 1;
+    params.padding_value[1] = 2;
+    params.padding_value[2] = 3;
+    std::vector<uint8_t> src(8 * 4 * 3, 200);
+
+    const auto dst = run_preprocess(params, dst_shape, src);
+    for (size_t row = 0; row < dst_shape.height; row++) {
+        const bool is_padding = (row < 2) || (row >= 6);
+        for (size_t col = 0; col < dst_shape.width; col++) {
+            for (size_t c = 0; c < dst_shape.features; c++) {
+                INFO("row " << row << " col " << col << " channel " << c);
+                const auto value = dst[(((row * dst_shape.width) + col) * dst_shape.features) + c];
+                CHECK((is_padding ? params.padding_value[c] : 200) == value);
+            }
+        }
+    }
+}
+
+TEST_CASE("Pre-process - normalize", "[preprocess]")
+{
+    const hailo_3d_image_shape_t dst_shape = {2, 2, 3};
+    auto params = create_params(HAILO_RESIZE_MODE_STRETCH, 4, 4);
+    params.normalize = true;
+    const float32_t mean[] = {10.0f, 20.0f, 30.0f};
+    const float32_t std[] = {2.0f, 4.0f, 0.5f};
+    for (size_t c = 0; c < 3; c++) {
+        params.mean[c] = mean[c];
+        params.std[c] = std[c];
+    }
+    std::vector<uint8_t> src(4 * 4 * 3);
+    for (size_t i = 0; i < src.size(); i += 3) {
+        src[i] = 50;
+        src[i + 1] = 100;
+        src[i + 2] = 150;
+    }
+
+    auto dst = run_preprocess(params, dst_shape, src);
+    REQUIRE((2 * 2 * 3 * sizeof(float32_t)) == dst.size());
+    const auto dst_floats = reinterpret_cast<const float32_t*>(dst.data());
+    for (size_t i = 0; i < (2 * 2); i++) {
+        CHECK(Approx(20.0f) == dst_floats[(i * 3) + 0]);
+        CHECK(Approx(20.0f) == dst_floats[(i * 3) + 1]);
+        CHECK(Approx(240.0f) == dst_floats[(i * 3) + 2]);
+    }
+}
+
+TEST_CASE("Pre-process - NV12 source", "[preprocess]")
+{
+    // Y=126, U=V=128 is gray 128 in BT.601 limited range
+    const hailo_3d_image_shape_t dst_shape = {2, 2, 3};
+    std::vector<uint8_t> src(4 * 4);
+    src.insert(src.end(), 4 * 4 / 2, 128);
+    std::fill(src.begin(), src.begin() + (4 * 4), static_cast<uint8_t>(126));
+
+    const auto dst = run_preprocess(create_params(HAILO_RESIZE_MODE_STRETCH, 4, 4, HAILO_FORMAT_ORDER_NV12), dst_shape, src);
+    for (const auto value : dst) {
+        CHECK(std::abs(128 - static_cast<int>(value)) <= 1);
+    }
+}
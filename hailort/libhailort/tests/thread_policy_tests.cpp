@@ -0,0 +1,109 @@
+/**
+ * Copyright (c) 2024 Hailo Technologies Ltd. All rights reserved.
+ * Distributed under the MIT license (https://opensource.org/licenses/MIT)
+ **/
+/**
+ * @file thread_policy_tests.cpp
+ * @brief Tests of the thread policy configuration parsing and matching
+ **/
+
+#include "common/thread_policy.hpp"
+
+#include <catch2/catch.hpp>
+
+using namespace hailort;
+
+TEST_CASE("Thread policy - parse entries", "[thread_policy]")
+{
+    auto policies = ThreadPolicyConfig::parse(
+        "# comment line\n"
+        "CHANNEL_INTR cpus=2 policy=fifo priority=50; VDMA_COMPLETE cpus=3,5-6\n"
+        "  * cpus=0-1 nice=5  \n"
+        "SCHEDULER policy=rr;;\n");
+    REQUIRE(policies);
+    REQUIRE(4 == policies->size());
+
+    const auto &channel_intr = policies->at("CHANNEL_INTR");
+    CHECK(std::vector<uint32_t>{2} == channel_intr.cpus);
+    CHECK(ThreadPolicy::SchedulingPolicy::FIFO == channel_intr.scheduling_policy);
+    CHECK(50 == channel_intr.priority);
+    CHECK(ThreadPolicy::UNCHANGED_NICE == channel_intr.nice);
+
+    const auto &vdma_complete = policies->at("VDMA_COMPLETE");
+    CHECK(std::vector<uint32_t>{3, 5, 6} == vdma_complete.cpus);
+    CHECK(ThreadPolicy::SchedulingPolicy::UNCHANGED == vdma_complete.scheduling_policy);
+
+    const auto &all = policies->at("*");
+    CHECK(std::vector<uint32_t>{0, 1} == all.cpus);
+    CHECK(5 == all.nice);
+
+    // A real-time policy with no priority gets the lowest one
+    const auto &scheduler = policies->at("SCHEDULER");
+    CHECK(ThreadPolicy::SchedulingPolicy::RR == scheduler.scheduling_policy);
+    CHECK(1 == scheduler.priority);
+    CHECK(scheduler.cpus.empty());
+}
+
+TEST_CASE("Thread policy - empty configuration", "[thread_policy]")
+{
+    auto policies = ThreadPolicyConfig::parse(" \n# only a comment\n;");
+    REQUIRE(policies);
+    CHECK(policies->empty());
+}
+
+TEST_CASE("Thread policy - invalid entries", "[thread_policy]")
+{
+    const std::vector<std::string> invalid_configs = {
+        "ROLE cpus",                    // Not key=value
+        "ROLE cpus=",                   // Empty cpus list
+        "ROLE cpus=3-1",                // Reversed range
+        "ROLE cpus=1024",               // CPU index out of range
+        "ROLE cpus=a",                  // Not a number
+        "ROLE policy=batch",            // Unknown scheduling policy
+        "ROLE policy=fifo priority=0",  // Priority out of range
+        "ROLE policy=rr priority=100",  // Priority out of range
+        "ROLE priority=10",             // Priority without a real-time policy
+        "ROLE policy=other priority=10",
+        "ROLE nice=-21",                // Nice out of range
+        "ROLE nice=20",
+        "ROLE affinity=1",              // Unknown option
+        "GOOD cpus=1; BAD cpus=x",      // A single bad entry fails the whole configuration
+    };
+    for (const auto &config : invalid_configs) {
+        INFO(config);
+        auto policies = ThreadPolicyConfig::parse(config);
+        REQUIRE_FALSE(policies);
+        CHECK(HAILO_INVALID_ARGUMENT == policies.status());
+    }
+}
+
+// Returns the nice level of the policy matching the given role
+static int32_t get_nice(ThreadPolicyConfig &config, const std::string &role)
+{
+    auto policy = config.get_policy(role);
+    REQUIRE(policy);
+    return policy->nice;
+}
+
+TEST_CASE("Thread policy - role matching", "[thread_policy]")
+{
+    auto &config = ThreadPolicyConfig::get_instance();
+    REQUIRE(HAILO_SUCCESS == config.set("* nice=1; VDMA* nice=2; VDMA_COMPLETE nice=3"));
+
+    // Exact match is preferred, then the longest prefix
+    CHECK(3 == get_nice(config, "VDMA_COMPLETE"));
+    CHECK(2 == get_nice(config, "VDMA_OTHER"));
+    CHECK(1 == get_nice(config, "SCHEDULER"));
+
+    // An invalid configuration keeps the previous one
+    CHECK(HAILO_INVALID_ARGUMENT == config.set("* nice=100"));
+    CHECK(1 == get_nice(config, "SCHEDULER"));
+
+    // Each configuration replaces the previous one (on top of the environment's, which is empty here)
+    REQUIRE(HAILO_SUCCESS == config.set("VDMA* nice=4"));
+    CHECK(HAILO_NOT_FOUND == config.get_policy("SCHEDULER").status());
+    CHECK(4 == get_nice(config, "VDMA_COMPLETE"));
+
+    REQUIRE(HAILO_SUCCESS == config.set(""));
+    CHECK(HAILO_NOT_FOUND == config.get_policy("VDMA_COMPLETE").status());
+}